@@ -265,7 +265,8 @@ $packages =
 	"mongo-cxx-driver",
 	"xerces-c",
 	"zeromq",
-	"cppzmq"
+	"cppzmq",
+	"zstd"
 )
 
 $targetPackages = 
@@ -283,7 +284,8 @@ $targetPackages =
 	"mongo-cxx-driver",
 	"xerces-c",
 	"zeromq",
-	"cppzmq"
+	"cppzmq",
+	"zstd"
 )
 
 foreach ($pkg in $packages) 
@@ -0,0 +1,333 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   BenchCompare – Compares two benchmark runs (JSON written with --json) and flags the regressions
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// JSON INCLUDES
+#include <nlohmann/json.hpp>
+
+// Constant expresions.
+constexpr double kDefaultThreshold = 5.0;   // Percent change flagged as a regression.
+
+/**
+ * @brief One benchmark value of a run.
+ */
+struct RunValue
+{
+    double value;          ///< Measured value.
+    std::string unit;      ///< Unit.
+    std::string better;    ///< "lower", "higher" or "none".
+    std::string suite;     ///< Suite of the value.
+    std::string section;   ///< Section of the value within the suite.
+};
+
+/**
+ * @brief All the values of a run (one or more suites), by "suite / section / name".
+ */
+struct Run
+{
+    std::map<std::string, RunValue> values;                      ///< Results.
+    std::map<std::string, std::map<std::string, std::string>> machines;   ///< Machine metadata by suite.
+};
+
+/**
+ * @brief Add the results of a JSON file to a run.
+ */
+bool loadFile(const std::filesystem::path& path, Run& run)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        std::cerr << "[ERROR] Cannot read " << path.string() << std::endl;
+        return false;
+    }
+
+    try
+    {
+        const nlohmann::json json = nlohmann::json::parse(file);
+        const std::string suite = json.at("suite").get<std::string>();
+        for (const auto& [key, value] : json.at("machine").items())
+            run.machines[suite][key] = value.get<std::string>();
+
+        for (const nlohmann::json& result : json.at("results"))
+        {
+            // Non-finite values are stored as null.
+            if (result.at("value").is_null())
+                continue;
+            const std::string section = result.at("section").get<std::string>();
+            const std::string key = suite + " / " + section + " / " + result.at("name").get<std::string>();
+            run.values[key] = {result.at("value").get<double>(), result.at("unit").get<std::string>(),
+                               result.value("better", std::string("none")), suite, section};
+        }
+    }
+    catch (const nlohmann::json::exception& e)
+    {
+        std::cerr << "[ERROR] Invalid benchmark file " << path.string() << ": " << e.what() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Load a run from a JSON file or from all the JSON files of a directory.
+ */
+bool loadRun(const std::filesystem::path& path, Run& run)
+{
+    if (!std::filesystem::is_directory(path))
+        return loadFile(path, run);
+
+    std::vector<std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::directory_iterator(path))
+    {
+        if (entry.is_regular_file() && entry.path().extension() == ".json")
+            files.push_back(entry.path());
+    }
+    std::sort(files.begin(), files.end());
+    if (files.empty())
+    {
+        std::cerr << "[ERROR] No benchmark files in " << path.string() << std::endl;
+        return false;
+    }
+    return std::all_of(files.begin(), files.end(), [&run](const std::filesystem::path& file)
+    {
+        return loadFile(file, run);
+    });
+}
+
+/**
+ * @brief Print the machine fields that differ between the runs (the comparison may not be meaningful).
+ */
+void printMachineDifferences(const Run& baseline, const Run& current)
+{
+    for (const auto& [suite, machine] : current.machines)
+    {
+        const auto base = baseline.machines.find(suite);
+        if (base == baseline.machines.end())
+            continue;
+        for (const auto& [key, value] : machine)
+        {
+            const auto it = base->second.find(key);
+            const std::string base_value = it == base->second.end() ? std::string("-") : it->second;
+            if (base_value != value)
+                std::cout << "[WARN] " << suite << ": " << key << " differs (\"" << base_value << "\" -> \"" << value
+                          << "\")" << std::endl;
+        }
+    }
+}
+
+/**
+ * @brief Print one line of the comparison table (empty texts leave the column blank).
+ */
+void printRow(std::string_view status, const std::string& change, const std::string& before, const std::string& now,
+              const std::string& unit, const std::string& key)
+{
+    std::cout << "  " << std::left << std::setw(11) << status << std::right << std::setw(10) << change
+              << std::setw(14) << before << std::setw(14) << now << " " << std::left << std::setw(10) << unit
+              << std::right << key << std::endl;
+}
+
+/**
+ * @brief Fixed-point text of a value.
+ */
+std::string number(double value, int precision)
+{
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(precision) << value;
+    return out.str();
+}
+
+/**
+ * @brief Geometric mean of the speedups of a group of values.
+ */
+struct Speedup
+{
+    double log_sum = 0.0;   ///< Sum of the logarithms of the speedups.
+    int count = 0;          ///< Values of the group.
+};
+
+/**
+ * @brief Add the speedup of a value to its suite and to its section ("suite / section").
+ *
+ * The speedup is baseline / current for the "lower" values and current / baseline for the "higher" ones, so it is
+ * above 1 when the current run is faster. Values without direction or not positive are left out.
+ */
+void addSpeedup(std::map<std::string, Speedup>& speedups, const RunValue& before, const RunValue& now)
+{
+    if (before.value <= 0.0 || now.value <= 0.0 || (now.better != "lower" && now.better != "higher"))
+        return;
+
+    const double speedup = now.better == "lower" ? before.value / now.value : now.value / before.value;
+    for (const std::string& group : {now.suite, now.suite + " / " + now.section})
+    {
+        speedups[group].log_sum += std::log(speedup);
+        ++speedups[group].count;
+    }
+}
+
+/**
+ * @brief Print the speedups by suite (the workload) and by section.
+ */
+void printSpeedups(const std::map<std::string, Speedup>& speedups)
+{
+    std::cout << "[INFO] Speedup against the baseline (geometric mean, above 1 is faster):" << std::endl;
+    for (const auto& [group, speedup] : speedups)
+    {
+        const bool section = group.find(" / ") != std::string::npos;
+        std::cout << "  " << std::right << std::setw(8) << ("x" + number(std::exp(speedup.log_sum / speedup.count), 3))
+                  << std::setw(6) << speedup.count << " values  " << (section ? "  " : "") << group << std::endl;
+    }
+}
+
+void printUsage()
+{
+    std::cout << "Usage: bench_compare <baseline> <current> [--threshold <percent>] [--all] [--speedup]" << std::endl
+              << "  <baseline>, <current>  JSON file written by a Bench_* --json, or a directory of them." << std::endl
+              << "  --threshold <percent>  Change in the worse direction flagged as a regression (default "
+              << kDefaultThreshold << ")." << std::endl
+              << "  --all                  Print every value, not only the changes beyond the threshold." << std::endl
+              << "  --speedup              Print the speedup of each suite and section (e.g. PGO build against -O3)."
+              << std::endl
+              << "Exit code: 0 no regressions, 1 regressions, 2 invalid input." << std::endl;
+}
+
+/**
+ * @brief Main entry point of the bench_compare tool.
+ */
+int main(int argc, char** argv)
+{
+    std::vector<std::string> paths;
+    double threshold = kDefaultThreshold;
+    bool print_all = false;
+    bool print_speedup = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg(argv[i]);
+        if (arg == "--threshold" && i + 1 < argc)
+        {
+            // The whole argument must be a number ("5%" or "abc" are rejected, not read as 5 or thrown).
+            const std::string value(argv[++i]);
+            std::size_t parsed = 0;
+            try
+            {
+                threshold = std::stod(value, &parsed);
+            }
+            catch (const std::invalid_argument&)
+            {
+                parsed = 0;
+            }
+            catch (const std::out_of_range&)
+            {
+                parsed = 0;
+            }
+            if (parsed == 0 || parsed != value.size())
+            {
+                std::cerr << "[ERROR] Invalid threshold: " << value << std::endl;
+                printUsage();
+                return 2;
+            }
+        }
+        else if (arg == "--all")
+            print_all = true;
+        else if (arg == "--speedup")
+            print_speedup = true;
+        else if (arg == "--help" || arg == "-h")
+        {
+            printUsage();
+            return 0;
+        }
+        else
+            paths.emplace_back(arg);
+    }
+    if (paths.size() != 2 || !(threshold >= 0.0))
+    {
+        printUsage();
+        return 2;
+    }
+
+    Run baseline;
+    Run current;
+    if (!loadRun(paths[0], baseline) || !loadRun(paths[1], current))
+        return 2;
+
+    printMachineDifferences(baseline, current);
+
+    int compared = 0;
+    int regressions = 0;
+    int improvements = 0;
+    std::map<std::string, Speedup> speedups;
+    printRow("", "change", "baseline", "current", "unit", "suite / section / name");
+    for (const auto& [key, now] : current.values)
+    {
+        const auto it = baseline.values.find(key);
+        if (it == baseline.values.end())
+        {
+            printRow("NEW", "", "", number(now.value, 3), now.unit, key);
+            continue;
+        }
+
+        const RunValue& before = it->second;
+        ++compared;
+        addSpeedup(speedups, before, now);
+
+        // Relative change, positive when the value grew. Undefined for a zero baseline.
+        const bool defined = before.value != 0.0;
+        const double change = defined ? 100.0 * (now.value - before.value) / std::fabs(before.value) : 0.0;
+        const double worse = now.better == "lower" ? change : (now.better == "higher" ? -change : 0.0);
+
+        const char* status = "    ";
+        if (defined && worse > threshold)
+        {
+            status = "REGRESSION";
+            ++regressions;
+        }
+        else if (defined && -worse > threshold)
+        {
+            status = "improved";
+            ++improvements;
+        }
+        else if (!print_all)
+            continue;
+
+        printRow(status, defined ? number(change, 1) + " %" : "n/a", number(before.value, 3), number(now.value, 3),
+                 now.unit, key);
+    }
+
+    for (const auto& [key, before] : baseline.values)
+    {
+        if (current.values.find(key) == current.values.end())
+            printRow("MISSING", "", number(before.value, 3), "", before.unit, key);
+    }
+
+    if (print_speedup)
+        printSpeedups(speedups);
+
+    std::cout << "[INFO] " << compared << " values compared, " << regressions << " regressions, " << improvements
+              << " improvements (threshold " << number(threshold, 1) << " %)." << std::endl;
+
+    return regressions > 0 ? 1 : 0;
+}
+
+// =====================================================================================================================
@@ -17,6 +17,7 @@
 #include <cstdlib>
 #include <memory>
 #include <string>
+#include <string_view>
 
 // BSON INCLUDES
 #include <bson/bson.h>
@@ -27,6 +28,9 @@
 // NLOHMANN JSON INCLUDES
 #include <nlohmann/json.hpp>
 
+// PROJECT INCLUDES
+#include "fmt_output.h"
+
 /** Custom deleter for bson_t */
 struct BsonDeleter 
 {
@@ -123,6 +127,9 @@ int main()
 
     mongoc_collection_t* mcol = mongoc_client_get_collection(client, "my_db", "my_collection");
 
+    // Console output buffered and flushed once per section, not per line (and before any error, to keep the order).
+    FmtOutput& out = stdoutBuffer();
+
     // Optional: clear the collection
 	// -----------------------------------------------------------------------------
 
@@ -144,13 +151,15 @@ int main()
 		
         if (!mongoc_collection_insert_one(mcol, doc.get(), nullptr, nullptr, &error)) 
 		{
+            out.flush();
             std::cerr << "Insert error: " << error.message << std::endl;
         } 
 		else 
 		{
-            std::cout << "Inserted document: " << i << std::endl;
+            out.print(FMT_COMPILE("Inserted document: {}\n"), i);
         }
     }
+    out.flush();
 
     // Insert one document using nlohmann::json -> bson_t conversion
 	// -----------------------------------------------------------------------------
@@ -169,11 +178,12 @@ int main()
 		bson_error_t error{};
 		if (!mongoc_collection_insert_one(mcol, b.get(), nullptr, nullptr, &error)) 
 		{
+			out.flush();
 			std::cerr << "Insert (jsonToBson) error: " << error.message << std::endl;
 		} 
 		else 
 		{
-			std::cout << "Inserted document via jsonToBson." << std::endl;
+			out.append("Inserted document via jsonToBson.\n");
 		}
 	}
 	
@@ -185,17 +195,20 @@ int main()
 		mongoc_collection_find_with_opts(mcol, query.get(), nullptr, nullptr);
 
 	const bson_t* result = nullptr;
-	std::cout << "Collection contents:" << std::endl;
+	out.append("Collection contents:\n");
 	while (mongoc_cursor_next(cursor, &result)) 
 	{
-		// 1) Canonical Extended JSON string
-		std::string ext = bsonToJsonStr(result);
-		std::cout << "[extended]" << std::endl << ext << std::endl;
+		// 1) Canonical Extended JSON string (written from the libbson buffer, no std::string copy)
+		std::size_t len = 0;
+		char* ext = bson_as_canonical_extended_json(result, &len);
+		out.print(FMT_COMPILE("[extended]\n{}\n"), std::string_view(ext ? ext : "", ext ? len : 0));
+		bson_free(ext);
 
 		// 2) nlohmann::json pretty
 		nlohmann::json j = bsonToJson(result);
-		std::cout << "[nlohmann] " << std::endl << j.dump(2) << std::endl;
+		out.print(FMT_COMPILE("[nlohmann] \n{}\n"), j.dump(2));
 	}
+	out.flush();
 
 	if (mongoc_cursor_error(cursor, nullptr)) 
 	{
@@ -32,6 +32,9 @@
 #include <mongocxx/uri.hpp>
 #include <mongocxx/exception/exception.hpp>
 
+// PROJECT INCLUDES
+#include "fmt_output.h"
+
 /**
  * @brief Convert a BSON CXX document/view to nlohmann::json via Extended JSON.
  * @param view BSON view.
@@ -90,6 +93,9 @@ int main()
     // Get DB and collection
 	// -----------------------------------------------------------------------------
 
+    // Console output buffered and flushed once per section, not per line (and before any error, to keep the order).
+    FmtOutput& out = stdoutBuffer();
+
     mongocxx::database db = client["my_db"];
     mongocxx::collection col = db["my_collection"];
 
@@ -101,17 +107,16 @@ int main()
         auto delres = col.delete_many({});               
         if (delres) 
 		{
-            std::cout << "[Info] Cleared collection (" 
-                      << delres->deleted_count()        
-                      << " documents deleted)" << std::endl;
+            out.print(FMT_COMPILE("[Info] Cleared collection ({} documents deleted)\n"), delres->deleted_count());
         } 
 		else 
 		{
-            std::cout << "[Warn] delete_many returned no result\n";
+            out.append("[Warn] delete_many returned no result\n");
         }
     } 
 	catch (const mongocxx::exception& ex) 
 	{
+        out.flush();
         std::cerr << "[Error] delete_many failed: " << ex.what() << std::endl;
     }
 
@@ -130,15 +135,17 @@ int main()
         {
             auto result = col.insert_one(doc.view());
             if (result)
-                std::cout << "[OK] Inserted document " << i << std::endl;
+                out.print(FMT_COMPILE("[OK] Inserted document {}\n"), i);
             else
-                std::cout << "[Warn] Insert operation returned no result (document " << i << ")" << std::endl;
+                out.print(FMT_COMPILE("[Warn] Insert operation returned no result (document {})\n"), i);
         }
         catch (const mongocxx::exception& ex)
         {
+            out.flush();
             std::cerr << "[Error] Insert failed (" << i << "): " << ex.what() << std::endl;
         }
     }
+    out.flush();
 
     // Insert one document using nlohmann::json
 	// -----------------------------------------------------------------------------
@@ -155,10 +162,11 @@ int main()
         bsoncxx::document::value bdoc = njsonToBsoncxx(jdoc);
         auto result = col.insert_one(bdoc.view());
         if (result)
-            std::cout << "[OK] Inserted JSON document 'Alice'" << std::endl;
+            out.append("[OK] Inserted JSON document 'Alice'\n");
     }
     catch (const mongocxx::exception& ex)
     {
+        out.flush();
         std::cerr << "[Error] Insert from JSON failed: " << ex.what() << std::endl;
     }
 
@@ -168,25 +176,26 @@ int main()
     try
     {
         mongocxx::cursor cursor = col.find({});
-        std::cout << "[Info] Collection contents:" << std::endl;
+        out.append("[Info] Collection contents:\n");
 
         for (const bsoncxx::document::view& doc : cursor)
         {
-            std::cout << "[Extended JSON]" << std::endl;
-            std::cout << bsoncxx::to_json(doc) << std::endl;
+            out.print(FMT_COMPILE("[Extended JSON]\n{}\n"), bsoncxx::to_json(doc));
 
             nlohmann::json j = bsoncxxToNjson(doc);
-            std::cout << "[nlohmann::json]" << std::endl << j.dump(2) << std::endl;
+            out.print(FMT_COMPILE("[nlohmann::json]\n{}\n"), j.dump(2));
         }
     }
     catch (const mongocxx::exception& ex)
     {
+        out.flush();
         std::cerr << "[Error] Query failed: " << ex.what() << std::endl;
     }
 
 	// -----------------------------------------------------------------------------
 
-    std::cout << "[Done] All operations completed successfully." << std::endl;
+    out.append("[Done] All operations completed successfully.\n");
+    out.flush();
 	
 	// All ok.
     return 0;
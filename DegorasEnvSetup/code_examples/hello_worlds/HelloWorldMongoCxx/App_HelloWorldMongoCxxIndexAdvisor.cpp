@@ -0,0 +1,328 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldMongoCxxIndexAdvisor – Profiles representative queries and proposes (and creates) compound indexes
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// BSONCXX INCLUDES
+#include <bsoncxx/builder/basic/array.hpp>
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/types.hpp>
+
+// MONGOCXX INCLUDES
+#include <mongocxx/client.hpp>
+#include <mongocxx/instance.hpp>
+#include <mongocxx/uri.hpp>
+
+// PROJECT INCLUDES
+#include "fmt_output.h"
+#include "index_advisor.h"
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_array;
+using bsoncxx::builder::basic::make_document;
+
+// Constant expresions.
+constexpr const char* kSampleDatabase = "degoras_bench";
+constexpr const char* kSampleCollection = "advisor_docs";
+constexpr std::int64_t kSampleDocuments = 200'000;   // Seeded when the sample collection has fewer.
+constexpr int kSeedBatch = 1'000;
+constexpr std::int64_t kFirstTsMs = 1'735'689'600'000;   // 2025-01-01, one document per second from here.
+
+/**
+ * @brief Date of the sample document `seq`.
+ */
+bsoncxx::types::b_date sampleDate(std::int64_t seq)
+{
+    return bsoncxx::types::b_date(std::chrono::milliseconds(kFirstTsMs + seq * 1000));
+}
+
+/**
+ * @brief Fill the sample collection with documents like the ones of the examples (table rows and log records).
+ */
+void seedSample(mongocxx::client& client)
+{
+    mongocxx::collection collection = client[kSampleDatabase][kSampleCollection];
+    const std::int64_t present = collection.estimated_document_count();
+    if (present >= kSampleDocuments)
+        return;
+
+    FmtOutput& out = stdoutBuffer();
+    out.print("[INFO] Seeding {}.{} with {} documents...\n", kSampleDatabase, kSampleCollection,
+              kSampleDocuments - present);
+    out.flush();
+
+    // Mostly info records, 1% errors, like a healthy log.
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> value(0.0, 1.0);
+    std::uniform_int_distribution<int> level(0, 99);
+    std::vector<bsoncxx::document::value> batch;
+    batch.reserve(kSeedBatch);
+    for (std::int64_t seq = present; seq < kSampleDocuments; ++seq)
+    {
+        const int roll = level(rng);
+        const char* name = roll == 0 ? "error" : roll < 5 ? "warning" : roll < 30 ? "debug" : "info";
+        batch.push_back(make_document(kvp("seq", seq),
+                                      kvp("value", value(rng)),
+                                      kvp("name", "row-" + std::to_string(seq)),
+                                      kvp("ts", sampleDate(seq)),
+                                      kvp("active", seq % 2 == 0),
+                                      kvp("meta", make_document(kvp("logger", "sample"), kvp("level", name)))));
+        if (static_cast<int>(batch.size()) == kSeedBatch || seq + 1 == kSampleDocuments)
+        {
+            collection.insert_many(batch);
+            batch.clear();
+        }
+    }
+}
+
+/**
+ * @brief Query shapes of the examples against the sample collection.
+ */
+std::vector<AdvisorQuery> sampleQueries()
+{
+    std::vector<AdvisorQuery> queries;
+    auto add = [&queries](std::string name, bsoncxx::document::value filter,
+                          std::optional<bsoncxx::document::value> sort, std::int64_t limit)
+    {
+        AdvisorQuery query;
+        query.name = std::move(name);
+        query.database = kSampleDatabase;
+        query.collection = kSampleCollection;
+        query.filter = std::move(filter);
+        query.sort = std::move(sort);
+        query.limit = limit;
+        queries.push_back(std::move(query));
+    };
+
+    // Page of the table sorted by a column (keyset on value and _id).
+    add("table page by value", make_document(kvp("value", make_document(kvp("$gt", 0.5)))),
+        make_document(kvp("value", 1), kvp("_id", 1)), 200);
+
+    // Newest rows of a flag, like a filtered table sorted by date.
+    add("active rows by date", make_document(kvp("active", true)), make_document(kvp("ts", -1)), 100);
+
+    // Log viewer: errors of one day, newest first.
+    add("errors of a day", make_document(kvp("meta.level", "error"),
+                                         kvp("ts", make_document(kvp("$gte", sampleDate(86'400)),
+                                                                 kvp("$lt", sampleDate(2 * 86'400))))),
+        make_document(kvp("ts", -1)), 0);
+
+    // Latest warnings and errors.
+    add("latest warnings", make_document(kvp("meta.level", make_document(kvp("$in", make_array("warning", "error"))))),
+        make_document(kvp("ts", -1)), 50);
+
+    // Lookup of one row.
+    add("row by name", make_document(kvp("name", "row-4242")), std::nullopt, 0);
+
+    // Range of sequence numbers, like the plot reloading a window.
+    add("sequence window", make_document(kvp("seq", make_document(kvp("$gte", 1'000), kvp("$lt", 2'000)))),
+        make_document(kvp("seq", 1)), 0);
+
+    return queries;
+}
+
+/**
+ * @brief Print the statistics of every query.
+ */
+void printStats(FmtOutput& out, const std::vector<AdvisorQuery>& queries, const std::vector<AdvisorStats>& stats)
+{
+    out.print("  {:<28} {:>9} {:>11} {:>11} {:>6}  {}\n", "query", "returned", "docs exam.", "keys exam.", "ms",
+              "plan");
+    for (std::size_t i = 0; i < queries.size(); ++i)
+    {
+        if (!stats[i].ok)
+        {
+            out.print("  {:<28} [ERROR] {}\n", queries[i].name, stats[i].error);
+            continue;
+        }
+        out.print("  {:<28} {:>9} {:>11} {:>11} {:>6}  {}{}\n", queries[i].name, stats[i].returned,
+                  stats[i].docs_examined, stats[i].keys_examined, stats[i].time_ms, stats[i].plan,
+                  IndexAdvisor::needsIndex(stats[i]) ? "  <- needs an index" : "");
+    }
+    out.flush();
+}
+
+/**
+ * @brief Print the statistics before and after creating the indexes.
+ */
+void printComparison(FmtOutput& out, const std::vector<AdvisorQuery>& queries,
+                     const std::vector<AdvisorStats>& before, const std::vector<AdvisorStats>& after)
+{
+    std::int64_t docs_before = 0;
+    std::int64_t docs_after = 0;
+    std::int64_t ms_before = 0;
+    std::int64_t ms_after = 0;
+    out.print("  {:<28} {:>21} {:>21} {:>13}  {}\n", "query", "docs examined", "keys examined", "ms", "plan after");
+    for (std::size_t i = 0; i < queries.size(); ++i)
+    {
+        if (!before[i].ok || !after[i].ok)
+        {
+            out.print("  {:<28} [ERROR] {}\n", queries[i].name, before[i].ok ? after[i].error : before[i].error);
+            continue;
+        }
+        out.print("  {:<28} {:>9} -> {:<8} {:>9} -> {:<8} {:>5} -> {:<5}  {}\n", queries[i].name,
+                  before[i].docs_examined, after[i].docs_examined, before[i].keys_examined, after[i].keys_examined,
+                  before[i].time_ms, after[i].time_ms, after[i].plan);
+        docs_before += before[i].docs_examined;
+        docs_after += after[i].docs_examined;
+        ms_before += before[i].time_ms;
+        ms_after += after[i].time_ms;
+    }
+    out.print("  {:<28} {:>9} -> {:<8} {:>21} {:>5} -> {:<5}\n", "total", docs_before, docs_after, "", ms_before,
+              ms_after);
+    out.flush();
+}
+
+/**
+ * @brief Print the command line help.
+ */
+void printUsage()
+{
+    std::cout << "Usage: App_HelloWorldMongoCxxIndexAdvisor [--uri <uri>] [--queries <file>] [--apply] [--reset]\n"
+                 "  --uri <uri>           Server (mongodb://localhost:27017 by default).\n"
+                 "  --queries <file>      JSON array of {\"name\", \"db\", \"collection\", \"filter\", \"sort\",\n"
+                 "                        \"limit\"}, filters and sorts in Extended JSON.\n"
+                 "                        Without it, sample queries run on a seeded degoras_bench.advisor_docs.\n"
+                 "  --apply               Create the proposed indexes and profile the queries again.\n"
+                 "  --reset               First drop the indexes created by a previous --apply (advisor_*)."
+              << std::endl;
+}
+
+/**
+ * @brief Main entry point of the App_HelloWorldMongoCxxIndexAdvisor application.
+ *
+ * Runs every query with explain("executionStats"), reports the plan and the examined keys and documents, and
+ * proposes a compound index (equality, sort, range) for the queries that scan the collection, sort in memory or
+ * examine too many documents. With --apply the indexes are created and the queries profiled again (before/after).
+ */
+int main(int argc, char** argv)
+{
+    std::string uri = "mongodb://localhost:27017";
+    std::string queries_path;
+    bool apply = false;
+    bool reset = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg(argv[i]);
+        if (arg == "--uri" && i + 1 < argc)
+            uri = argv[++i];
+        else if (arg == "--queries" && i + 1 < argc)
+            queries_path = argv[++i];
+        else if (arg == "--apply")
+            apply = true;
+        else if (arg == "--reset")
+            reset = true;
+        else
+        {
+            printUsage();
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+
+    // The driver instance must outlive every client.
+    mongocxx::instance instance{};
+    FmtOutput& out = stdoutBuffer();
+
+    try
+    {
+        mongocxx::client client{mongocxx::uri{uri}};
+        client["admin"].run_command(make_document(kvp("ping", 1)));
+
+        std::vector<AdvisorQuery> queries;
+        if (queries_path.empty())
+        {
+            seedSample(client);
+            queries = sampleQueries();
+        }
+        else
+            queries = IndexAdvisor::loadQueries(queries_path);
+
+        IndexAdvisor advisor(client);
+        if (reset)
+        {
+            std::set<std::pair<std::string, std::string>> collections;
+            for (const AdvisorQuery& query : queries)
+                collections.emplace(query.database, query.collection);
+            for (const auto& [database, collection] : collections)
+            {
+                const int dropped = advisor.dropAdvisedIndexes(database, collection);
+                if (dropped > 0)
+                    out.print("[INFO] Dropped {} advised indexes of {}.{}\n", dropped, database, collection);
+            }
+        }
+
+        // Before.
+        std::vector<AdvisorStats> before;
+        for (const AdvisorQuery& query : queries)
+            before.push_back(advisor.explain(query));
+        out.print("[Profile] {} queries against {}\n", queries.size(), uri);
+        printStats(out, queries, before);
+
+        // Proposals.
+        const std::vector<AdvisorIndex> indexes = advisor.advise(queries, before);
+        out.print("[Advice] {} indexes proposed\n", indexes.size());
+        for (const AdvisorIndex& index : indexes)
+        {
+            std::string served;
+            for (const std::string& name : index.queries)
+                served += (served.empty() ? "" : ", ") + name;
+            out.print("  {} on {}.{} for: {}\n    {}\n", index.name, index.database, index.collection, served,
+                      IndexAdvisor::shellCommand(index));
+        }
+        out.flush();
+
+        if (!apply || indexes.empty())
+        {
+            if (!indexes.empty())
+                out.print("[INFO] Run again with --apply to create them and measure the queries again.\n");
+            out.flush();
+            return 0;
+        }
+
+        // After.
+        int created = 0;
+        for (const AdvisorIndex& index : indexes)
+            created += advisor.createIndex(index) ? 1 : 0;
+        out.print("[Apply] {} of {} indexes created\n", created, indexes.size());
+
+        std::vector<AdvisorStats> after;
+        for (const AdvisorQuery& query : queries)
+            after.push_back(advisor.explain(query));
+        out.print("[Before/After]\n");
+        printComparison(out, queries, before, after);
+        out.print("[INFO] --reset drops the advisor_* indexes.\n");
+        out.flush();
+        return created == static_cast<int>(indexes.size()) ? 0 : 1;
+    }
+    catch (const std::exception& e)
+    {
+        out.flush();
+        std::cerr << "[ERROR] " << e.what() << std::endl;
+        return 1;
+    }
+}
+
+// =====================================================================================================================
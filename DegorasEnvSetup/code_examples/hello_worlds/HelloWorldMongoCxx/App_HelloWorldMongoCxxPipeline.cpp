@@ -0,0 +1,276 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldMongoCxxPipeline – Acquisition, calibration, MongoDB persistence and GUI feed over inproc ZeroMQ
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+
+// BSONCXX INCLUDES
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/types.hpp>
+
+// MONGOCXX INCLUDES
+#include <mongocxx/instance.hpp>
+
+// ZMQ INCLUDES
+#include <zmq.hpp>
+
+// PROJECT INCLUDES
+#include "fmt_output.h"
+#include "zmq_pipeline.h"
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_document;
+
+// Constant expresions.
+constexpr double kCalibrationGain = 1.0025;
+constexpr double kCalibrationOffset = -0.0125;
+constexpr double kOutlierLimit = 0.98;   // Calibrated values above it (in absolute value) are flagged.
+
+/**
+ * @brief Options of the application (taken from the command line).
+ */
+struct PipelineAppOptions
+{
+    ZmqPipelineConfig config;
+    std::uint64_t count = 1'000'000;   ///< Documents per producer.
+};
+
+/**
+ * @brief Sample `index` of the station `producer`, like the acquisition feeds of the examples.
+ */
+std::optional<bsoncxx::document::value> acquire(int producer, std::uint64_t index, std::uint64_t count)
+{
+    if (index >= count)
+        return std::nullopt;
+
+    const auto seq = static_cast<std::int64_t>(index);
+    return make_document(kvp("seq", seq),
+                         kvp("station", producer),
+                         kvp("ts", bsoncxx::types::b_date(std::chrono::milliseconds(1'735'689'600'000 + seq))),
+                         kvp("raw", std::sin(0.001 * static_cast<double>(seq) + producer)));
+}
+
+/**
+ * @brief Calibrated copy of an acquired sample, flagged when it is out of range.
+ */
+bsoncxx::document::value calibrate(const bsoncxx::document::view& sample)
+{
+    const double value = sample["raw"].get_double().value * kCalibrationGain + kCalibrationOffset;
+    return make_document(kvp("seq", sample["seq"].get_int64().value),
+                         kvp("station", sample["station"].get_int32().value),
+                         kvp("ts", sample["ts"].get_date()),
+                         kvp("raw", sample["raw"].get_double().value),
+                         kvp("value", value),
+                         kvp("outlier", std::abs(value) > kOutlierLimit));
+}
+
+/**
+ * @brief Print the counters of every stage.
+ */
+void printMetrics(FmtOutput& out, const ZmqPipeline& pipeline)
+{
+    out.print("  {:<10} {:>7} {:>11} {:>11} {:>9} {:>7} {:>8} {:>12} {:>8} {:>10}\n", "stage", "workers", "received",
+              "sent", "dropped", "errors", "queued", "docs/s", "busy ms", "blocked ms");
+    for (std::size_t s = 0; s < kPipelineStages; ++s)
+    {
+        const PipelineStageMetrics m = pipeline.metrics(static_cast<PipelineStage>(s));
+        out.print("  {:<10} {:>7} {:>11} {:>11} {:>9} {:>7} {:>8} {:>12.0f} {:>8} {:>10}\n",
+                  ZmqPipeline::stageName(m.stage), m.workers, m.received, m.sent, m.dropped, m.errors, m.queued,
+                  m.throughput, m.busy_ns / 1'000'000, m.blocked_ns / 1'000'000);
+    }
+    out.flush();
+}
+
+/**
+ * @brief Print the command line help.
+ */
+void printUsage()
+{
+    std::cout << "Usage: App_HelloWorldMongoCxxPipeline [--uri <uri>] [--count <n>] [--producers <n>]\n"
+                 "                                      [--transformers <n>] [--persisters <n>] [--publishers <n>]\n"
+                 "                                      [--hwm <n>] [--batch <n>] [--publish <endpoint>]\n"
+                 "  --uri <uri>           Server of the persist stage (degoras.pipeline_samples), none by default:\n"
+                 "                        the documents go through the stage without being written.\n"
+                 "  --count <n>           Samples per producer (1000000 by default).\n"
+                 "  --producers <n>       Workers of each stage (1 by default).\n"
+                 "  --transformers <n>\n"
+                 "  --persisters <n>\n"
+                 "  --publishers <n>\n"
+                 "  --hwm <n>             High-water mark of the stage sockets (1000 by default).\n"
+                 "  --batch <n>           Documents per insert_many at most (256 by default).\n"
+                 "  --publish <endpoint>  GUI endpoint (inproc://degoras-pipeline-gui by default). A tcp:// one\n"
+                 "                        can be bound by a GUI in another process."
+              << std::endl;
+}
+
+/**
+ * @brief Parse the command line. False on an unknown option.
+ */
+bool parseOptions(int argc, char** argv, PipelineAppOptions& options)
+{
+    ZmqPipelineConfig& config = options.config;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg(argv[i]);
+        if (i + 1 >= argc)
+            return false;
+        const std::string value = argv[++i];
+        if (arg == "--uri")
+            config.mongo_uri = value;
+        else if (arg == "--count")
+            options.count = std::stoull(value);
+        else if (arg == "--producers")
+            config.workers[static_cast<std::size_t>(PipelineStage::Produce)] = std::stoi(value);
+        else if (arg == "--transformers")
+            config.workers[static_cast<std::size_t>(PipelineStage::Transform)] = std::stoi(value);
+        else if (arg == "--persisters")
+            config.workers[static_cast<std::size_t>(PipelineStage::Persist)] = std::stoi(value);
+        else if (arg == "--publishers")
+            config.workers[static_cast<std::size_t>(PipelineStage::Publish)] = std::stoi(value);
+        else if (arg == "--hwm")
+            config.hwm = std::stoi(value);
+        else if (arg == "--batch")
+            config.persist_batch = std::stoul(value);
+        else if (arg == "--publish")
+            config.publish_endpoint = value;
+        else
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Main entry point of the App_HelloWorldMongoCxxPipeline application.
+ *
+ * Producers create synthetic acquisition samples, transformers calibrate them, persisters write them to MongoDB in
+ * batches and publishers hand them to the GUI. The GUI is played by a SUB socket bound on the publish endpoint, the
+ * one a Qt/Qwt view of the same process would own. The stage counters are printed every second.
+ */
+int main(int argc, char** argv)
+{
+    PipelineAppOptions options;
+    try
+    {
+        if (!parseOptions(argc, argv, options))
+        {
+            printUsage();
+            return argc > 1 && (std::string_view(argv[1]) == "--help" || std::string_view(argv[1]) == "-h") ? 0 : 1;
+        }
+    }
+    catch (const std::exception&)
+    {
+        printUsage();
+        return 1;
+    }
+
+    // The driver instance must outlive every client.
+    mongocxx::instance instance{};
+    FmtOutput& out = stdoutBuffer();
+
+    try
+    {
+        // The GUI side binds first, so no early document is lost on the PUB socket.
+        options.config.context = std::make_shared<zmq::context_t>(1);
+        zmq::socket_t gui(*options.config.context, zmq::socket_type::sub);
+        gui.set(zmq::sockopt::rcvhwm, options.config.hwm);
+        gui.set(zmq::sockopt::rcvtimeo, static_cast<int>(ZmqPipeline::kPollPeriod.count()));
+        gui.set(zmq::sockopt::linger, 0);
+        gui.set(zmq::sockopt::subscribe, "");
+        gui.bind(options.config.publish_endpoint);
+
+        std::atomic_bool gui_stop{false};
+        std::atomic<std::uint64_t> gui_received{0};
+        std::atomic<std::uint64_t> gui_outliers{0};
+        std::thread gui_thread([&gui, &gui_stop, &gui_received, &gui_outliers]
+        {
+            zmq::message_t header;
+            zmq::message_t document;
+            while (!gui_stop.load())
+            {
+                if (!gui.recv(header, zmq::recv_flags::none) || !header.more()
+                    || !gui.recv(document, zmq::recv_flags::none))
+                    continue;
+
+                PipelineHeader info{};
+                bsoncxx::document::view sample;
+                if (!ZmqPipeline::decode(header, document, info, sample))
+                    continue;
+                gui_received.fetch_add(1, std::memory_order_relaxed);
+                if (sample["outlier"].get_bool().value)
+                    gui_outliers.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+
+        const std::uint64_t count = options.count;
+        ZmqPipeline pipeline(options.config,
+                             [count](int producer, std::uint64_t index) { return acquire(producer, index, count); },
+                             &calibrate);
+
+        out.print("[Pipeline] {} samples x {} producers, persist to {}, publish on {}\n", count,
+                  options.config.workers[0],
+                  options.config.mongo_uri.empty() ? std::string("nowhere (no --uri)") : options.config.mongo_uri,
+                  options.config.publish_endpoint);
+        out.flush();
+
+        pipeline.start();
+        // A failed worker (bad URI, socket error) never lets the pipeline drain. Write errors are only counted.
+        while (!pipeline.wait(std::chrono::seconds(1)) && pipeline.lastError().empty())
+        {
+            printMetrics(out, pipeline);
+            out.print("  gui received {}, {} outliers\n", gui_received.load(), gui_outliers.load());
+            out.flush();
+        }
+        pipeline.stop();
+
+        // Let the GUI drain its queue before stopping it.
+        std::this_thread::sleep_for(ZmqPipeline::kPollPeriod);
+        gui_stop.store(true);
+        gui_thread.join();
+
+        const LatencyHistogram& latency = pipeline.latency();
+        out.print("[Result]\n");
+        printMetrics(out, pipeline);
+        out.print("  gui received {}, {} outliers\n", gui_received.load(), gui_outliers.load());
+        out.print("  production to GUI latency: p50 {:.1f} us, p99 {:.1f} us, max {:.1f} us\n",
+                  latency.percentileNs(0.50) / 1e3, latency.percentileNs(0.99) / 1e3, latency.maxNs() / 1e3);
+        out.flush();
+
+        const std::string error = pipeline.lastError();
+        if (!error.empty())
+        {
+            std::cerr << "[ERROR] " << error << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        out.flush();
+        std::cerr << "[ERROR] " << e.what() << std::endl;
+        return 1;
+    }
+}
+
+// =====================================================================================================================
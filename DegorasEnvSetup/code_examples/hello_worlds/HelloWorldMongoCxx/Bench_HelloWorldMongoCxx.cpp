@@ -0,0 +1,411 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   BenchHelloWorldMongoCxx – BSON encoding costs, round trips against a MongoDB server and the ZeroMQ pipeline
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// BSONCXX INCLUDES
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/json.hpp>
+#include <bsoncxx/types.hpp>
+
+// MONGOCXX INCLUDES
+#include <mongocxx/client.hpp>
+#include <mongocxx/exception/exception.hpp>
+#include <mongocxx/instance.hpp>
+#include <mongocxx/options/insert.hpp>
+#include <mongocxx/uri.hpp>
+
+// ZMQ INCLUDES
+#include <zmq.hpp>
+
+// PROJECT INCLUDES
+#include "bench_report.h"
+#include "zmq_pipeline.h"
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_document;
+
+// Constant expresions.
+constexpr std::size_t kIterations = 200'000;   // Encoding micro benchmarks.
+constexpr int kRoundTrips = 2'000;             // insert_one / find_one latency samples.
+constexpr int kBulkDocuments = 100'000;        // Documents of the insert_many and scan runs.
+constexpr int kBulkBatch = 1'000;              // Documents per insert_many.
+constexpr std::uint64_t kPipelineDocuments = 200'000;   // Documents of each ZeroMQ pipeline run (all producers).
+
+/**
+ * @brief Options of the server benchmarks (taken from the command line).
+ */
+struct ServerBenchOptions
+{
+    std::string uri;                          ///< Server URI, empty to skip the server benchmarks.
+    std::string database = "degoras_bench";
+    std::string collection = "bench_docs";    ///< Dropped before and after the run.
+};
+
+/**
+ * @brief Run `fn` `iterations` times and return the mean cost per call in nanoseconds.
+ */
+template <typename F>
+double measureNs(std::size_t iterations, F&& fn)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+        fn(i);
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(iterations);
+}
+
+/**
+ * @brief Print one benchmark result line.
+ */
+void printResult(std::string_view name, double value, std::string_view unit)
+{
+    BenchReport::instance().add(std::string(name), value, std::string(unit));
+    std::cout << "  " << std::left << std::setw(52) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(3) << value
+              << " " << unit << '\n';
+}
+
+/**
+ * @brief Print p50, p99 and max of a latency set (in microseconds).
+ */
+void printLatencies(const std::string& label, std::vector<double> latencies_us)
+{
+    if (latencies_us.empty())
+        return;
+
+    std::sort(latencies_us.begin(), latencies_us.end());
+    printResult(label + "p50", latencies_us[latencies_us.size() / 2], "us");
+    printResult(label + "p99", latencies_us[std::min(latencies_us.size() - 1, latencies_us.size() * 99 / 100)], "us");
+    printResult(label + "max", latencies_us.back(), "us");
+}
+
+/**
+ * @brief Document like the ones stored by the examples (sequence, value, name, timestamp, flags).
+ */
+bsoncxx::document::value makeDocument(std::int64_t seq)
+{
+    return make_document(kvp("seq", seq),
+                         kvp("value", static_cast<double>(seq % 1000) * 0.001),
+                         kvp("name", "row-" + std::to_string(seq)),
+                         kvp("ts", bsoncxx::types::b_date(std::chrono::milliseconds(1'735'689'600'000 + seq))),
+                         kvp("active", seq % 2 == 0));
+}
+
+/**
+ * @brief Client-side BSON costs (no server needed).
+ */
+void benchEncoding()
+{
+    BenchReport::instance().beginSection("BSON encoding");
+    std::cout << "[BSON encoding] " << kIterations << " documents of 5 fields" << std::endl;
+
+    std::size_t sink = 0;
+    printResult("build document", measureNs(kIterations, [&sink](std::size_t i)
+    {
+        sink += makeDocument(static_cast<std::int64_t>(i)).view().length();
+    }), "ns/doc");
+
+    const bsoncxx::document::value document = makeDocument(123456);
+    printResult("field lookup (view[\"name\"])", measureNs(kIterations, [&](std::size_t)
+    {
+        sink += document.view()["name"].get_string().value.size();
+    }), "ns/op");
+
+    printResult("to_json (relaxed Extended JSON)", measureNs(kIterations, [&](std::size_t)
+    {
+        sink += bsoncxx::to_json(document.view()).size();
+    }), "ns/doc");
+
+    const std::string json = bsoncxx::to_json(document.view());
+    printResult("from_json", measureNs(kIterations, [&](std::size_t)
+    {
+        sink += bsoncxx::from_json(json).view().length();
+    }), "ns/doc");
+
+    // Keeps the loops from being optimized away.
+    if (sink == 0)
+        std::cout << "  (empty documents)" << std::endl;
+}
+
+/**
+ * @brief insert_one / find_one latency, insert_many and cursor scan throughput against a server.
+ * @return False if the server cannot be used.
+ */
+bool benchServer(const ServerBenchOptions& options)
+{
+    if (options.uri.empty())
+    {
+        std::cout << "[MongoDB round trips] skipped (--mongo <uri> to run it)" << std::endl;
+        return true;
+    }
+
+    BenchReport::instance().beginSection("MongoDB round trips");
+    std::cout << "[MongoDB round trips] " << options.database << "." << options.collection << " on "
+              << options.uri << std::endl;
+
+    try
+    {
+        mongocxx::client client{mongocxx::uri{options.uri}};
+        mongocxx::collection collection = client[options.database][options.collection];
+        collection.drop();
+
+        std::vector<double> latencies_us;
+        latencies_us.reserve(kRoundTrips);
+        for (int i = 0; i < kRoundTrips; ++i)
+        {
+            const bsoncxx::document::value document = makeDocument(i);
+            const auto start = std::chrono::steady_clock::now();
+            collection.insert_one(document.view());
+            latencies_us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now()
+                                                                             - start).count());
+        }
+        printLatencies("insert_one ", latencies_us);
+
+        latencies_us.clear();
+        for (int i = 0; i < kRoundTrips; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            const auto found = collection.find_one(make_document(kvp("seq", static_cast<std::int64_t>(i))));
+            latencies_us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now()
+                                                                             - start).count());
+            if (!found)
+                std::cerr << "[ERROR] Document " << i << " not found." << std::endl;
+        }
+        printLatencies("find_one (no index) ", latencies_us);
+
+        collection.drop();
+        mongocxx::options::insert insert_options;
+        insert_options.ordered(false);
+        std::vector<bsoncxx::document::value> batch;
+        batch.reserve(kBulkBatch);
+        auto start = std::chrono::steady_clock::now();
+        for (int seq = 0; seq < kBulkDocuments; ++seq)
+        {
+            batch.push_back(makeDocument(seq));
+            if (static_cast<int>(batch.size()) == kBulkBatch || seq + 1 == kBulkDocuments)
+            {
+                collection.insert_many(batch, insert_options);
+                batch.clear();
+            }
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        printResult("insert_many (" + std::to_string(kBulkBatch) + " per batch)", kBulkDocuments / seconds,
+                    "docs/s");
+
+        std::int64_t scanned = 0;
+        start = std::chrono::steady_clock::now();
+        for (const bsoncxx::document::view document : collection.find({}))
+            scanned += document["seq"].get_int64().value >= 0;
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        printResult("cursor scan", scanned / seconds, "docs/s");
+
+        collection.drop();
+    }
+    catch (const mongocxx::exception& e)
+    {
+        std::cerr << "[ERROR] MongoDB benchmark failed: " << e.what() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Run the ZeroMQ pipeline once with `workers` per stage, with a GUI subscriber draining the publish stage.
+ * @return False if a worker failed or the documents did not leave the pipeline.
+ */
+bool runPipeline(const ServerBenchOptions& options, const std::array<int, kPipelineStages>& workers, int run)
+{
+    ZmqPipelineConfig config;
+    config.workers = workers;
+    config.mongo_uri = options.uri;
+    config.database = options.database;
+    config.collection = options.collection;
+    config.publish_endpoint = "inproc://degoras-bench-gui-" + std::to_string(run);
+    config.context = std::make_shared<zmq::context_t>(1);
+
+    zmq::socket_t gui(*config.context, zmq::socket_type::sub);
+    gui.set(zmq::sockopt::rcvtimeo, static_cast<int>(ZmqPipeline::kPollPeriod.count()));
+    gui.set(zmq::sockopt::linger, 0);
+    gui.set(zmq::sockopt::subscribe, "");
+    gui.bind(config.publish_endpoint);
+    std::atomic_bool gui_stop{false};
+    std::thread gui_thread([&gui, &gui_stop]
+    {
+        zmq::message_t frame;
+        while (!gui_stop.load())
+            static_cast<void>(gui.recv(frame, zmq::recv_flags::none));
+    });
+
+    // The documents are split among the producers, each one with its own sequence range.
+    const std::uint64_t producers = static_cast<std::uint64_t>(workers[0]);
+    auto source = [producers](int producer, std::uint64_t index) -> std::optional<bsoncxx::document::value>
+    {
+        const std::uint64_t seq = index * producers + static_cast<std::uint64_t>(producer);
+        if (seq >= kPipelineDocuments)
+            return std::nullopt;
+        return makeDocument(static_cast<std::int64_t>(seq));
+    };
+    auto transform = [](const bsoncxx::document::view& document)
+    {
+        return make_document(kvp("seq", document["seq"].get_int64().value),
+                             kvp("value", document["value"].get_double().value * 1.0025 - 0.0125),
+                             kvp("ts", document["ts"].get_date()),
+                             kvp("active", document["active"].get_bool().value));
+    };
+
+    ZmqPipeline pipeline(config, source, transform);
+    const auto start = std::chrono::steady_clock::now();
+    pipeline.start();
+    const bool done = pipeline.wait(std::chrono::minutes(5));   // Returns at once if a worker fails.
+    const double elapsed_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now()
+                                                                         - start).count();
+    pipeline.stop();
+    gui_stop.store(true);
+    gui_thread.join();
+
+    const std::string error = pipeline.lastError();
+    if (!done || !error.empty())
+    {
+        std::cerr << "[ERROR] ZeroMQ pipeline run failed: " << (error.empty() ? "timeout" : error) << std::endl;
+        return false;
+    }
+
+    std::string label;
+    for (std::size_t s = 0; s < kPipelineStages; ++s)
+        label += (s == 0 ? "" : "/") + std::to_string(workers[s]);
+    label += " ";
+
+    const LatencyHistogram& latency = pipeline.latency();
+    printResult(label + "throughput", kPipelineDocuments * 1e9 / elapsed_ns, "docs/s");
+    printResult(label + "e2e p50", latency.percentileNs(0.50) / 1e3, "us");
+    printResult(label + "e2e p99", latency.percentileNs(0.99) / 1e3, "us");
+
+    // Share of the stage threads time spent working and waiting at the high-water mark of the next stage: the stage
+    // that works most and never waits is the bottleneck.
+    for (std::size_t s = 0; s < kPipelineStages; ++s)
+    {
+        const PipelineStageMetrics metrics = pipeline.metrics(static_cast<PipelineStage>(s));
+        const double thread_ns = elapsed_ns * metrics.workers;
+        printResult(label + ZmqPipeline::stageName(metrics.stage) + " busy", 100.0 * metrics.busy_ns / thread_ns,
+                    "%");
+        if (s + 1 < kPipelineStages)
+            printResult(label + ZmqPipeline::stageName(metrics.stage) + " blocked",
+                        100.0 * metrics.blocked_ns / thread_ns, "%");
+    }
+    return true;
+}
+
+/**
+ * @brief Throughput, latency and bottleneck of the ZeroMQ pipeline, scaling the workers of each stage independently.
+ * @return False if a run failed.
+ *
+ * Labels are the workers of produce/transform/persist/publish. Without --mongo the persist stage forwards the
+ * documents without writing them.
+ */
+bool benchPipeline(const ServerBenchOptions& options)
+{
+    BenchReport::instance().beginSection("ZeroMQ pipeline");
+    std::cout << "[ZeroMQ pipeline] " << kPipelineDocuments << " documents, persist "
+              << (options.uri.empty() ? std::string("dry (--mongo <uri> to write)")
+                                      : options.database + "." + options.collection + " on " + options.uri)
+              << std::endl;
+
+    std::vector<std::array<int, kPipelineStages>> runs{{1, 1, 1, 1}};
+    for (std::size_t s = 0; s < kPipelineStages; ++s)
+    {
+        for (int workers : {2, 4})
+        {
+            std::array<int, kPipelineStages> scaled{1, 1, 1, 1};
+            scaled[s] = workers;
+            runs.push_back(scaled);
+        }
+    }
+
+    bool ok = true;
+    try
+    {
+        std::unique_ptr<mongocxx::client> client;
+        if (!options.uri.empty())
+            client = std::make_unique<mongocxx::client>(mongocxx::uri{options.uri});
+
+        for (std::size_t r = 0; r < runs.size() && ok; ++r)
+        {
+            if (client)
+                (*client)[options.database][options.collection].drop();
+            ok = runPipeline(options, runs[r], static_cast<int>(r));
+        }
+
+        if (client)
+            (*client)[options.database][options.collection].drop();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "[ERROR] ZeroMQ pipeline benchmark failed: " << e.what() << std::endl;
+        return false;
+    }
+    return ok;
+}
+
+/**
+ * @brief Main entry point of the Bench_HelloWorldMongoCxx application.
+ */
+int main(int argc, char** argv)
+{
+    std::cout << "====================================" << std::endl;
+    std::cout << "= HELLO WORLD MONGOCXX BENCHMARKS  =" << std::endl;
+    std::cout << "====================================" << std::endl;
+
+    ServerBenchOptions server_options;
+    std::string json_path;
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        const std::string_view arg(argv[i]);
+        if (arg == "--mongo")
+            server_options.uri = argv[++i];
+        else if (arg == "--json")
+            json_path = argv[++i];
+    }
+    BenchReport::instance().setSuite("HelloWorldMongoCxx");
+
+    // The driver instance must outlive every client.
+    mongocxx::instance instance{};
+
+    benchEncoding();
+    const bool server_ok = benchServer(server_options);
+    const bool pipeline_ok = benchPipeline(server_options);
+
+    if (!json_path.empty() && !BenchReport::instance().writeJson(json_path))
+        return 1;
+
+    // All ok.
+    return server_ok && pipeline_ok ? 0 : 1;
+}
+
+// =====================================================================================================================
@@ -0,0 +1,449 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+// BSONCXX INCLUDES
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/json.hpp>
+#include <bsoncxx/types.hpp>
+
+// MONGOCXX INCLUDES
+#include <mongocxx/collection.hpp>
+#include <mongocxx/cursor.hpp>
+#include <mongocxx/database.hpp>
+#include <mongocxx/index_view.hpp>
+
+// PROJECT INCLUDES
+#include "index_advisor.h"
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_document;
+
+namespace
+{
+
+/**
+ * @brief Owned copy of a BSON string view.
+ */
+template <typename S>
+std::string toString(const S& text)
+{
+    return std::string(text.data(), text.size());
+}
+
+/**
+ * @brief Integer value of a numeric element (the server replies int32, int64 or double). False if not a number.
+ */
+bool toInt64(const bsoncxx::document::element& element, std::int64_t& value)
+{
+    if (!element)
+        return false;
+
+    switch (element.type())
+    {
+    case bsoncxx::type::k_int32:
+        value = element.get_int32().value;
+        return true;
+    case bsoncxx::type::k_int64:
+        value = element.get_int64().value;
+        return true;
+    case bsoncxx::type::k_double:
+        value = static_cast<std::int64_t>(element.get_double().value);
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Append the stages of a plan, top down, and flag the collection scans and blocking sorts.
+ */
+void walkPlan(const bsoncxx::document::view& stage, std::vector<std::string>& stages, AdvisorStats& stats)
+{
+    const bsoncxx::document::element name = stage["stage"];
+    if (name && name.type() == bsoncxx::type::k_string)
+    {
+        std::string label = toString(name.get_string().value);
+        const bsoncxx::document::element index = stage["indexName"];
+        if (label == "COLLSCAN")
+            stats.collscan = true;
+        else if (label == "SORT")
+            stats.blocking_sort = true;
+        else if (label == "IXSCAN" && index && index.type() == bsoncxx::type::k_string)
+            label += " " + toString(index.get_string().value);
+        stages.push_back(std::move(label));
+    }
+
+    const bsoncxx::document::element input = stage["inputStage"];
+    if (input && input.type() == bsoncxx::type::k_document)
+        walkPlan(input.get_document().value, stages, stats);
+
+    const bsoncxx::document::element inputs = stage["inputStages"];
+    if (inputs && inputs.type() == bsoncxx::type::k_array)
+        for (const bsoncxx::array::element& child : inputs.get_array().value)
+            if (child.type() == bsoncxx::type::k_document)
+                walkPlan(child.get_document().value, stages, stats);
+}
+
+/**
+ * @brief Fields of a filter by kind of comparison.
+ */
+struct FilterFields
+{
+    std::vector<std::string> equality;
+    std::vector<std::string> range;
+    bool supported = true;
+};
+
+/**
+ * @brief Classify the fields of a filter. $eq, $in and plain values are equalities, any other operator is a range.
+ */
+void collectFilter(const bsoncxx::document::view& filter, FilterFields& fields)
+{
+    for (const bsoncxx::document::element& element : filter)
+    {
+        const std::string key = toString(element.key());
+        if (!key.empty() && key.front() == '$')
+        {
+            // Only a conjunction keeps a single index usable.
+            if (key == "$and" && element.type() == bsoncxx::type::k_array)
+            {
+                for (const bsoncxx::array::element& clause : element.get_array().value)
+                {
+                    if (clause.type() == bsoncxx::type::k_document)
+                        collectFilter(clause.get_document().value, fields);
+                    else
+                        fields.supported = false;
+                }
+            }
+            else
+                fields.supported = false;
+            continue;
+        }
+
+        bool equality = true;
+        if (element.type() == bsoncxx::type::k_document)
+        {
+            const bsoncxx::document::view operators = element.get_document().value;
+            if (!operators.empty() && operators.begin()->key().substr(0, 1) == "$")
+            {
+                for (const bsoncxx::document::element& op : operators)
+                {
+                    const std::string name = toString(op.key());
+                    equality = equality && (name == "$eq" || name == "$in");
+                }
+            }
+        }
+        (equality ? fields.equality : fields.range).push_back(key);
+    }
+}
+
+/**
+ * @brief Default name of an index key, as the server builds it (e.g. value_1__id_1).
+ */
+std::string defaultIndexName(const bsoncxx::document::view& key)
+{
+    std::string name;
+    for (const bsoncxx::document::element& field : key)
+    {
+        std::int64_t direction = 1;
+        toInt64(field, direction);
+        if (!name.empty())
+            name += '_';
+        name += toString(field.key()) + "_" + std::to_string(direction);
+    }
+    return name;
+}
+
+} // namespace
+
+// =====================================================================================================================
+
+IndexAdvisor::IndexAdvisor(mongocxx::client& client) :
+    client_(client)
+{}
+
+AdvisorStats IndexAdvisor::explain(const AdvisorQuery& query)
+{
+    AdvisorStats stats;
+
+    bsoncxx::builder::basic::document find;
+    find.append(kvp("find", query.collection), kvp("filter", query.filter.view()));
+    if (query.sort)
+        find.append(kvp("sort", query.sort->view()));
+    if (query.limit > 0)
+        find.append(kvp("limit", query.limit));
+
+    try
+    {
+        const bsoncxx::document::value reply = this->client_[query.database].run_command(
+            make_document(kvp("explain", find.view()), kvp("verbosity", "executionStats")));
+        const bsoncxx::document::view view = reply.view();
+
+        // The slot based engine (server 7.0+) nests the classic plan in "queryPlan".
+        bsoncxx::document::view plan = view["queryPlanner"]["winningPlan"].get_document().value;
+        if (plan["queryPlan"] && plan["queryPlan"].type() == bsoncxx::type::k_document)
+            plan = plan["queryPlan"].get_document().value;
+
+        std::vector<std::string> stages;
+        walkPlan(plan, stages, stats);
+        for (const std::string& stage : stages)
+            stats.plan += (stats.plan.empty() ? "" : " > ") + stage;
+
+        const bsoncxx::document::view execution = view["executionStats"].get_document().value;
+        toInt64(execution["nReturned"], stats.returned);
+        toInt64(execution["totalDocsExamined"], stats.docs_examined);
+        toInt64(execution["totalKeysExamined"], stats.keys_examined);
+        toInt64(execution["executionTimeMillis"], stats.time_ms);
+        stats.ok = true;
+    }
+    catch (const std::exception& e)
+    {
+        stats.error = e.what();
+    }
+    return stats;
+}
+
+bool IndexAdvisor::needsIndex(const AdvisorStats& stats)
+{
+    if (!stats.ok)
+        return false;
+    if (stats.collscan || stats.blocking_sort)
+        return true;
+    return stats.docs_examined >= kMinExamined
+           && stats.docs_examined > kMaxExaminedRatio * std::max<std::int64_t>(stats.returned, 1);
+}
+
+std::optional<bsoncxx::document::value> IndexAdvisor::suggestKey(const AdvisorQuery& query)
+{
+    FilterFields fields;
+    collectFilter(query.filter.view(), fields);
+    if (!fields.supported)
+        return std::nullopt;
+
+    // Equality, then sort, then range. A field is used once, at its first place.
+    bsoncxx::builder::basic::document key;
+    std::vector<std::string> used;
+    auto append = [&key, &used](const std::string& field, std::int32_t direction)
+    {
+        if (std::find(used.begin(), used.end(), field) != used.end())
+            return;
+        key.append(kvp(field, direction));
+        used.push_back(field);
+    };
+
+    for (const std::string& field : fields.equality)
+        append(field, 1);
+    if (query.sort)
+    {
+        for (const bsoncxx::document::element& field : query.sort->view())
+        {
+            // Text score and other non numeric sorts cannot be served by the key.
+            std::int64_t direction = 0;
+            if (!toInt64(field, direction) || direction == 0)
+                return std::nullopt;
+            append(toString(field.key()), direction > 0 ? 1 : -1);
+        }
+    }
+    for (const std::string& field : fields.range)
+        append(field, 1);
+
+    // The _id index always exists.
+    if (used.empty() || (used.size() == 1 && used.front() == "_id"))
+        return std::nullopt;
+    return key.extract();
+}
+
+bool IndexAdvisor::isPrefix(const bsoncxx::document::view& key, const bsoncxx::document::view& index_key)
+{
+    auto index_it = index_key.begin();
+    int relation = 0;   // 1 same directions, -1 all reversed.
+    for (const bsoncxx::document::element& field : key)
+    {
+        if (index_it == index_key.end() || field.key() != index_it->key())
+            return false;
+
+        // Special indexes ("text", "hashed", "2dsphere") have no numeric direction.
+        std::int64_t direction = 0;
+        std::int64_t index_direction = 0;
+        if (!toInt64(field, direction) || !toInt64(*index_it, index_direction))
+            return false;
+        if (direction == 0 || index_direction == 0)
+            return false;
+
+        const int sign = (direction > 0) == (index_direction > 0) ? 1 : -1;
+        if (relation != 0 && sign != relation)
+            return false;
+        relation = sign;
+        ++index_it;
+    }
+    return true;
+}
+
+std::vector<AdvisorIndex> IndexAdvisor::advise(const std::vector<AdvisorQuery>& queries,
+                                               const std::vector<AdvisorStats>& stats)
+{
+    std::vector<AdvisorIndex> proposals;
+    std::map<std::string, std::vector<bsoncxx::document::value>> existing;
+
+    for (std::size_t i = 0; i < queries.size() && i < stats.size(); ++i)
+    {
+        const AdvisorQuery& query = queries[i];
+        if (!IndexAdvisor::needsIndex(stats[i]))
+            continue;
+        std::optional<bsoncxx::document::value> key = IndexAdvisor::suggestKey(query);
+        if (!key)
+            continue;
+
+        // An index that already serves the key: the plan is not fixed by another one.
+        const std::string ns = query.database + "." + query.collection;
+        if (existing.find(ns) == existing.end())
+            existing[ns] = this->indexKeys(query.database, query.collection);
+        const std::vector<bsoncxx::document::value>& keys = existing[ns];
+        if (std::any_of(keys.begin(), keys.end(), [&key](const bsoncxx::document::value& index_key)
+                        { return IndexAdvisor::isPrefix(key->view(), index_key.view()); }))
+            continue;
+
+        // Merge with a proposal of the same collection when one key is a prefix of the other.
+        auto merged = std::find_if(proposals.begin(), proposals.end(), [&query, &key](const AdvisorIndex& index)
+        {
+            return index.database == query.database && index.collection == query.collection
+                   && (IndexAdvisor::isPrefix(key->view(), index.key.view())
+                       || IndexAdvisor::isPrefix(index.key.view(), key->view()));
+        });
+        if (merged == proposals.end())
+        {
+            AdvisorIndex index;
+            index.database = query.database;
+            index.collection = query.collection;
+            index.key = std::move(*key);
+            proposals.push_back(std::move(index));
+            merged = std::prev(proposals.end());
+        }
+        else if (IndexAdvisor::isPrefix(merged->key.view(), key->view()))
+            merged->key = std::move(*key);
+
+        merged->name = std::string(kIndexPrefix) + defaultIndexName(merged->key.view());
+        merged->queries.push_back(query.name);
+    }
+    return proposals;
+}
+
+bool IndexAdvisor::createIndex(const AdvisorIndex& index)
+{
+    try
+    {
+        mongocxx::collection collection = this->client_[index.database][index.collection];
+        collection.create_index(index.key.view(), make_document(kvp("name", index.name)));
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "[IndexAdvisor] Cannot create " << index.name << " on " << index.database << "."
+                  << index.collection << ": " << e.what() << std::endl;
+        return false;
+    }
+}
+
+int IndexAdvisor::dropAdvisedIndexes(const std::string& database, const std::string& collection)
+{
+    const std::string prefix(kIndexPrefix);
+    std::vector<std::string> names;
+    try
+    {
+        mongocxx::collection coll = this->client_[database][collection];
+        for (const bsoncxx::document::view& index : coll.list_indexes())
+        {
+            const std::string name = toString(index["name"].get_string().value);
+            if (name.compare(0, prefix.size(), prefix) == 0)
+                names.push_back(name);
+        }
+        for (const std::string& name : names)
+            coll.indexes().drop_one(name);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "[IndexAdvisor] Cannot drop the advised indexes of " << database << "." << collection << ": "
+                  << e.what() << std::endl;
+    }
+    return static_cast<int>(names.size());
+}
+
+std::vector<bsoncxx::document::value> IndexAdvisor::indexKeys(const std::string& database,
+                                                               const std::string& collection)
+{
+    std::vector<bsoncxx::document::value> keys;
+    try
+    {
+        for (const bsoncxx::document::view& index : this->client_[database][collection].list_indexes())
+            keys.emplace_back(index["key"].get_document().value);
+    }
+    catch (const std::exception&)
+    {
+        // Missing collection: no indexes.
+    }
+    return keys;
+}
+
+std::vector<AdvisorQuery> IndexAdvisor::loadQueries(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file)
+        throw std::runtime_error("Cannot open " + path);
+    std::stringstream json;
+    json << file.rdbuf();
+
+    const bsoncxx::document::value root = bsoncxx::from_json("{\"queries\": " + json.str() + "}");
+    const bsoncxx::document::element array = root.view()["queries"];
+    if (array.type() != bsoncxx::type::k_array)
+        throw std::runtime_error(path + ": expected an array of queries");
+
+    std::vector<AdvisorQuery> queries;
+    for (const bsoncxx::array::element& item : array.get_array().value)
+    {
+        if (item.type() != bsoncxx::type::k_document)
+            throw std::runtime_error(path + ": every query must be an object");
+        const bsoncxx::document::view spec = item.get_document().value;
+
+        AdvisorQuery query;
+        query.name = spec["name"] && spec["name"].type() == bsoncxx::type::k_string
+                         ? toString(spec["name"].get_string().value)
+                         : "query " + std::to_string(queries.size() + 1);
+        if (!spec["db"] || spec["db"].type() != bsoncxx::type::k_string
+            || !spec["collection"] || spec["collection"].type() != bsoncxx::type::k_string)
+            throw std::runtime_error(path + ": " + query.name + " needs \"db\" and \"collection\"");
+        query.database = toString(spec["db"].get_string().value);
+        query.collection = toString(spec["collection"].get_string().value);
+        if (spec["filter"] && spec["filter"].type() == bsoncxx::type::k_document)
+            query.filter = bsoncxx::document::value(spec["filter"].get_document().value);
+        if (spec["sort"] && spec["sort"].type() == bsoncxx::type::k_document)
+            query.sort.emplace(spec["sort"].get_document().value);
+        toInt64(spec["limit"], query.limit);
+        queries.push_back(std::move(query));
+    }
+    return queries;
+}
+
+std::string IndexAdvisor::shellCommand(const AdvisorIndex& index)
+{
+    return "db.getSiblingDB(\"" + index.database + "\").getCollection(\"" + index.collection + "\").createIndex("
+           + bsoncxx::to_json(index.key.view()) + ", {name: \"" + index.name + "\"})";
+}
+
+// =====================================================================================================================
@@ -0,0 +1,156 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldMongoCxx – Query profiler (explain executionStats) and compound index advisor
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+// BSONCXX INCLUDES
+#include <bsoncxx/document/value.hpp>
+#include <bsoncxx/document/view.hpp>
+
+// MONGOCXX INCLUDES
+#include <mongocxx/client.hpp>
+
+/**
+ * @brief One profiled query: a find with filter, sort and limit.
+ */
+struct AdvisorQuery
+{
+    std::string name;                                  ///< Label of the report.
+    std::string database;
+    std::string collection;
+    bsoncxx::document::value filter = bsoncxx::document::value(bsoncxx::document::view());
+    std::optional<bsoncxx::document::value> sort;
+    std::int64_t limit = 0;                            ///< 0 for no limit.
+};
+
+/**
+ * @brief Execution statistics of the winning plan of a query (explain "executionStats").
+ */
+struct AdvisorStats
+{
+    bool ok = false;                   ///< False if the explain failed (see error).
+    std::string error;
+    std::string plan;                  ///< Stages of the winning plan, top down, e.g. "FETCH > IXSCAN value_1__id_1".
+    bool collscan = false;             ///< The plan reads the whole collection.
+    bool blocking_sort = false;        ///< The plan sorts in memory (no index gives the order).
+    std::int64_t returned = 0;         ///< nReturned.
+    std::int64_t docs_examined = 0;    ///< totalDocsExamined.
+    std::int64_t keys_examined = 0;    ///< totalKeysExamined.
+    std::int64_t time_ms = 0;          ///< executionTimeMillis.
+};
+
+/**
+ * @brief Compound index proposed for one or more queries.
+ */
+struct AdvisorIndex
+{
+    std::string database;
+    std::string collection;
+    bsoncxx::document::value key = bsoncxx::document::value(bsoncxx::document::view());
+    std::string name;                  ///< kIndexPrefix + the default name of the key.
+    std::vector<std::string> queries;  ///< Names of the queries it serves.
+};
+
+/**
+ * @brief Runs queries through explain, decides which ones need an index and proposes it.
+ *
+ * The proposed key follows the equality, sort, range rule: the fields compared for equality first (any order
+ * serves them), then the sort fields with their direction (the index gives the order, no blocking sort), then the
+ * range fields. Filters with $or, $nor, $expr, $text or $where get no proposal (one index per branch is needed).
+ *
+ * A query needs an index when its plan scans the collection, sorts in memory or examines more than
+ * kMaxExaminedRatio documents per returned document. A proposal is dropped when an existing index (or another
+ * proposal) already has its key as prefix.
+ *
+ * The indexes created by createIndex() are named with kIndexPrefix, dropAdvisedIndexes() removes them.
+ */
+class IndexAdvisor
+{
+public:
+
+    // Constant expresions.
+    static constexpr std::int64_t kMaxExaminedRatio = 10;    ///< Examined documents per returned one.
+    static constexpr std::int64_t kMinExamined = 1'000;      ///< Below this the ratio is not considered.
+    static constexpr const char* kIndexPrefix = "advisor_";
+
+    /**
+     * @param client Connected client (must outlive the advisor).
+     */
+    explicit IndexAdvisor(mongocxx::client& client);
+
+    /**
+     * @brief Explain the query with "executionStats" verbosity (the query runs on the server).
+     */
+    AdvisorStats explain(const AdvisorQuery& query);
+
+    /**
+     * @brief True if the statistics show a collection scan, a blocking sort or too many examined documents.
+     */
+    static bool needsIndex(const AdvisorStats& stats);
+
+    /**
+     * @brief Equality, sort, range key for the query, empty if the filter is not supported or only _id is used.
+     */
+    static std::optional<bsoncxx::document::value> suggestKey(const AdvisorQuery& query);
+
+    /**
+     * @brief True if `key` is a prefix of `index_key` (same fields and directions, or all directions reversed).
+     */
+    static bool isPrefix(const bsoncxx::document::view& key, const bsoncxx::document::view& index_key);
+
+    /**
+     * @brief Proposals for the queries whose statistics need an index, one per distinct key.
+     * @param stats Statistics of each query (same order).
+     */
+    std::vector<AdvisorIndex> advise(const std::vector<AdvisorQuery>& queries, const std::vector<AdvisorStats>& stats);
+
+    /**
+     * @brief Create a proposed index. False (and the error on std::cerr) if it fails.
+     */
+    bool createIndex(const AdvisorIndex& index);
+
+    /**
+     * @brief Drop the indexes named with kIndexPrefix. Returns the number dropped.
+     */
+    int dropAdvisedIndexes(const std::string& database, const std::string& collection);
+
+    /**
+     * @brief Keys of the indexes of a collection (none if it does not exist).
+     */
+    std::vector<bsoncxx::document::value> indexKeys(const std::string& database, const std::string& collection);
+
+    /**
+     * @brief The queries of a JSON file, an array of {"name", "db", "collection", "filter", "sort", "limit"}.
+     *
+     * Filters and sorts are Extended JSON (e.g. {"$date": "2025-01-01T00:00:00Z"}). Throws on a malformed file.
+     */
+    static std::vector<AdvisorQuery> loadQueries(const std::string& path);
+
+    /**
+     * @brief mongosh command that creates the index, e.g. db.getSiblingDB("db").coll.createIndex({...}).
+     */
+    static std::string shellCommand(const AdvisorIndex& index);
+
+private:
+
+    mongocxx::client& client_;
+};
+
+// =====================================================================================================================
@@ -0,0 +1,545 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <iterator>
+#include <utility>
+
+// MONGOCXX INCLUDES
+#include <mongocxx/client.hpp>
+#include <mongocxx/exception/bulk_write_exception.hpp>
+#include <mongocxx/options/insert.hpp>
+#include <mongocxx/uri.hpp>
+
+// PROJECT INCLUDES
+#include "zmq_pipeline.h"
+
+namespace
+{
+
+// Instances of the process, each one uses its own inproc:// endpoints.
+std::atomic<std::uint64_t> pipeline_instances{0};
+
+/**
+ * @brief Release callback of the zero-copy document frames.
+ */
+void freeDocument(void*, void* hint)
+{
+    delete static_cast<bsoncxx::document::value*>(hint);
+}
+
+/**
+ * @brief Frame that owns a document (its bytes are handed to ZeroMQ, not copied).
+ */
+zmq::message_t documentMessage(bsoncxx::document::value document)
+{
+    auto* owned = new bsoncxx::document::value(std::move(document));
+    const bsoncxx::document::view view = owned->view();
+    return zmq::message_t(const_cast<std::uint8_t*>(view.data()), view.length(), &freeDocument, owned);
+}
+
+/**
+ * @brief Documents of a failed unordered insert_many that were not written.
+ */
+std::size_t unwrittenDocuments(const mongocxx::bulk_write_exception& e, std::size_t batch_size)
+{
+    // Unordered: the server writes every document but the ones listed in writeErrors.
+    const auto& reply = e.raw_server_error();
+    if (reply)
+    {
+        const auto write_errors = reply->view()["writeErrors"];
+        if (write_errors && write_errors.type() == bsoncxx::type::k_array)
+        {
+            const auto errors = write_errors.get_array().value;
+            const auto count = static_cast<std::size_t>(std::distance(errors.begin(), errors.end()));
+            return std::min(count, batch_size);
+        }
+    }
+
+    // No per-document result (write concern or network error): none is known to be written.
+    return batch_size;
+}
+
+} // namespace
+
+// =====================================================================================================================
+
+ZmqPipeline::ZmqPipeline(const ZmqPipelineConfig& config, PipelineSource source, PipelineTransform transform) :
+    config_(config),
+    source_(std::move(source)),
+    transform_(std::move(transform)),
+    context_(config.context ? config.context : std::make_shared<zmq::context_t>(1)),
+    id_(pipeline_instances.fetch_add(1)),
+    next_seq_(0),
+    producers_running_(0),
+    start_ns_(0),
+    failed_(false),
+    stop_req_(false)
+{
+    for (int& workers : this->config_.workers)
+        workers = std::max(workers, 1);
+    this->config_.persist_batch = std::max<std::size_t>(this->config_.persist_batch, 1);
+}
+
+ZmqPipeline::~ZmqPipeline()
+{
+    this->stop();
+}
+
+void ZmqPipeline::start()
+{
+    if (!this->workers_.empty())
+        return;
+
+    this->start_ns_ = ZmqPipeline::nowNs();
+    this->stop_req_.store(false);
+    this->producers_running_.store(this->config_.workers[0]);
+
+    // inproc:// accepts connections before the bind (ZeroMQ 4.2), so the start order does not matter.
+    const auto& workers = this->config_.workers;
+    for (int w = 0; w < workers[static_cast<std::size_t>(PipelineStage::Publish)]; ++w)
+        this->workers_.emplace_back(&ZmqPipeline::runPublisher, this, w);
+    for (int w = 0; w < workers[static_cast<std::size_t>(PipelineStage::Persist)]; ++w)
+        this->workers_.emplace_back(&ZmqPipeline::runPersister, this, w);
+    for (int w = 0; w < workers[static_cast<std::size_t>(PipelineStage::Transform)]; ++w)
+        this->workers_.emplace_back(&ZmqPipeline::runTransformer, this, w);
+    for (int w = 0; w < workers[static_cast<std::size_t>(PipelineStage::Produce)]; ++w)
+        this->workers_.emplace_back(&ZmqPipeline::runProducer, this, w);
+}
+
+bool ZmqPipeline::wait(std::chrono::milliseconds timeout)
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    const StageCounters& produced = this->counters(PipelineStage::Produce);
+    const StageCounters& published = this->counters(PipelineStage::Publish);
+    while (std::chrono::steady_clock::now() < deadline && !this->failed_.load())
+    {
+        // Every produced document is either published or discarded by one of the stages.
+        std::uint64_t left = published.sent.load();
+        for (const StageCounters& counters : this->counters_)
+            left += counters.discarded.load();
+        if (this->producers_running_.load() == 0 && left == produced.sent.load())
+            return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+void ZmqPipeline::stop()
+{
+    this->stop_req_.store(true);
+    for (std::thread& worker : this->workers_)
+        if (worker.joinable())
+            worker.join();
+    this->workers_.clear();
+}
+
+PipelineStageMetrics ZmqPipeline::metrics(PipelineStage stage) const
+{
+    const auto index = static_cast<std::size_t>(stage);
+    const StageCounters& counters = this->counters_[index];
+
+    PipelineStageMetrics metrics;
+    metrics.stage = stage;
+    metrics.workers = this->config_.workers[index];
+    metrics.received = counters.received.load(std::memory_order_relaxed);
+    metrics.sent = counters.sent.load(std::memory_order_relaxed);
+    metrics.dropped = counters.dropped.load(std::memory_order_relaxed);
+    metrics.errors = counters.errors.load(std::memory_order_relaxed);
+    metrics.bytes = counters.bytes.load(std::memory_order_relaxed);
+    metrics.busy_ns = counters.busy_ns.load(std::memory_order_relaxed);
+    metrics.blocked_ns = counters.blocked_ns.load(std::memory_order_relaxed);
+    if (index > 0)
+    {
+        const std::uint64_t upstream = this->counters_[index - 1].sent.load(std::memory_order_relaxed);
+        metrics.queued = upstream > metrics.received ? upstream - metrics.received : 0;
+    }
+    const std::int64_t last_ns = counters.last_sent_ns.load(std::memory_order_relaxed);
+    if (last_ns > this->start_ns_)
+        metrics.throughput = metrics.sent * 1e9 / static_cast<double>(last_ns - this->start_ns_);
+    return metrics;
+}
+
+const LatencyHistogram& ZmqPipeline::latency() const noexcept
+{
+    return this->latency_;
+}
+
+std::string ZmqPipeline::lastError() const
+{
+    std::lock_guard<std::mutex> lock(this->error_mutex_);
+    return this->last_error_;
+}
+
+std::shared_ptr<zmq::context_t> ZmqPipeline::context() const
+{
+    return this->context_;
+}
+
+bool ZmqPipeline::decode(const zmq::message_t& header, const zmq::message_t& document, PipelineHeader& out_header,
+                         bsoncxx::document::view& out_document)
+{
+    if (header.size() != sizeof(PipelineHeader) || document.size() < 5)
+        return false;
+
+    std::memcpy(&out_header, header.data(), sizeof(PipelineHeader));
+    if (out_header.magic != kPipelineMagic)
+        return false;
+
+    out_document = bsoncxx::document::view(document.data<std::uint8_t>(), document.size());
+    return true;
+}
+
+const char* ZmqPipeline::stageName(PipelineStage stage) noexcept
+{
+    switch (stage)
+    {
+    case PipelineStage::Produce:   return "produce";
+    case PipelineStage::Transform: return "transform";
+    case PipelineStage::Persist:   return "persist";
+    case PipelineStage::Publish:   return "publish";
+    }
+    return "unknown";
+}
+
+std::int64_t ZmqPipeline::nowNs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void ZmqPipeline::runProducer(int worker)
+{
+    StageCounters& counters = this->counters(PipelineStage::Produce);
+    try
+    {
+        zmq::socket_t output = this->pushSocket(PipelineStage::Transform);
+        for (std::uint64_t index = 0; !this->stop_req_.load(std::memory_order_relaxed); ++index)
+        {
+            const std::int64_t start_ns = ZmqPipeline::nowNs();
+            std::optional<bsoncxx::document::value> document = this->source_(worker, index);
+            if (!document)
+                break;
+
+            const PipelineHeader header{kPipelineMagic, static_cast<std::uint32_t>(worker),
+                                        this->next_seq_.fetch_add(1, std::memory_order_relaxed), start_ns};
+            zmq::message_t header_frame(&header, sizeof(header));
+            zmq::message_t document_frame = documentMessage(std::move(*document));
+            counters.busy_ns.fetch_add(ZmqPipeline::nowNs() - start_ns, std::memory_order_relaxed);
+            counters.received.fetch_add(1, std::memory_order_relaxed);
+
+            if (!this->forward(output, header_frame, document_frame, counters))
+                break;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        this->fail(std::string("Producer ") + std::to_string(worker) + ": " + e.what());
+    }
+    this->producers_running_.fetch_sub(1);
+}
+
+void ZmqPipeline::runTransformer(int worker)
+{
+    StageCounters& counters = this->counters(PipelineStage::Transform);
+    try
+    {
+        zmq::socket_t input = this->pullSocket(PipelineStage::Transform, worker);
+        zmq::socket_t output = this->pushSocket(PipelineStage::Persist);
+        zmq::message_t header;
+        zmq::message_t document;
+        while (!this->stop_req_.load(std::memory_order_relaxed))
+        {
+            if (!this->receive(input, header, document, counters))
+                continue;
+            counters.received.fetch_add(1, std::memory_order_relaxed);
+
+            PipelineHeader info{};
+            bsoncxx::document::view view;
+            if (!ZmqPipeline::decode(header, document, info, view))
+            {
+                this->discard(counters);
+                continue;
+            }
+
+            // The header frame goes on as it is, the document frame is replaced. A document the transform rejects
+            // (missing field, wrong type...) is discarded, the worker goes on with the next one.
+            const std::int64_t start_ns = ZmqPipeline::nowNs();
+            zmq::message_t transformed;
+            try
+            {
+                transformed = documentMessage(this->transform_(view));
+            }
+            catch (const std::exception& e)
+            {
+                counters.busy_ns.fetch_add(ZmqPipeline::nowNs() - start_ns, std::memory_order_relaxed);
+                if (this->discard(counters) == 1)
+                    std::cerr << "[ZmqPipeline] Transformer " << worker << ", document " << info.seq
+                              << " discarded (only the first one is reported): " << e.what() << std::endl;
+                continue;
+            }
+            counters.busy_ns.fetch_add(ZmqPipeline::nowNs() - start_ns, std::memory_order_relaxed);
+
+            if (!this->forward(output, header, transformed, counters))
+                break;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        this->fail(std::string("Transformer ") + std::to_string(worker) + ": " + e.what());
+    }
+}
+
+void ZmqPipeline::runPersister(int worker)
+{
+    StageCounters& counters = this->counters(PipelineStage::Persist);
+    try
+    {
+        zmq::socket_t input = this->pullSocket(PipelineStage::Persist, worker);
+        zmq::socket_t output = this->pushSocket(PipelineStage::Publish);
+
+        // One client per worker (a client is not thread safe).
+        std::unique_ptr<mongocxx::client> client;
+        std::optional<mongocxx::collection> collection;
+        if (!this->config_.mongo_uri.empty())
+        {
+            client = std::make_unique<mongocxx::client>(mongocxx::uri{this->config_.mongo_uri});
+            collection.emplace((*client)[this->config_.database][this->config_.collection]);
+        }
+        mongocxx::options::insert insert_options;
+        insert_options.ordered(false);
+
+        std::vector<std::pair<zmq::message_t, zmq::message_t>> batch;
+        std::vector<bsoncxx::document::view> views;
+        batch.reserve(this->config_.persist_batch);
+        views.reserve(this->config_.persist_batch);
+        while (!this->stop_req_.load(std::memory_order_relaxed))
+        {
+            // Wait for one document, then take what is already queued up to the batch size.
+            batch.clear();
+            zmq::message_t header;
+            zmq::message_t document;
+            if (!this->receive(input, header, document, counters))
+                continue;
+            do
+            {
+                PipelineHeader info{};
+                bsoncxx::document::view view;
+                counters.received.fetch_add(1, std::memory_order_relaxed);
+                if (ZmqPipeline::decode(header, document, info, view))
+                    batch.emplace_back(std::move(header), std::move(document));
+                else
+                    this->discard(counters);
+            }
+            while (batch.size() < this->config_.persist_batch
+                   && this->receive(input, header, document, counters, zmq::recv_flags::dontwait));
+
+            // Written in place: the views point into the frames of the batch.
+            if (collection && !batch.empty())
+            {
+                views.clear();
+                for (const auto& [header_frame, document_frame] : batch)
+                    views.emplace_back(document_frame.data<std::uint8_t>(), document_frame.size());
+
+                // A write error is counted and the documents go on: it does not fail the pipeline.
+                const std::int64_t start_ns = ZmqPipeline::nowNs();
+                std::size_t unwritten = 0;
+                std::string error;
+                try
+                {
+                    collection->insert_many(views, insert_options);
+                }
+                catch (const mongocxx::bulk_write_exception& e)
+                {
+                    unwritten = unwrittenDocuments(e, views.size());
+                    error = e.what();
+                }
+                catch (const std::exception& e)
+                {
+                    unwritten = views.size();
+                    error = e.what();
+                }
+                counters.busy_ns.fetch_add(ZmqPipeline::nowNs() - start_ns, std::memory_order_relaxed);
+
+                if (!error.empty())
+                {
+                    counters.dropped.fetch_add(unwritten, std::memory_order_relaxed);
+                    if (counters.errors.fetch_add(1, std::memory_order_relaxed) == 0)
+                        std::cerr << "[ZmqPipeline] Persister " << worker << ", " << unwritten << " of "
+                                  << views.size() << " documents not written (only the first error is reported): "
+                                  << error << std::endl;
+                }
+            }
+
+            // Only the persisted (or failed) documents reach the GUI.
+            bool stopped = false;
+            for (auto& [header_frame, document_frame] : batch)
+            {
+                if (!this->forward(output, header_frame, document_frame, counters))
+                {
+                    stopped = true;
+                    break;
+                }
+            }
+            if (stopped)
+                break;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        this->fail(std::string("Persister ") + std::to_string(worker) + ": " + e.what());
+    }
+}
+
+void ZmqPipeline::runPublisher(int worker)
+{
+    StageCounters& counters = this->counters(PipelineStage::Publish);
+    try
+    {
+        zmq::socket_t input = this->pullSocket(PipelineStage::Publish, worker);
+
+        // The GUI binds, any number of publishers connect. At the high-water mark the send fails instead of waiting.
+        zmq::socket_t output(*this->context_, zmq::socket_type::pub);
+        output.set(zmq::sockopt::sndhwm, this->config_.hwm);
+        output.set(zmq::sockopt::xpub_nodrop, true);
+        output.set(zmq::sockopt::linger, 0);
+        output.connect(this->config_.publish_endpoint);
+
+        zmq::message_t header;
+        zmq::message_t document;
+        while (!this->stop_req_.load(std::memory_order_relaxed))
+        {
+            if (!this->receive(input, header, document, counters))
+                continue;
+            counters.received.fetch_add(1, std::memory_order_relaxed);
+
+            PipelineHeader info{};
+            bsoncxx::document::view view;
+            if (!ZmqPipeline::decode(header, document, info, view))
+            {
+                this->discard(counters);
+                continue;
+            }
+
+            const std::int64_t start_ns = ZmqPipeline::nowNs();
+            const std::size_t bytes = document.size();
+            const bool sent = output.send(header, zmq::send_flags::sndmore | zmq::send_flags::dontwait)
+                              && output.send(document, zmq::send_flags::dontwait);
+            const std::int64_t end_ns = ZmqPipeline::nowNs();
+            counters.busy_ns.fetch_add(end_ns - start_ns, std::memory_order_relaxed);
+            if (!sent)
+            {
+                this->discard(counters);
+                continue;
+            }
+            this->latency_.record(end_ns - info.produced_ns);
+            counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+            counters.sent.fetch_add(1, std::memory_order_relaxed);
+            counters.last_sent_ns.store(end_ns, std::memory_order_relaxed);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        this->fail(std::string("Publisher ") + std::to_string(worker) + ": " + e.what());
+    }
+}
+
+zmq::socket_t ZmqPipeline::pullSocket(PipelineStage stage, int worker)
+{
+    zmq::socket_t socket(*this->context_, zmq::socket_type::pull);
+    socket.set(zmq::sockopt::rcvhwm, this->config_.hwm);
+    socket.set(zmq::sockopt::rcvtimeo, static_cast<int>(kPollPeriod.count()));
+    socket.set(zmq::sockopt::linger, 0);
+    socket.bind(this->endpoint(stage, worker));
+    return socket;
+}
+
+zmq::socket_t ZmqPipeline::pushSocket(PipelineStage next)
+{
+    zmq::socket_t socket(*this->context_, zmq::socket_type::push);
+    socket.set(zmq::sockopt::sndhwm, this->config_.hwm);
+    socket.set(zmq::sockopt::sndtimeo, static_cast<int>(kPollPeriod.count()));
+    socket.set(zmq::sockopt::linger, 0);
+    for (int w = 0; w < this->config_.workers[static_cast<std::size_t>(next)]; ++w)
+        socket.connect(this->endpoint(next, w));
+    return socket;
+}
+
+bool ZmqPipeline::receive(zmq::socket_t& socket, zmq::message_t& header, zmq::message_t& document,
+                          StageCounters& counters, zmq::recv_flags flags)
+{
+    // Both frames or none: a multipart message is delivered atomically.
+    if (!socket.recv(header, flags))
+        return false;
+    if (!header.more())
+    {
+        // Malformed, it leaves the pipeline here (otherwise wait() would never see it).
+        counters.received.fetch_add(1, std::memory_order_relaxed);
+        this->discard(counters);
+        return false;
+    }
+    return static_cast<bool>(socket.recv(document, zmq::recv_flags::none));
+}
+
+bool ZmqPipeline::forward(zmq::socket_t& socket, zmq::message_t& header, zmq::message_t& document,
+                          StageCounters& counters)
+{
+    const std::size_t bytes = document.size();
+
+    // Fast path, then wait (in kPollPeriod steps, to see a stop request) while every peer is full.
+    bool sent = static_cast<bool>(socket.send(header, zmq::send_flags::sndmore | zmq::send_flags::dontwait));
+    if (!sent)
+    {
+        const std::int64_t start_ns = ZmqPipeline::nowNs();
+        while (!sent && !this->stop_req_.load(std::memory_order_relaxed))
+            sent = static_cast<bool>(socket.send(header, zmq::send_flags::sndmore));
+        counters.blocked_ns.fetch_add(ZmqPipeline::nowNs() - start_ns, std::memory_order_relaxed);
+        if (!sent)
+            return false;
+    }
+
+    // A multipart message is atomic: once the first frame is accepted, so is the rest.
+    socket.send(document, zmq::send_flags::none);
+    counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    counters.sent.fetch_add(1, std::memory_order_relaxed);
+    counters.last_sent_ns.store(ZmqPipeline::nowNs(), std::memory_order_relaxed);
+    return true;
+}
+
+std::string ZmqPipeline::endpoint(PipelineStage stage, int worker) const
+{
+    return "inproc://degoras-pipeline-" + std::to_string(this->id_) + "-" + ZmqPipeline::stageName(stage) + "-"
+           + std::to_string(worker);
+}
+
+ZmqPipeline::StageCounters& ZmqPipeline::counters(PipelineStage stage)
+{
+    return this->counters_[static_cast<std::size_t>(stage)];
+}
+
+std::uint64_t ZmqPipeline::discard(StageCounters& counters)
+{
+    counters.discarded.fetch_add(1, std::memory_order_relaxed);
+    return counters.dropped.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+void ZmqPipeline::fail(const std::string& error)
+{
+    std::cerr << "[ZmqPipeline] " << error << std::endl;
+    std::lock_guard<std::mutex> lock(this->error_mutex_);
+    this->last_error_ = error;
+    this->failed_.store(true);
+}
+
+// =====================================================================================================================
@@ -0,0 +1,266 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldMongoCxx – Staged ZeroMQ pipeline: produce, transform, persist to MongoDB, publish to the GUI
+ *
+ *   Wire format between the stages, one multipart message per document:
+ *
+ *      Frame 0: PipelineHeader (producer, sequence number and production time).
+ *      Frame 1: BSON document. The frame owns the bsoncxx::document::value, the bytes are never copied.
+ *
+ *   The header uses the native byte order, it is meant for inproc:// (and a GUI on the same host).
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+// BSONCXX INCLUDES
+#include <bsoncxx/document/value.hpp>
+#include <bsoncxx/document/view.hpp>
+
+// ZMQ INCLUDES
+#include <zmq.hpp>
+
+// PROJECT INCLUDES
+#include "latency_histogram.h"
+
+/**
+ * @brief Stages of the pipeline, in data order.
+ */
+enum class PipelineStage
+{
+    Produce,     ///< Creates the documents (PipelineSource).
+    Transform,   ///< Replaces each document by a new one (PipelineTransform).
+    Persist,     ///< Writes the documents to MongoDB with insert_many, then forwards them.
+    Publish      ///< Sends the documents to the GUI (PUB, never blocks the pipeline).
+};
+
+constexpr std::size_t kPipelineStages = 4;
+
+/**
+ * @brief Fixed-size first frame of every message.
+ */
+struct PipelineHeader
+{
+    std::uint32_t magic;          ///< Always kPipelineMagic.
+    std::uint32_t producer;       ///< Producer worker that created the document.
+    std::uint64_t seq;            ///< Pipeline-wide sequence number (production order).
+    std::int64_t produced_ns;     ///< Production time, steady clock (see ZmqPipeline::nowNs()).
+};
+
+constexpr std::uint32_t kPipelineMagic = 0x50504744; // "DGPP"
+
+/**
+ * @brief Configuration of a ZmqPipeline.
+ */
+struct ZmqPipelineConfig
+{
+    std::array<int, kPipelineStages> workers{1, 1, 1, 1};   ///< Worker threads of each stage (PipelineStage order).
+    int hwm = 1'000;                      ///< Send and receive high-water mark of the stage sockets, in messages.
+    std::size_t persist_batch = 256;      ///< Documents per insert_many at most.
+    std::string mongo_uri;                ///< Server URI, empty to forward without writing.
+    std::string database = "degoras";
+    std::string collection = "pipeline_samples";
+    std::string publish_endpoint = "inproc://degoras-pipeline-gui";   ///< Bound by the GUI (SUB socket).
+    std::shared_ptr<zmq::context_t> context;   ///< Shared context (required for an inproc:// GUI, created if null).
+};
+
+/**
+ * @brief Counters of one stage, summed over its workers.
+ */
+struct PipelineStageMetrics
+{
+    PipelineStage stage = PipelineStage::Produce;
+    int workers = 0;
+    std::uint64_t received = 0;   ///< Documents taken from the input socket (Produce: created).
+    std::uint64_t sent = 0;       ///< Documents handed to the next stage. Publish: accepted by the GUI socket, not
+                                  ///< necessarily received (discarded when no GUI is subscribed).
+    std::uint64_t dropped = 0;    ///< Malformed or rejected by the transform. Persist: not written (error, still
+                                  ///< forwarded). Publish: queue of a subscribed GUI full.
+    std::uint64_t errors = 0;     ///< Persist: failed insert_many calls (a write error does not stop the pipeline).
+    std::uint64_t bytes = 0;      ///< BSON bytes sent.
+    std::uint64_t queued = 0;     ///< Sent by the previous stage and not received yet (socket queues).
+    std::int64_t busy_ns = 0;     ///< Time in the stage work (source, transform, insert_many, send to the GUI).
+    std::int64_t blocked_ns = 0;  ///< Time waiting for the next stage at its high-water mark (backpressure).
+    double throughput = 0.0;      ///< Documents sent per second since start().
+};
+
+/**
+ * @brief Creates the document `index` of the producer `producer`, or nothing when it is done.
+ *
+ * Called concurrently by the producer workers (each one with its own index sequence).
+ */
+using PipelineSource = std::function<std::optional<bsoncxx::document::value>(int producer, std::uint64_t index)>;
+
+/**
+ * @brief Computes the document sent on from a received one. Called concurrently by the transform workers.
+ */
+using PipelineTransform = std::function<bsoncxx::document::value(const bsoncxx::document::view& document)>;
+
+/**
+ * @brief Four stages connected by inproc PUSH/PULL sockets, each one with its own number of worker threads.
+ *
+ * Every worker of a stage binds its own PULL endpoint, and every worker of the previous stage connects its PUSH
+ * socket to all of them: the messages are balanced round robin among the workers and fair-queued from the senders,
+ * with no broker. When all the workers of a stage are at the high-water mark, the senders block (backpressure up to
+ * the producers): before the GUI, only the documents the transform rejects (exception) are dropped. The GUI endpoint
+ * is a PUB socket with ZMQ_XPUB_NODROP: a slow or missing GUI never stalls the pipeline. The documents a slow GUI
+ * cannot queue are counted as dropped, but with no GUI subscribed the socket accepts and discards them silently, so
+ * they are counted as sent: the Publish counters tell what left the pipeline, only the GUI knows what it received.
+ *
+ * The BSON bytes are not copied between the stages: the frame owns the document built by the source or the
+ * transform, and the next stages read it in place (bsoncxx::document::view over the frame). Each persist worker owns
+ * its mongocxx::client, a mongocxx::instance must be alive while it runs.
+ */
+class ZmqPipeline
+{
+public:
+
+    // Constant expresions.
+    static constexpr std::chrono::milliseconds kPollPeriod{100};   ///< Receive and send timeout (stop latency).
+
+    ZmqPipeline(const ZmqPipelineConfig& config, PipelineSource source, PipelineTransform transform);
+
+    ZmqPipeline(const ZmqPipeline&) = delete;
+    ZmqPipeline& operator=(const ZmqPipeline&) = delete;
+
+    /**
+     * @brief Stop the workers (see stop()).
+     */
+    ~ZmqPipeline();
+
+    /**
+     * @brief Start the workers of every stage.
+     */
+    void start();
+
+    /**
+     * @brief Wait until the producers are done and every document left the pipeline.
+     * @return False on timeout, or as soon as a worker failed (see lastError()).
+     */
+    bool wait(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Stop the workers (within kPollPeriod). The documents still queued are discarded.
+     */
+    void stop();
+
+    PipelineStageMetrics metrics(PipelineStage stage) const;
+
+    /**
+     * @brief Production to GUI socket latency of the published documents.
+     */
+    const LatencyHistogram& latency() const noexcept;
+
+    std::string lastError() const;
+
+    /**
+     * @brief Context of the sockets, for a GUI socket on the inproc:// endpoint.
+     */
+    std::shared_ptr<zmq::context_t> context() const;
+
+    /**
+     * @brief Header and document of a received message (the view points into `document`). False if malformed.
+     */
+    static bool decode(const zmq::message_t& header, const zmq::message_t& document, PipelineHeader& out_header,
+                       bsoncxx::document::view& out_document);
+
+    static const char* stageName(PipelineStage stage) noexcept;
+
+    /**
+     * @brief Monotonic time in nanoseconds (steady clock).
+     */
+    static std::int64_t nowNs() noexcept;
+
+private:
+
+    struct StageCounters
+    {
+        std::atomic<std::uint64_t> received{0};
+        std::atomic<std::uint64_t> sent{0};
+        std::atomic<std::uint64_t> dropped{0};
+        std::atomic<std::uint64_t> discarded{0};   // Dropped and not forwarded (the Persist write errors go on).
+        std::atomic<std::uint64_t> errors{0};
+        std::atomic<std::uint64_t> bytes{0};
+        std::atomic<std::int64_t> busy_ns{0};
+        std::atomic<std::int64_t> blocked_ns{0};
+        std::atomic<std::int64_t> last_sent_ns{0};
+    };
+
+    void runProducer(int worker);
+
+    void runTransformer(int worker);
+
+    void runPersister(int worker);
+
+    void runPublisher(int worker);
+
+    /**
+     * @brief PULL socket of a worker (bound) and PUSH socket to all the workers of a stage (connected).
+     */
+    zmq::socket_t pullSocket(PipelineStage stage, int worker);
+
+    zmq::socket_t pushSocket(PipelineStage next);
+
+    /**
+     * @brief Receive a message, false on timeout or stop. A single-frame message is received and discarded (false).
+     */
+    bool receive(zmq::socket_t& socket, zmq::message_t& header, zmq::message_t& document, StageCounters& counters,
+                 zmq::recv_flags flags = zmq::recv_flags::none);
+
+    /**
+     * @brief Send a message to the next stage, waiting at the high-water mark. False if stopped.
+     */
+    bool forward(zmq::socket_t& socket, zmq::message_t& header, zmq::message_t& document, StageCounters& counters);
+
+    std::string endpoint(PipelineStage stage, int worker) const;
+
+    StageCounters& counters(PipelineStage stage);
+
+    /**
+     * @brief Count a document that leaves the pipeline at this stage. Returns the dropped count of the stage.
+     */
+    std::uint64_t discard(StageCounters& counters);
+
+    void fail(const std::string& error);
+
+    ZmqPipelineConfig config_;
+    PipelineSource source_;
+    PipelineTransform transform_;
+    std::shared_ptr<zmq::context_t> context_;
+    std::uint64_t id_;
+
+    std::array<StageCounters, kPipelineStages> counters_;
+    LatencyHistogram latency_;
+    std::atomic<std::uint64_t> next_seq_;
+    std::atomic<int> producers_running_;
+    std::int64_t start_ns_;
+
+    mutable std::mutex error_mutex_;
+    std::string last_error_;
+    std::atomic_bool failed_;
+    std::atomic_bool stop_req_;
+    std::vector<std::thread> workers_;
+};
+
+// =====================================================================================================================
@@ -12,13 +12,44 @@
  *   HelloWorldQtMV – Minimal Qt Model-View example
  **********************************************************************************************************************/
 
+// C++ INCLUDES
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+
 // QT INCLUDES
 #include <QApplication>
+#include <QHeaderView>
+#include <QTableView>
 #include <QThread>
+#include <QTimer>
+
+// MONGOCXX INCLUDES
+#include <mongocxx/instance.hpp>
 
 // PROJECT INCLUDES
 #include "view.h"
 #include "model.h"
+#include "property_coalescer.h"
+#include "event_loop_watchdog.h"
+#include "mongo_table_model.h"
+#include "shutdown_coordinator.h"
+#include "thread_placement.h"
+
+// Properties delivered to the view through the coalescer.
+enum ViewProperty : int
+{
+    kPropVar1,
+    kPropVar2,
+    kPropStatus
+};
+
+// Constant expresions.
+constexpr std::chrono::milliseconds kShutdownBudget{3000};   // Default time from window close to process exit.
 
 /**
  * @brief Main entry point of the App_HelloWorldQtMV application.
@@ -26,21 +57,114 @@
 int main(int argc, char** argv)
 {
     QApplication app(argc, argv);
+
+    // Optional collection browser: --browse <db>.<collection> [--uri <uri>] [--fields a,b,c] [--filter <json>] and
+    // --live, which appends the documents inserted while browsing (change stream, needs a replica set).
+    // Shutdown: --shutdown-budget <ms> (cleanup deadline), --quit-after <ms> (close the windows, for timing runs).
+    // Model thread: --model-cores <list> (e.g. 2 or 2-3), --model-policy <normal|batch|idle|fifo|rr>,
+    // --model-priority <n> (nice value, 1 to 99 for fifo and rr).
+    MongoTableQuery browse_query;
+    browse_query.fields = QStringList{"_id"};
+    MongoTableConfig table_config;
+    std::chrono::milliseconds shutdown_budget = kShutdownBudget;
+    int quit_after_ms = -1;
+    ThreadPlacement model_placement;
+    model_placement.name = "model";
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg(argv[i]);
+        if (arg == "--live")
+        {
+            table_config.live_tail = true;
+            continue;
+        }
+        if (i + 1 == argc)
+            break;
+        const QString value = QString::fromLocal8Bit(argv[i + 1]);
+        if (arg == "--browse")
+        {
+            browse_query.database = value.section('.', 0, 0);
+            browse_query.collection = value.section('.', 1);
+        }
+        else if (arg == "--uri")
+            browse_query.uri = value;
+        else if (arg == "--fields")
+            browse_query.fields = value.split(',', Qt::SkipEmptyParts);
+        else if (arg == "--filter")
+            browse_query.filter = value;
+        else if (arg == "--shutdown-budget")
+            shutdown_budget = std::chrono::milliseconds(value.toInt());
+        else if (arg == "--quit-after")
+            quit_after_ms = value.toInt();
+        else if (arg == "--model-cores" || arg == "--model-policy")
+        {
+            try
+            {
+                if (arg == "--model-cores")
+                    model_placement.cores = parseCoreList(value.toStdString());
+                else
+                    model_placement.policy = parseThreadPolicy(value.toStdString());
+            }
+            catch (const std::invalid_argument& e)
+            {
+                std::cerr << "[ERROR] " << e.what() << std::endl;
+                return 1;
+            }
+        }
+        else if (arg == "--model-priority")
+            model_placement.priority = value.toInt();
+        else
+            continue;
+        ++i;
+    }
+
+    // The driver instance is only created for the table, and outlives its model (the source thread of the model uses
+    // the client until the model is gone).
+    std::optional<mongocxx::instance> mongo_instance;
+    std::unique_ptr<MongoTableModel> table_model;
+    std::unique_ptr<QTableView> table_view;
+    if (!browse_query.collection.isEmpty())
+    {
+        mongo_instance.emplace();
+        table_model = std::make_unique<MongoTableModel>(table_config);
+        table_view = std::make_unique<QTableView>();
+        table_view->setModel(table_model.get());
+        table_view->setWindowTitle(browse_query.database + "." + browse_query.collection);
+
+        // Server-side sort on header clicks, by _id until the first one.
+        table_view->horizontalHeader()->setSortIndicator(-1, Qt::AscendingOrder);
+        table_view->setSortingEnabled(true);
+        table_model->setQuery(browse_query);
+        table_view->resize(800, 600);
+        table_view->show();
+    }
 	
 	// View in GUI thread.
     View view;
 	
-	// Model in model thread.
+	// Model in model thread, placed from the thread itself once started.
 	QThread model_thread;
+    model_thread.setObjectName(QString::fromStdString(model_placement.name));
+    QObject::connect(&model_thread, &QThread::started, &model_thread,
+                     [model_placement]() { applyThreadPlacement(model_placement); }, Qt::DirectConnection);
     Model* model = new Model;                
 
 	// Move to the model thread.
 	model->moveToThread(&model_thread);
 
-    // Connections UI <- Model
-    QObject::connect(model, &Model::var1TextChanged, &view, &View::setVar1Text);
-    QObject::connect(model, &Model::var2TextChanged, &view, &View::setVar2Text);
-    QObject::connect(model, &Model::statusTextChanged, &view, &View::setStatusText);
+    // Connections UI <- Model, coalesced: only the latest value of each property, at most once per frame.
+    PropertyCoalescer coalescer(std::chrono::milliseconds(16));
+    coalescer.setHandler(kPropVar1, [&view](const QVariant& value) { view.setVar1Text(value.toString()); });
+    coalescer.setHandler(kPropVar2, [&view](const QVariant& value) { view.setVar2Text(value.toString()); });
+    coalescer.setHandler(kPropStatus, [&view](const QVariant& value) { view.setStatusText(value.toString()); });
+
+    // Direct: runs in the model thread and only stores the value.
+    QObject::connect(model, &Model::var1TextChanged, &coalescer,
+                     [&coalescer](const QString& text) { coalescer.post(kPropVar1, text); }, Qt::DirectConnection);
+    QObject::connect(model, &Model::var2TextChanged, &coalescer,
+                     [&coalescer](const QString& text) { coalescer.post(kPropVar2, text); }, Qt::DirectConnection);
+    QObject::connect(model, &Model::statusTextChanged, &coalescer,
+                     [&coalescer](const QString& text) { coalescer.post(kPropStatus, text); }, Qt::DirectConnection);
 	
 	// Connections UI -> Model (Auto/Queued)
     QObject::connect(&view, &View::shortActionButtonClicked, model, &Model::shortActionReq);
@@ -52,17 +176,54 @@ int main(int argc, char** argv)
 	// Exit
 	QObject::connect(&app, &QGuiApplication::lastWindowClosed, model, &Model::requestStop);
     QObject::connect(&app, &QGuiApplication::lastWindowClosed, &model_thread, &QThread::requestInterruption);
-    QObject::connect(&app, &QCoreApplication::aboutToQuit, &model_thread, &QThread::quit);
 	
+    // GUI thread watchdog: heartbeat latency and stalls (View::longAction). The Model -> View delivery is measured by
+    // the coalescer itself (post -> handler), a per-signal queued probe would bring back one event per update.
+    EventLoopWatchdog watchdog;
+    watchdog.start();
+
 	// Start the thread.
     model_thread.start();
 
 	// Show.
     view.show();
+    if (quit_after_ms >= 0)
+        QTimer::singleShot(quit_after_ms, &app, &QApplication::closeAllWindows);
     const int ret = app.exec();
-	
-    // Thread close.
-    model_thread.wait();
+
+    // Hide everything right away, the cleanup runs after the user sees the application closed.
+    view.hide();
+    if (table_view)
+        table_view->hide();
+    watchdog.stop();
+
+    // Model cleanup steps run concurrently; the model thread stops (and deletes the model) after all of them.
+    ShutdownCoordinator shutdown(shutdown_budget);
+    model->addShutdownSteps(shutdown);
+    shutdown.addStep("model.thread", [&model_thread](const CancellationToken &token)
+    {
+        model_thread.quit();
+        while (!model_thread.wait(10) && !token.isCancelled())
+        {}
+    }, {"model.close_db_client", "model.flush_logs", "model.release_buffers"});
+    const bool clean = shutdown.run();
+
+    std::cout << "[INFO] GUI event loop: " << watchdog.summary() << std::flush;
+
+    const LatencyHistogram& view_latency = coalescer.latency();
+    std::cout << "[INFO] View updates: " << coalescer.received() << " received, " << coalescer.delivered()
+              << " delivered in " << coalescer.batches() << " batches, post -> view p50 "
+              << view_latency.percentileNs(0.50) / 1e6 << " ms, p99 " << view_latency.percentileNs(0.99) / 1e6
+              << " ms, max " << view_latency.maxNs() / 1e6 << " ms." << std::endl;
+
+    std::cout << "[INFO] Shutdown: " << shutdown.summary() << std::flush;
+
+    // Deadline reached: exit without waiting for the abandoned steps (destroying a running QThread aborts).
+    if (!clean)
+    {
+        std::cerr << "[ERROR] Shutdown budget exceeded, exiting without a complete cleanup." << std::endl;
+        std::_Exit(ret == 0 ? EXIT_FAILURE : ret);
+    }
 
 	// Return.
     return ret;
@@ -0,0 +1,833 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldQtMV – Benchmarks of the model threading, view update coalescing and the Mongo table model
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// QT INCLUDES
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QMetaObject>
+#include <QProcess>
+#include <QProcessEnvironment>
+#include <QStandardPaths>
+#include <QThread>
+#include <QTimer>
+
+// BSONCXX INCLUDES
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/types.hpp>
+
+// MONGOCXX INCLUDES
+#include <mongocxx/client.hpp>
+#include <mongocxx/instance.hpp>
+#include <mongocxx/options/insert.hpp>
+#include <mongocxx/uri.hpp>
+
+// PROJECT INCLUDES
+#include "bench_report.h"
+#include "model.h"
+#include "mongo_table_model.h"
+#include "property_coalescer.h"
+#include "shutdown_coordinator.h"
+
+// Constant expresions.
+constexpr int kLatencySamples = 100;
+constexpr int kSampleSpacingMs = 10;
+constexpr int kConcurrentLongActions = 8;
+constexpr double kShortActionP99BudgetMs = 50.0;   // Short action round trip p99, also with long actions running.
+constexpr double kStressRate = 100'000.0;   // Updates per second of the coalescing stress test.
+constexpr int kStressSeconds = 2;
+constexpr int kStressProperties = 3;
+constexpr int kSeedBatch = 10'000;            // Documents per insert_many when seeding the table collection.
+constexpr int kViewportRows = 40;             // Rows visible in the simulated table view.
+constexpr int kScrollStepRows = 20;           // Rows moved per scroll step.
+constexpr int kScrollSteps = 2'000;
+constexpr int kScrollStepMs = 4;              // Event loop time between two steps (fast flick).
+constexpr int kRandomJumps = 200;
+constexpr int kMongoTimeoutMs = 30'000;
+constexpr int kShutdownBudgetMs = 3'000;      // Default budget from window close to process exit.
+constexpr int kQuitAfterMs = 500;             // Run time of the App before its windows are closed.
+constexpr int kProcessTimeoutMs = 30'000;
+constexpr const char* kLiveCollection = "live_rows";   // Collection of the live tail benchmark (dropped).
+constexpr int kLiveInsertRate = 500;                   // Inserts per second of the steady live tail run.
+constexpr int kLiveSeconds = 3;
+constexpr int kLiveBurstDocs = 20'000;                 // Documents of the live tail burst.
+constexpr int kLiveInsertBatch = 1000;                 // Documents per insert_many of the burst.
+
+/**
+ * @brief Options of the MongoDB table benchmark (taken from the command line).
+ */
+struct MongoBenchOptions
+{
+    std::string uri;                      ///< Server URI, empty to skip the benchmark.
+    std::string database = "degoras_bench";
+    std::string collection = "table_rows";
+    std::int64_t seed = 0;                ///< Documents to insert before measuring (0 = use the existing ones).
+};
+
+/**
+ * @brief Print one benchmark result line.
+ */
+void printResult(std::string_view name, double value, std::string_view unit)
+{
+    BenchReport::instance().add(std::string(name), value, std::string(unit));
+    std::cout << "  " << std::left << std::setw(52) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(3) << value
+              << " " << unit << '\n';
+}
+
+/**
+ * @brief Measure the round trip of shortActionReq (GUI thread -> model thread -> GUI thread) in milliseconds.
+ */
+std::vector<double> measureShortActions(Model* model, int samples)
+{
+    std::vector<double> latencies_ms;
+    latencies_ms.reserve(samples);
+
+    QEventLoop loop;
+    QElapsedTimer timer;
+    bool waiting = false;
+    const auto connection = QObject::connect(model, &Model::var1TextChanged, &loop, [&](const QString&)
+    {
+        if (!waiting)
+            return;
+        waiting = false;
+        latencies_ms.push_back(timer.nsecsElapsed() / 1e6);
+        loop.quit();
+    });
+
+    for (int i = 0; i < samples; ++i)
+    {
+        waiting = true;
+        timer.start();
+        QMetaObject::invokeMethod(model, &Model::shortActionReq, Qt::QueuedConnection);
+        loop.exec();
+        QThread::msleep(kSampleSpacingMs);
+    }
+
+    QObject::disconnect(connection);
+    return latencies_ms;
+}
+
+/**
+ * @brief Print mean, p50, p99 and max of a latency set. Returns the p99 (0 if empty).
+ */
+double printLatencies(const std::string& label, std::vector<double> latencies_ms)
+{
+    if (latencies_ms.empty())
+        return 0.0;
+
+    std::sort(latencies_ms.begin(), latencies_ms.end());
+    const double mean = std::accumulate(latencies_ms.begin(), latencies_ms.end(), 0.0) / latencies_ms.size();
+    printResult(label + "mean", mean, "ms");
+    printResult(label + "p50", latencies_ms[latencies_ms.size() / 2], "ms");
+    const double p99 = latencies_ms[std::min(latencies_ms.size() - 1, latencies_ms.size() * 99 / 100)];
+    printResult(label + "p99", p99, "ms");
+    printResult(label + "max", latencies_ms.back(), "ms");
+    return p99;
+}
+
+/**
+ * @brief Check a measured time against its budget, printing PASS or FAIL.
+ */
+bool checkBudget(std::string_view name, double value_ms, double budget_ms)
+{
+    const bool pass = value_ms <= budget_ms;
+    printResult(name, value_ms, "ms");
+    std::cout << "  " << (pass ? "PASS" : "FAIL") << ": " << name << " within " << budget_ms << " ms" << std::endl;
+    return pass;
+}
+
+/**
+ * @brief Short action latency with the model idle and with concurrent long actions running on the executor.
+ * @return False if a p99 exceeds kShortActionP99BudgetMs (a long action blocking the model thread).
+ */
+bool benchShortActionLatency()
+{
+    BenchReport::instance().beginSection("Short action latency");
+    std::cout << "[Short action latency] " << kLatencySamples << " requests, " << kSampleSpacingMs
+              << " ms apart" << std::endl;
+
+    QThread model_thread;
+    Model* model = new Model;
+    model->moveToThread(&model_thread);
+    model_thread.start();
+
+    bool ok = true;
+    const double idle_p99 = printLatencies("idle model ", measureShortActions(model, kLatencySamples));
+    ok &= checkBudget("idle model short action p99", idle_p99, kShortActionP99BudgetMs);
+
+    // Each long action lasts 5 s, longer than the measurement, and reports throttled progress meanwhile.
+    int progress_signals = 0;
+    QObject context;
+    QObject::connect(model, &Model::statusTextChanged, &context, [&progress_signals](const QString&)
+    {
+        ++progress_signals;
+    });
+    for (int i = 0; i < kConcurrentLongActions; ++i)
+        QMetaObject::invokeMethod(model, &Model::longActionReq, Qt::QueuedConnection);
+
+    QElapsedTimer window;
+    window.start();
+    const std::string label = std::to_string(kConcurrentLongActions) + " long actions running ";
+    const double busy_p99 = printLatencies(label, measureShortActions(model, kLatencySamples));
+    ok &= checkBudget(label + "short action p99", busy_p99, kShortActionP99BudgetMs);
+    QCoreApplication::processEvents();
+    printResult(label + "status signals", progress_signals * 1000.0 / window.elapsed(), "signals/s");
+
+    // Cancel the long actions and stop the thread (the cleanup steps are measured in benchShutdown).
+    QMetaObject::invokeMethod(model, &Model::requestStop, Qt::QueuedConnection);
+    model_thread.quit();
+    model_thread.wait();
+    delete model;
+    return ok;
+}
+
+/**
+ * @brief Post `rate` updates per second for `seconds` from the calling thread, round-robin over the properties.
+ *
+ * `post(key, post_time_ns)` receives the time of the update on `clock`.
+ */
+void produceUpdates(double rate, int seconds, const QElapsedTimer& clock,
+                    const std::function<void(int, qint64)>& post)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const std::uint64_t total = static_cast<std::uint64_t>(rate * seconds);
+    std::uint64_t sent = 0;
+    while (sent < total)
+    {
+        const double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const std::uint64_t due = std::min(total, static_cast<std::uint64_t>(elapsed_s * rate));
+        for (; sent < due; ++sent)
+            post(static_cast<int>(sent % kStressProperties), clock.nsecsElapsed());
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+}
+
+/**
+ * @brief Run the event loop of the calling thread until `done()`, returning the largest gap between 1 ms ticks.
+ */
+double runLoopUntil(const std::function<bool()>& done)
+{
+    QEventLoop loop;
+    QTimer tick;
+    QElapsedTimer gap;
+    double max_gap_ms = 0.0;
+
+    tick.setTimerType(Qt::PreciseTimer);
+    QObject::connect(&tick, &QTimer::timeout, &loop, [&]()
+    {
+        max_gap_ms = std::max(max_gap_ms, gap.nsecsElapsed() / 1e6);
+        gap.start();
+        if (done())
+            loop.quit();
+    });
+    gap.start();
+    tick.start(1);
+    loop.exec();
+    return max_gap_ms;
+}
+
+/**
+ * @brief Push 100k updates/s to the GUI thread, one queued event per update versus the PropertyCoalescer.
+ */
+void benchCoalescing()
+{
+    BenchReport::instance().beginSection("Model -> View coalescing");
+    std::cout << "[Model -> View coalescing] " << static_cast<int>(kStressRate) << " updates/s for "
+              << kStressSeconds << " s over " << kStressProperties << " properties" << std::endl;
+
+    QElapsedTimer clock;
+    clock.start();
+
+    // One queued event per update (the plain cross-thread signal path).
+    {
+        QObject receiver;
+        std::atomic<std::uint64_t> posted{0};
+        std::uint64_t handled = 0;
+        std::atomic_bool producing{true};
+
+        std::thread producer([&]()
+        {
+            produceUpdates(kStressRate, kStressSeconds, clock, [&](int, qint64)
+            {
+                posted.fetch_add(1, std::memory_order_relaxed);
+                QMetaObject::invokeMethod(&receiver, [&handled]() { ++handled; }, Qt::QueuedConnection);
+            });
+            producing.store(false);
+        });
+
+        QElapsedTimer drain;
+        bool draining = false;
+        const double max_gap_ms = runLoopUntil([&]()
+        {
+            if (producing.load())
+                return false;
+            if (!draining)
+            {
+                draining = true;
+                drain.start();
+            }
+            return handled == posted.load(std::memory_order_relaxed);
+        });
+        producer.join();
+
+        printResult("queued signal per update: events", static_cast<double>(handled), "events");
+        printResult("queued signal per update: backlog drain after stop", drain.nsecsElapsed() / 1e6, "ms");
+        printResult("queued signal per update: max GUI loop gap", max_gap_ms, "ms");
+    }
+
+    // Coalesced delivery, once per 60 Hz frame.
+    {
+        PropertyCoalescer coalescer(std::chrono::milliseconds(16));
+        std::vector<double> ages_ms;
+        for (int key = 0; key < kStressProperties; ++key)
+        {
+            coalescer.setHandler(key, [&ages_ms, &clock](const QVariant& value)
+            {
+                ages_ms.push_back((clock.nsecsElapsed() - value.toLongLong()) / 1e6);
+            });
+        }
+
+        std::atomic_bool producing{true};
+        QElapsedTimer run;
+        run.start();
+        std::thread producer([&]()
+        {
+            produceUpdates(kStressRate, kStressSeconds, clock, [&coalescer](int key, qint64 post_ns)
+            {
+                coalescer.post(key, QVariant::fromValue(post_ns));
+            });
+            producing.store(false);
+        });
+
+        // Run one more interval after the producer so the last values are delivered.
+        QElapsedTimer tail;
+        bool stopping = false;
+        const double max_gap_ms = runLoopUntil([&]()
+        {
+            if (producing.load())
+                return false;
+            if (!stopping)
+            {
+                stopping = true;
+                tail.start();
+            }
+            return tail.elapsed() > 2 * coalescer.interval().count();
+        });
+        producer.join();
+        const double run_s = run.nsecsElapsed() / 1e9;
+
+        std::sort(ages_ms.begin(), ages_ms.end());
+        printResult("coalesced: received", static_cast<double>(coalescer.received()), "updates");
+        printResult("coalesced: delivered", static_cast<double>(coalescer.delivered()), "updates");
+        printResult("coalesced: batches per second", coalescer.batches() / run_s, "batches/s");
+        if (!ages_ms.empty())
+        {
+            printResult("coalesced: value age at delivery p99",
+                        ages_ms[std::min(ages_ms.size() - 1, ages_ms.size() * 99 / 100)], "ms");
+            printResult("coalesced: value age at delivery max", ages_ms.back(), "ms");
+        }
+        printResult("coalesced: max GUI loop gap", max_gap_ms, "ms");
+    }
+}
+
+/**
+ * @brief Replace the collection with `count` documents { seq, value, name, ts } and index { value, _id }.
+ */
+void seedCollection(const MongoBenchOptions& options)
+{
+    using bsoncxx::builder::basic::kvp;
+    using bsoncxx::builder::basic::make_document;
+
+    mongocxx::client client{mongocxx::uri{options.uri}};
+    mongocxx::collection collection = client[options.database][options.collection];
+    collection.drop();
+
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    mongocxx::options::insert insert_options;
+    insert_options.ordered(false);
+
+    QElapsedTimer timer;
+    timer.start();
+    std::vector<bsoncxx::document::value> batch;
+    batch.reserve(kSeedBatch);
+    for (std::int64_t seq = 0; seq < options.seed; ++seq)
+    {
+        const auto ts = std::chrono::milliseconds(1'735'689'600'000 + seq);
+        batch.push_back(make_document(kvp("seq", seq), kvp("value", dist(rng)),
+                                      kvp("name", "row-" + std::to_string(seq)),
+                                      kvp("ts", bsoncxx::types::b_date(ts))));
+        if (static_cast<int>(batch.size()) == kSeedBatch || seq + 1 == options.seed)
+        {
+            collection.insert_many(batch, insert_options);
+            batch.clear();
+        }
+    }
+    collection.create_index(make_document(kvp("value", 1), kvp("_id", 1)));
+    printResult("seed: documents", static_cast<double>(options.seed), "docs");
+    printResult("seed: insert and index time", timer.elapsed() / 1e3, "s");
+}
+
+/**
+ * @brief Process the events of this thread until `done()` or the timeout. Returns the time waited in milliseconds.
+ */
+double waitUntil(const std::function<bool()>& done, int timeout_ms = kMongoTimeoutMs)
+{
+    QElapsedTimer timer;
+    timer.start();
+    QTimer wake;   // Wakes the blocking wait up to check the timeout.
+    wake.start(100);
+    while (!done() && timer.elapsed() < timeout_ms)
+        QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+    return timer.nsecsElapsed() / 1e6;
+}
+
+/**
+ * @brief Run the event loop of this thread for `ms` milliseconds.
+ */
+void idle(int ms)
+{
+    QEventLoop loop;
+    QTimer::singleShot(ms, &loop, &QEventLoop::quit);
+    loop.exec();
+}
+
+/**
+ * @brief Rows [first, last) loaded or past the end of the query.
+ */
+bool rowsReady(const MongoTableModel& model, int first, int last)
+{
+    for (int row = first; row < last; ++row)
+    {
+        if (!model.isRowLoaded(row) && !(row >= model.rowCount() && model.atEnd()))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Ask for the visible rows like a view does: data() of each row, fetchMore() when reaching the bottom.
+ */
+void touchRows(MongoTableModel& model, int first, int last)
+{
+    if (last >= model.rowCount() && model.canFetchMore(QModelIndex()))
+        model.fetchMore(QModelIndex());
+    for (int row = first; row < std::min(last, model.rowCount()); ++row)
+        model.data(model.index(row, 0));
+}
+
+/**
+ * @brief Time from setQuery() to the first visible rows, in milliseconds.
+ */
+double timeToFirstRows(MongoTableModel& model, const MongoTableQuery& query)
+{
+    QElapsedTimer timer;
+    timer.start();
+    model.setQuery(query);
+    model.fetchMore(QModelIndex());
+    waitUntil([&model]() { return rowsReady(model, 0, kViewportRows); });
+    return timer.nsecsElapsed() / 1e6;
+}
+
+/**
+ * @brief Time-to-first-row, scroll latency and cache behaviour of the MongoTableModel on a large collection.
+ */
+void benchMongoTable(const MongoBenchOptions& options)
+{
+    if (options.uri.empty())
+    {
+        std::cout << "[Mongo table model] skipped (--mongo <uri> [--seed <docs>] to run it)" << std::endl;
+        return;
+    }
+
+    if (options.seed > 0)
+        seedCollection(options);
+
+    BenchReport::instance().beginSection("Mongo table model");
+    std::cout << "[Mongo table model] " << options.database << "." << options.collection << ", viewport "
+              << kViewportRows << " rows" << std::endl;
+
+    MongoTableQuery query;
+    query.uri = QString::fromStdString(options.uri);
+    query.database = QString::fromStdString(options.database);
+    query.collection = QString::fromStdString(options.collection);
+    query.fields = QStringList{"seq", "value", "name", "ts"};
+
+    MongoTableModel model;
+    printResult("time to first rows (_id order)", timeToFirstRows(model, query), "ms");
+
+    // Scroll down: only the steps whose rows were not prefetched wait.
+    std::vector<double> step_waits_ms;
+    int waited_steps = 0;
+    for (int step = 0; step < kScrollSteps; ++step)
+    {
+        const int first = step * kScrollStepRows;
+        touchRows(model, first, first + kViewportRows);
+        const auto visible_ready = [&]() { return rowsReady(model, first, first + kViewportRows); };
+        const bool ready = visible_ready();
+        step_waits_ms.push_back(ready ? 0.0 : waitUntil(visible_ready));
+        waited_steps += !ready;
+        idle(kScrollStepMs);
+    }
+    printLatencies("scroll step wait ", step_waits_ms);
+    printResult("scroll steps that waited for the server", waited_steps, "steps");
+    printResult("rows inserted after scrolling", model.rowCount(), "rows");
+
+    // Jumps back to rows evicted from the window.
+    std::mt19937 rng(7);
+    std::vector<double> jump_waits_ms;
+    const std::uint64_t misses_before = model.cacheMisses();
+    for (int jump = 0; jump < kRandomJumps; ++jump)
+    {
+        const int first = std::uniform_int_distribution<int>(0, std::max(model.rowCount() - kViewportRows, 0))(rng);
+        touchRows(model, first, first + kViewportRows);
+        jump_waits_ms.push_back(waitUntil([&]() { return rowsReady(model, first, first + kViewportRows); }));
+    }
+    printLatencies("random jump wait ", jump_waits_ms);
+    printResult("random jump cache misses", static_cast<double>(model.cacheMisses() - misses_before), "cells");
+
+    const LatencyHistogram& pages = model.pageLatency();
+    printResult("page round trip p50", pages.percentileNs(0.5) / 1e6, "ms");
+    printResult("page round trip p99", pages.percentileNs(0.99) / 1e6, "ms");
+    printResult("pages read", static_cast<double>(pages.count()), "pages");
+
+    // Sort and filter pushed down to the server.
+    MongoTableQuery sorted = query;
+    sorted.sort_field = "value";
+    sorted.sort_order = Qt::DescendingOrder;
+    printResult("time to first rows (sorted by value desc)", timeToFirstRows(model, sorted), "ms");
+
+    MongoTableQuery filtered = query;
+    filtered.filter = R"({"value": {"$gt": 0.999}})";
+    printResult("time to first rows (filter value > 0.999)", timeToFirstRows(model, filtered), "ms");
+}
+
+/**
+ * @brief Fetch more rows like a view scrolled to the bottom. Returns the row count.
+ */
+int followBottom(MongoTableModel& model)
+{
+    if (model.canFetchMore(QModelIndex()))
+        model.fetchMore(QModelIndex());
+    return model.rowCount();
+}
+
+/**
+ * @brief Latency from insert_one to rowsInserted() and burst throughput of the live tail of the MongoTableModel.
+ *
+ * The documents carry their insertion time (sent_ns), read back from the inserted rows. Needs a replica set.
+ */
+void benchMongoLiveTail(const MongoBenchOptions& options)
+{
+    if (options.uri.empty())
+    {
+        std::cout << "[Mongo live tail] skipped (--mongo <uri> of a replica set to run it)" << std::endl;
+        return;
+    }
+
+    using bsoncxx::builder::basic::kvp;
+    using bsoncxx::builder::basic::make_document;
+
+    BenchReport::instance().beginSection("Mongo live tail");
+    std::cout << "[Mongo live tail] " << options.database << "." << kLiveCollection << ", " << kLiveInsertRate
+              << " inserts/s for " << kLiveSeconds << " s, then a burst of " << kLiveBurstDocs << std::endl;
+
+    {
+        mongocxx::client client{mongocxx::uri{options.uri}};
+        client[options.database][kLiveCollection].drop();
+    }
+
+    MongoTableQuery query;
+    query.uri = QString::fromStdString(options.uri);
+    query.database = QString::fromStdString(options.database);
+    query.collection = kLiveCollection;
+    query.fields = QStringList{"seq", "sent_ns"};
+
+    MongoTableConfig config;
+    config.live_tail = true;
+    MongoTableModel model(config);
+    model.setQuery(query);
+    model.fetchMore(QModelIndex());
+    waitUntil([&model]() { return model.atEnd() && model.isLive(); });
+    if (!model.isLive())
+    {
+        std::cerr << "[ERROR] Live tail not started (change streams need a replica set)." << std::endl;
+        return;
+    }
+
+    // Insert time to row insertion, from the sent_ns column of the new rows.
+    LatencyHistogram row_latency;
+    QObject::connect(&model, &QAbstractItemModel::rowsInserted, [&model, &row_latency](const QModelIndex&, int first,
+                                                                                        int last)
+    {
+        const std::int64_t now_ns = ChangeStreamConsumer::nowNs();
+        for (int row = first; row <= last; ++row)
+            row_latency.record(now_ns - model.data(model.index(row, 1)).toLongLong());
+    });
+
+    // Inserter thread, errors are reported and end the inserts.
+    auto insert = [&options](auto&& body)
+    {
+        return std::thread([&options, body]()
+        {
+            try
+            {
+                mongocxx::client client{mongocxx::uri{options.uri}};
+                mongocxx::collection collection = client[options.database][kLiveCollection];
+                body(collection);
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << "[ERROR] Live tail inserts: " << e.what() << std::endl;
+            }
+        });
+    };
+
+    // Steady rate.
+    const std::uint64_t tail_pages_before = model.pageLatency().count();
+    std::thread inserter = insert([](mongocxx::collection& collection)
+    {
+        const auto period = std::chrono::nanoseconds(1'000'000'000 / kLiveInsertRate);
+        auto next = std::chrono::steady_clock::now();
+        for (std::int64_t seq = 0; seq < kLiveInsertRate * kLiveSeconds; ++seq)
+        {
+            collection.insert_one(make_document(kvp("seq", seq), kvp("sent_ns", ChangeStreamConsumer::nowNs())));
+            next += period;
+            std::this_thread::sleep_until(next);
+        }
+    });
+    waitUntil([&model]() { return followBottom(model) >= kLiveInsertRate * kLiveSeconds; });
+    inserter.join();
+
+    printResult("steady: rows inserted", model.rowCount(), "rows");
+    printResult("steady: insert to row p50", row_latency.percentileNs(0.50) / 1e6, "ms");
+    printResult("steady: insert to row p99", row_latency.percentileNs(0.99) / 1e6, "ms");
+    printResult("steady: insert to row max", row_latency.maxNs() / 1e6, "ms");
+    printResult("steady: event to row p99", model.liveLatency().percentileNs(0.99) / 1e6, "ms");
+    printResult("steady: tail pages read", static_cast<double>(model.pageLatency().count() - tail_pages_before),
+                "pages");
+
+    // Burst.
+    const int rows_before = model.rowCount();
+    row_latency.reset();
+    QElapsedTimer timer;
+    timer.start();
+    inserter = insert([](mongocxx::collection& collection)
+    {
+        mongocxx::options::insert insert_options;
+        insert_options.ordered(false);
+        std::vector<bsoncxx::document::value> batch;
+        batch.reserve(kLiveInsertBatch);
+        for (std::int64_t seq = 0; seq < kLiveBurstDocs; ++seq)
+        {
+            batch.push_back(make_document(kvp("seq", seq), kvp("sent_ns", ChangeStreamConsumer::nowNs())));
+            if (static_cast<int>(batch.size()) == kLiveInsertBatch || seq + 1 == kLiveBurstDocs)
+            {
+                collection.insert_many(batch, insert_options);
+                batch.clear();
+            }
+        }
+    });
+    waitUntil([&model, rows_before]() { return followBottom(model) - rows_before >= kLiveBurstDocs; });
+    const double seconds = timer.nsecsElapsed() / 1e9;
+    inserter.join();
+
+    printResult("burst: rows inserted", model.rowCount() - rows_before, "rows");
+    printResult("burst: insert to row throughput", (model.rowCount() - rows_before) / seconds, "rows/s");
+    printResult("burst: insert to row p99", row_latency.percentileNs(0.99) / 1e6, "ms");
+    printResult("live events received", static_cast<double>(model.liveEvents()), "events");
+}
+
+/**
+ * @brief Shutdown: model cleanup under the coordinator, the deadline with a step ignoring it and the App exit time.
+ *
+ * The exit time runs App_HelloWorldQtMV (next to this executable, offscreen) with --quit-after and measures from the
+ * window close (its "[Model] requestStop" line) to the process end.
+ * @return False if a budget is exceeded.
+ */
+bool benchShutdown(std::chrono::milliseconds budget)
+{
+    BenchReport::instance().beginSection("Shutdown");
+    std::cout << "[Shutdown] budget " << budget.count() << " ms" << std::endl;
+    bool ok = true;
+
+    // Model cleanup (five 1 s steps, 5 s in sequence) with long actions still running.
+    {
+        QThread model_thread;
+        Model* model = new Model;
+        model->moveToThread(&model_thread);
+        model_thread.start();
+        for (int i = 0; i < kConcurrentLongActions; ++i)
+            QMetaObject::invokeMethod(model, &Model::longActionReq, Qt::QueuedConnection);
+        QThread::msleep(100);
+
+        ShutdownCoordinator shutdown(budget);
+        model->addShutdownSteps(shutdown);
+        shutdown.addStep("model.thread", [&model_thread](const CancellationToken& token)
+        {
+            model_thread.quit();
+            while (!model_thread.wait(10) && !token.isCancelled())
+            {}
+        }, {"model.close_db_client", "model.flush_logs", "model.release_buffers"});
+        const bool clean = shutdown.run();
+        std::cout << shutdown.summary();
+        ok &= checkBudget("model cleanup", shutdown.elapsedNs() / 1e6, budget.count()) && clean;
+
+        // Abandoned steps were cancelled, they end soon.
+        model_thread.quit();
+        model_thread.wait();
+        delete model;
+    }
+
+    // A step ignoring the token: run() must return at the deadline, not when the step ends.
+    {
+        const std::chrono::milliseconds deadline(200);
+        ShutdownCoordinator shutdown(deadline);
+        shutdown.addStep("stuck", [](const CancellationToken&)
+        {
+            std::this_thread::sleep_for(std::chrono::seconds(2));
+        });
+        shutdown.addStep("after_stuck", [](const CancellationToken&) {}, {"stuck"});
+        shutdown.addStep("independent", [](const CancellationToken& token)
+        {
+            token.waitFor(std::chrono::milliseconds(50));
+        });
+        const bool clean = shutdown.run();
+        const std::vector<ShutdownStepReport> report = shutdown.report();
+        const bool states = report[0].state == ShutdownStepState::Running
+                         && report[1].state == ShutdownStepState::Pending
+                         && report[2].state == ShutdownStepState::Done;
+        ok &= checkBudget("deadline with a stuck step", shutdown.elapsedNs() / 1e6, deadline.count() + 50.0);
+        std::cout << "  " << (!clean && states ? "PASS" : "FAIL") << ": stuck step abandoned, others reported"
+                  << std::endl;
+        ok &= !clean && states;
+    }
+
+    // Time to process exit of the App.
+    const QString app_path = QStandardPaths::findExecutable("App_HelloWorldQtMV",
+                                                            {QCoreApplication::applicationDirPath()});
+    if (app_path.isEmpty())
+    {
+        std::cout << "  App_HelloWorldQtMV not found next to the benchmark, exit time skipped." << std::endl;
+        return ok;
+    }
+
+    QProcess process;
+    QProcessEnvironment environment = QProcessEnvironment::systemEnvironment();
+    environment.insert("QT_QPA_PLATFORM", "offscreen");
+    process.setProcessEnvironment(environment);
+    process.setProcessChannelMode(QProcess::MergedChannels);
+    process.start(app_path, {"--quit-after", QString::number(kQuitAfterMs),
+                             "--shutdown-budget", QString::number(static_cast<qint64>(budget.count()))});
+    if (!process.waitForStarted(kProcessTimeoutMs))
+    {
+        std::cout << "  FAIL: App_HelloWorldQtMV did not start: " << process.errorString().toStdString() << std::endl;
+        return false;
+    }
+
+    QElapsedTimer clock;
+    clock.start();
+    QByteArray output;
+    qint64 close_ns = -1;
+    while (process.state() != QProcess::NotRunning && clock.elapsed() < kProcessTimeoutMs)
+    {
+        process.waitForReadyRead(5);
+        output += process.readAll();
+        if (close_ns < 0 && output.contains("[Model] requestStop"))
+            close_ns = clock.nsecsElapsed();
+    }
+    const qint64 exit_ns = clock.nsecsElapsed();
+    if (process.state() != QProcess::NotRunning)
+    {
+        process.kill();
+        process.waitForFinished();
+        std::cout << "  FAIL: App_HelloWorldQtMV still running after " << kProcessTimeoutMs << " ms" << std::endl;
+        return false;
+    }
+    if (close_ns < 0 || process.exitStatus() != QProcess::NormalExit || process.exitCode() != 0)
+    {
+        std::cout << "  FAIL: App_HelloWorldQtMV exit code " << process.exitCode() << ", output:\n"
+                  << output.toStdString() << std::endl;
+        return false;
+    }
+
+    ok &= checkBudget("App window close -> process exit", (exit_ns - close_ns) / 1e6, budget.count());
+    return ok;
+}
+
+/**
+ * @brief Main entry point of the Bench_HelloWorldQtMV application.
+ *
+ * Usage: Bench_HelloWorldQtMV [--mongo <uri> [--seed <docs>]] [--shutdown-budget <ms>] [--json <file>]
+ *
+ * The live tail benchmark of --mongo needs a replica set (change streams).
+ */
+int main(int argc, char** argv)
+{
+    std::cout << "==================================" << std::endl;
+    std::cout << "= HELLO WORLD QTMV BENCHMARKS    =" << std::endl;
+    std::cout << "==================================" << std::endl;
+
+    QCoreApplication app(argc, argv);
+
+    MongoBenchOptions mongo_options;
+    std::chrono::milliseconds shutdown_budget(kShutdownBudgetMs);
+    std::string json_path;
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        const std::string_view arg(argv[i]);
+        if (arg == "--mongo")
+            mongo_options.uri = argv[++i];
+        else if (arg == "--seed")
+            mongo_options.seed = std::stoll(argv[++i]);
+        else if (arg == "--shutdown-budget")
+            shutdown_budget = std::chrono::milliseconds(std::stoll(argv[++i]));
+        else if (arg == "--json")
+            json_path = argv[++i];
+    }
+    BenchReport::instance().setSuite("HelloWorldQtMV");
+
+    benchCoalescing();
+    const bool latency_ok = benchShortActionLatency();
+    // The driver instance is unique per process.
+    mongocxx::instance mongo_instance{};
+    benchMongoTable(mongo_options);
+    benchMongoLiveTail(mongo_options);
+    const bool shutdown_ok = benchShutdown(shutdown_budget);
+
+    if (!json_path.empty() && !BenchReport::instance().writeJson(json_path))
+        return 1;
+
+    // All ok.
+    return shutdown_ok && latency_ok ? 0 : 1;
+}
+
+// =====================================================================================================================
@@ -7,13 +7,25 @@
 #include <QThread>
 
 #include "model.h"
+#include "shutdown_coordinator.h"
 
 Model::Model(QObject *parent) : 
 	QObject{parent},
     var1_("Empty"),
     var2_("Empty"),
-	stop_req_(false)
-{}
+	stop_req_(false),
+    executor_(new TaskExecutor(0, this))
+{
+    // The executor emits from its pool threads, the results come back to the model thread queued.
+    QObject::connect(this->executor_, &TaskExecutor::taskProgress, this, &Model::onLongActionProgress,
+                     Qt::QueuedConnection);
+    QObject::connect(this->executor_, &TaskExecutor::taskFinished, this, &Model::onLongActionFinished,
+                     Qt::QueuedConnection);
+    QObject::connect(this->executor_, &TaskExecutor::taskCanceled, this, &Model::onLongActionCanceled,
+                     Qt::QueuedConnection);
+    QObject::connect(this->executor_, &TaskExecutor::taskFailed, this, &Model::onLongActionFailed,
+                     Qt::QueuedConnection);
+}
 
 void Model::shortActionReq()
 {
@@ -30,32 +42,41 @@ void Model::longActionReq()
 {
 	std::cout << "[Model] longActionReq" << std::endl << std::flush;
 
+    if (this->shouldStop())
+        return;
+
     emit statusTextChanged("Processing long action...");
 
-	// Cancelable wait
-    for (int i = 0; i < 50; ++i) 
-	{
-        if (this->shouldStop()) 
-		{
-            emit statusTextChanged("Canceled.");
-			std::cout << "[Model] longActionReq -> canceled" << std::endl << std::flush;
-            return;
+    // Runs on the executor pool, the model thread stays free for the short actions.
+    this->executor_->submit([](TaskContext &context) -> QVariant
+    {
+        // Cancelable wait (wakes up as soon as the token is cancelled).
+        for (int i = 0; i < 50; ++i)
+        {
+            if (context.token().waitFor(std::chrono::milliseconds(100)))
+                return QVariant();
+            context.reportProgress((i + 1) * 2);
         }
-        QThread::msleep(100);
-    }
 
+        static thread_local std::mt19937 rng{std::random_device{}()};
+        std::uniform_int_distribution<int> dist(0, 999999);
+        return QStringList{QString::number(dist(rng)), QString::number(dist(rng))};
+    });
+}
 
-    static thread_local std::mt19937 rng{std::random_device{}()};
-    std::uniform_int_distribution<int> dist(0, 999999);
-    var1_ = QString::number(std::rand());
-    var2_ = QString::number(std::rand());
-	
-	if (shouldStop()) 
-	{  
-        emit statusTextChanged("Canceled.");
-		std::cout << "[Model] longActionReq -> canceled" << std::endl << std::flush;
+void Model::onLongActionProgress(TaskId, int percent, const QString &)
+{
+    emit statusTextChanged(QString("Processing long action... %1%").arg(percent));
+}
+
+void Model::onLongActionFinished(TaskId, const QVariant &result)
+{
+    const QStringList values = result.toStringList();
+    if (values.size() != 2)
         return;
-    }
+
+    var1_ = values[0];
+    var2_ = values[1];
 
     emit var1TextChanged(var1_);
     emit var2TextChanged(var2_);
@@ -63,24 +84,58 @@ void Model::longActionReq()
     emit statusTextChanged("Waiting user input...");
 }
 
+void Model::onLongActionCanceled(TaskId)
+{
+    std::cout << "[Model] longActionReq -> canceled" << std::endl << std::flush;
+    emit statusTextChanged("Canceled.");
+}
+
+void Model::onLongActionFailed(TaskId, const QString &error)
+{
+    std::cout << "[Model] longActionReq -> failed: " << error.toStdString() << std::endl << std::flush;
+    emit statusTextChanged(QString("Long action failed: %1").arg(error));
+}
+
 void Model::requestStop() noexcept
 { 
 	std::cout << "[Model] requestStop" << std::endl << std::flush;
 	stop_req_.store(true, std::memory_order_relaxed); 
+    executor_->cancelAll();
 }
 
 Model::~Model() 
 {
-    std::cout << "[Model] Destructor started, simulating cleanup..." << std::endl << std::flush;
-    // Simulate a long cleanup (e.g. closing resources)
-    for (int i = 1; i <= 5; ++i)
-    {
-        std::cout << "[Model] Cleaning step" << i << std::endl << std::flush;
-		std::this_thread::sleep_for(std::chrono::seconds(1));
-    }
+    // The resources are released by the shutdown steps (see addShutdownSteps).
     std::cout << "[Model] Destructor finished." << std::endl << std::flush;
 }
 
+void Model::addShutdownSteps(ShutdownCoordinator &coordinator)
+{
+    // Simulated cleanup of 1 s per resource (e.g. DB client, log flush), waiting on the token to honour the deadline.
+    const auto simulate = [](const char *name)
+    {
+        return [name](const CancellationToken &token)
+        {
+            std::cout << "[Model] Cleaning " << name << std::endl << std::flush;
+            token.waitFor(std::chrono::seconds(1));
+        };
+    };
+
+    // Long actions first: their results are flushed, then the client they use is closed.
+    coordinator.addStep("model.cancel_tasks", [this](const CancellationToken &token)
+    {
+        this->requestStop();
+        while (this->executor_->activeTasks() > 0 && !token.waitFor(std::chrono::milliseconds(5)))
+        {}
+    });
+    coordinator.addStep("model.flush_results", simulate("results"), {"model.cancel_tasks"});
+    coordinator.addStep("model.close_db_client", simulate("DB client"), {"model.flush_results"});
+
+    // Independent resources.
+    coordinator.addStep("model.flush_logs", simulate("logs"));
+    coordinator.addStep("model.release_buffers", simulate("buffers"));
+}
+
 bool Model::shouldStop() const noexcept
 {
     return stop_req_.load(std::memory_order_relaxed)
@@ -6,6 +6,10 @@
 
 #include <QDebug>
 
+#include "task_executor.h"
+
+class ShutdownCoordinator;
+
 class Model : public QObject
 {
     Q_OBJECT
@@ -16,6 +20,12 @@ public:
 	
 	~Model();
 
+    /**
+     * @brief Add the model cleanup to the shutdown coordinator (the steps are thread-safe, the model thread may
+     * already be stopped). The model must outlive the coordinator run.
+     */
+    void addShutdownSteps(ShutdownCoordinator &coordinator);
+
 public slots:
 
     void shortActionReq();
@@ -23,6 +33,16 @@ public slots:
     void longActionReq();
 	
     void requestStop() noexcept;
+
+private slots:
+
+    void onLongActionProgress(TaskId id, int percent, const QString &message);
+
+    void onLongActionFinished(TaskId id, const QVariant &result);
+
+    void onLongActionCanceled(TaskId id);
+
+    void onLongActionFailed(TaskId id, const QString &error);
 	
 signals:
 
@@ -37,4 +57,5 @@ private:
     QString var1_;
     QString var2_;
 	std::atomic_bool stop_req_;
+    TaskExecutor* executor_;
 };
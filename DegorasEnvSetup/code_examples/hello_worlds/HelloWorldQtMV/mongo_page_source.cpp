@@ -0,0 +1,355 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <exception>
+#include <iterator>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// QT INCLUDES
+#include <QDateTime>
+#include <QTimeZone>
+
+// BSONCXX INCLUDES
+#include <bsoncxx/builder/basic/array.hpp>
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/json.hpp>
+#include <bsoncxx/types.hpp>
+#include <bsoncxx/types/bson_value/value.hpp>
+
+// MONGOCXX INCLUDES
+#include <mongocxx/client.hpp>
+#include <mongocxx/options/find.hpp>
+#include <mongocxx/uri.hpp>
+
+// PROJECT INCLUDES
+#include "mongo_page_source.h"
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_array;
+using bsoncxx::builder::basic::make_document;
+
+namespace
+{
+
+/**
+ * @brief Element at a dotted path ("a.b.c"), invalid if a part is missing or not a subdocument.
+ */
+bsoncxx::document::element lookup(bsoncxx::document::view doc, std::string_view path)
+{
+    while (true)
+    {
+        const std::size_t dot = path.find('.');
+        const bsoncxx::document::element element = doc[path.substr(0, dot)];
+        if (dot == std::string_view::npos || !element)
+            return element;
+        if (element.type() != bsoncxx::type::k_document)
+            return bsoncxx::document::element();
+        doc = element.get_document().value;
+        path.remove_prefix(dot + 1);
+    }
+}
+
+/**
+ * @brief Cell value of an element. Subdocuments and arrays are shown as JSON.
+ */
+QVariant toVariant(const bsoncxx::document::element& element)
+{
+    if (!element)
+        return QVariant();
+
+    switch (element.type())
+    {
+    case bsoncxx::type::k_string:
+    {
+        const std::string_view value = element.get_string().value;
+        return QString::fromUtf8(value.data(), static_cast<qsizetype>(value.size()));
+    }
+    case bsoncxx::type::k_int32:
+        return element.get_int32().value;
+    case bsoncxx::type::k_int64:
+        return static_cast<qlonglong>(element.get_int64().value);
+    case bsoncxx::type::k_double:
+        return element.get_double().value;
+    case bsoncxx::type::k_bool:
+        return element.get_bool().value;
+    case bsoncxx::type::k_date:
+        return QDateTime::fromMSecsSinceEpoch(element.get_date().value.count(), QTimeZone::UTC);
+    case bsoncxx::type::k_oid:
+        return QString::fromStdString(element.get_oid().value.to_string());
+    case bsoncxx::type::k_document:
+        return QString::fromStdString(bsoncxx::to_json(element.get_document().value));
+    case bsoncxx::type::k_array:
+        return QString::fromStdString(bsoncxx::to_json(element.get_array().value));
+    default:
+        return QVariant();
+    }
+}
+
+/**
+ * @brief Position of a BSON type in the sort order of the server (numbers and strings compare across their types),
+ * -1 for the types without a documented place. Null and missing fields sort together.
+ */
+int sortRank(bsoncxx::type type)
+{
+    switch (type)
+    {
+    case bsoncxx::type::k_minkey:
+        return 0;
+    case bsoncxx::type::k_null:
+    case bsoncxx::type::k_undefined:
+        return 1;
+    case bsoncxx::type::k_int32:
+    case bsoncxx::type::k_int64:
+    case bsoncxx::type::k_double:
+    case bsoncxx::type::k_decimal128:
+        return 2;
+    case bsoncxx::type::k_string:
+    case bsoncxx::type::k_symbol:
+        return 3;
+    case bsoncxx::type::k_document:
+        return 4;
+    case bsoncxx::type::k_array:
+        return 5;
+    case bsoncxx::type::k_binary:
+        return 6;
+    case bsoncxx::type::k_oid:
+        return 7;
+    case bsoncxx::type::k_bool:
+        return 8;
+    case bsoncxx::type::k_date:
+        return 9;
+    case bsoncxx::type::k_timestamp:
+        return 10;
+    case bsoncxx::type::k_regex:
+        return 11;
+    case bsoncxx::type::k_maxkey:
+        return 12;
+    default:
+        return -1;
+    }
+}
+
+/**
+ * @brief $type aliases of each sort rank (the null rank is matched with {field: null}, which also takes missing).
+ */
+constexpr const char* kRankTypes[][2] = {{"minKey", nullptr}, {nullptr, nullptr}, {"number", nullptr},
+                                         {"string", "symbol"}, {"object", nullptr}, {"array", nullptr},
+                                         {"binData", nullptr}, {"objectId", nullptr}, {"bool", nullptr},
+                                         {"date", nullptr}, {"timestamp", nullptr}, {"regex", nullptr},
+                                         {"maxKey", nullptr}};
+
+constexpr int kNullRank = 1;
+
+/**
+ * @brief Conditions (to join with $or) matching the values of `field` strictly after `key` in the sort `direction`.
+ *
+ * Query comparisons only match values of the key type ({$gt: null} matches nothing), so the other types that sort
+ * after the key are matched by their $type, and null or missing ones by {field: null}.
+ */
+void appendAfter(bsoncxx::builder::basic::array& conditions, const std::string& field,
+                 const bsoncxx::types::bson_value::view& key, int direction)
+{
+    const int rank = sortRank(key.type());
+    if (rank != kNullRank)
+        conditions.append(make_document(kvp(field, make_document(kvp(direction > 0 ? "$gt" : "$lt", key)))));
+    if (rank < 0)
+        return;
+
+    bsoncxx::builder::basic::array types;
+    bool any_type = false;
+    const int count = static_cast<int>(std::size(kRankTypes));
+    for (int r = direction > 0 ? rank + 1 : 0; r < (direction > 0 ? count : rank); ++r)
+    {
+        for (const char* type : kRankTypes[r])
+        {
+            if (type)
+            {
+                types.append(type);
+                any_type = true;
+            }
+        }
+    }
+    if (any_type)
+        conditions.append(make_document(kvp(field, make_document(kvp("$type", types.extract())))));
+    if (direction < 0 && rank > kNullRank)
+        conditions.append(make_document(kvp(field, bsoncxx::types::b_null{})));
+}
+
+/**
+ * @brief Owning copy of an element value, null if missing.
+ */
+bsoncxx::types::bson_value::value ownedValue(const bsoncxx::document::element& element)
+{
+    if (!element)
+        return bsoncxx::types::bson_value::value(bsoncxx::types::b_null{});
+    return bsoncxx::types::bson_value::value(element.get_value());
+}
+
+} // namespace
+
+/**
+ * @brief Driver objects and query state, only touched from the source thread.
+ */
+struct MongoPageSource::State
+{
+    /**
+     * @brief Sort key and _id of the last row of a page.
+     */
+    struct Boundary
+    {
+        bsoncxx::types::bson_value::value key;
+        bsoncxx::types::bson_value::value id;
+    };
+
+    std::string uri;
+    std::optional<mongocxx::client> client;
+    std::optional<mongocxx::collection> collection;
+    quint64 generation = 0;
+    std::vector<std::string> fields;
+    std::string sort_field;
+    int direction = 1;
+    std::optional<bsoncxx::document::value> filter;
+    std::optional<bsoncxx::document::value> projection;
+    std::optional<bsoncxx::document::value> sort;
+    std::vector<Boundary> boundaries;   ///< boundaries[p]: last row of page p (full pages only).
+
+    /**
+     * @brief Filter of page `page`: the query filter, after the last row of the previous page.
+     */
+    bsoncxx::document::value pageFilter(int page) const
+    {
+        if (page == 0)
+            return bsoncxx::document::value(this->filter->view());
+
+        const Boundary& after = this->boundaries[static_cast<std::size_t>(page - 1)];
+        bsoncxx::builder::basic::array id_after;
+        appendAfter(id_after, "_id", after.id.view(), this->direction);
+        if (this->sort_field == "_id")
+            return make_document(kvp("$and", make_array(this->filter->view(),
+                                                        make_document(kvp("$or", id_after.extract())))));
+
+        // Rows after the boundary: key after it, or same key (null also matches missing) and _id after it.
+        bsoncxx::builder::basic::array key_after;
+        appendAfter(key_after, this->sort_field, after.key.view(), this->direction);
+        key_after.append(make_document(kvp(this->sort_field, after.key.view()), kvp("$or", id_after.extract())));
+        return make_document(kvp("$and", make_array(this->filter->view(),
+                                                    make_document(kvp("$or", key_after.extract())))));
+    }
+};
+
+// =====================================================================================================================
+
+MongoPageSource::MongoPageSource(int page_size, QObject* parent) :
+    QObject(parent),
+    page_size_(page_size > 0 ? page_size : 1),
+    state_(std::make_unique<State>())
+{}
+
+MongoPageSource::~MongoPageSource() = default;
+
+void MongoPageSource::setQuery(quint64 generation, const MongoTableQuery& query)
+{
+    State& state = *this->state_;
+    state.generation = generation;
+    state.collection.reset();
+    state.boundaries.clear();
+
+    try
+    {
+        // The client is reused while the URI does not change.
+        const std::string uri = query.uri.toStdString();
+        if (!state.client || state.uri != uri)
+        {
+            state.client.emplace(mongocxx::uri{uri});
+            state.uri = uri;
+        }
+
+        state.fields.clear();
+        for (const QString& field : query.fields)
+            state.fields.push_back(field.toStdString());
+        state.sort_field = query.sort_field.isEmpty() ? std::string("_id") : query.sort_field.toStdString();
+        state.direction = query.sort_order == Qt::AscendingOrder ? 1 : -1;
+
+        // Only the columns and the sort key travel from the server.
+        std::set<std::string> projected(state.fields.begin(), state.fields.end());
+        projected.insert(state.sort_field);
+        bsoncxx::builder::basic::document projection;
+        for (const std::string& field : projected)
+            projection.append(kvp(field, 1));
+
+        bsoncxx::builder::basic::document sort;
+        sort.append(kvp(state.sort_field, state.direction));
+        if (state.sort_field != "_id")
+            sort.append(kvp("_id", state.direction));
+
+        state.filter.emplace(bsoncxx::from_json(query.filter.isEmpty() ? "{}" : query.filter.toStdString()));
+        state.projection.emplace(projection.extract());
+        state.sort.emplace(sort.extract());
+        state.collection.emplace(
+            (*state.client)[query.database.toStdString()][query.collection.toStdString()]);
+    }
+    catch (const std::exception& e)
+    {
+        emit this->queryFailed(generation, QString::fromStdString(e.what()));
+    }
+}
+
+void MongoPageSource::fetchPage(quint64 generation, int page)
+{
+    State& state = *this->state_;
+
+    // Stale request, failed query, or a page whose previous one was never read (or was the last one).
+    if (generation != state.generation || !state.collection || page < 0
+        || static_cast<std::size_t>(page) > state.boundaries.size())
+        return;
+
+    MongoPage result;
+    result.generation = generation;
+    result.page = page;
+    result.rows.reserve(this->page_size_);
+
+    try
+    {
+        mongocxx::options::find options;
+        options.projection(state.projection->view());
+        options.sort(state.sort->view());
+        options.limit(this->page_size_);
+        options.batch_size(this->page_size_);
+
+        mongocxx::cursor cursor = state.collection->find(state.pageFilter(page).view(), options);
+        for (const bsoncxx::document::view& doc : cursor)
+        {
+            MongoRow row;
+            row.reserve(static_cast<qsizetype>(state.fields.size()));
+            for (const std::string& field : state.fields)
+                row.append(toVariant(lookup(doc, field)));
+            result.rows.append(std::move(row));
+
+            // Position of the next page, taken from the last row of a full page.
+            if (result.rows.size() == this->page_size_ && static_cast<std::size_t>(page) == state.boundaries.size())
+                state.boundaries.push_back({ownedValue(lookup(doc, state.sort_field)), ownedValue(doc["_id"])});
+        }
+    }
+    catch (const std::exception& e)
+    {
+        emit this->queryFailed(generation, QString::fromStdString(e.what()));
+        return;
+    }
+
+    emit this->pageReady(result);
+}
+
+// =====================================================================================================================
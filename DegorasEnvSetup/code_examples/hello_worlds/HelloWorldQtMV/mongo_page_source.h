@@ -0,0 +1,106 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldQtMV – Page reader of a MongoDB collection (runs in a worker thread)
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <memory>
+
+// QT INCLUDES
+#include <QMetaType>
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+#include <QVector>
+
+/**
+ * @brief Collection, columns, filter and sort of a MongoTableModel. Filter and sort are evaluated by the server.
+ */
+struct MongoTableQuery
+{
+    QString uri = QStringLiteral("mongodb://localhost:27017");   ///< Server URI.
+    QString database;                                          ///< Database name.
+    QString collection;                                        ///< Collection name.
+    QStringList fields;                                        ///< Columns (top-level fields or dotted paths).
+    QString filter = QStringLiteral("{}");                     ///< Filter in (Extended) JSON.
+    QString sort_field;                                        ///< Sort key, empty for _id. Index it with _id.
+    Qt::SortOrder sort_order = Qt::AscendingOrder;             ///< Sort direction (also applied to _id).
+};
+
+/**
+ * @brief One row per document, one value per column (invalid QVariant if the field is missing).
+ */
+using MongoRow = QVariantList;
+
+/**
+ * @brief Page of decoded rows sent from the source thread to the model.
+ */
+struct MongoPage
+{
+    quint64 generation = 0;    ///< Query the page belongs to.
+    int page = 0;              ///< Page index.
+    QVector<MongoRow> rows;    ///< Decoded rows (fewer than the page size on the last page).
+};
+
+Q_DECLARE_METATYPE(MongoPage)
+
+/**
+ * @brief Reads pages of a query from MongoDB. Lives in a worker thread, its methods are invoked queued.
+ *
+ * Each page is one find() with a limit, positioned after the last (sort key, _id) of the previous page (keyset
+ * pagination), so reading page N costs the same as reading page 0 on an index on { sort key, _id }. The key of the
+ * last row of each full page is kept to reload any page already read; pages must be first read in order. Rows
+ * without the sort key and keys of mixed types follow the server sort order (array keys are not supported). A
+ * mongocxx::instance must be alive while it is used.
+ */
+class MongoPageSource : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    /**
+     * @param page_size Rows per page.
+     * @param parent Parent object.
+     */
+    explicit MongoPageSource(int page_size, QObject* parent = nullptr);
+
+    ~MongoPageSource() override;
+
+    /**
+     * @brief Replace the query. The pages of older generations are ignored from now on.
+     */
+    void setQuery(quint64 generation, const MongoTableQuery& query);
+
+    /**
+     * @brief Read a page of the current query and emit pageReady() (or queryFailed()).
+     */
+    void fetchPage(quint64 generation, int page);
+
+signals:
+
+    void pageReady(const MongoPage& page);
+
+    void queryFailed(quint64 generation, const QString& error);
+
+private:
+
+    struct State;
+
+    int page_size_;
+    std::unique_ptr<State> state_;
+};
+
+// =====================================================================================================================
@@ -0,0 +1,358 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
+// QT INCLUDES
+#include <QMetaObject>
+
+// PROJECT INCLUDES
+#include "mongo_table_model.h"
+
+MongoTableModel::MongoTableModel(const MongoTableConfig& config, QObject* parent) :
+    QAbstractTableModel(parent),
+    config_(config),
+    generation_(0),
+    row_count_(0),
+    at_end_(true),
+    last_page_(0),
+    hits_(0),
+    misses_(0),
+    source_(nullptr),
+    live_dirty_(false),
+    live_since_ns_(0),
+    live_events_(0)
+{
+    this->config_.page_size = std::max(this->config_.page_size, 1);
+    this->config_.prefetch_pages = std::max(this->config_.prefetch_pages, 0);
+
+    // The window must hold the visible page plus the prefetched ones in both directions.
+    const int min_rows = this->config_.page_size * (2 * this->config_.prefetch_pages + 2);
+    this->cache_.setMaxCost(std::max(this->config_.cache_rows, min_rows));
+    this->clock_.start();
+
+    qRegisterMetaType<MongoPage>();
+
+    // Source in its own thread, like the Model of the example.
+    this->source_ = new MongoPageSource(this->config_.page_size);
+    this->source_->moveToThread(&this->source_thread_);
+    QObject::connect(&this->source_thread_, &QThread::finished, this->source_, &QObject::deleteLater);
+    QObject::connect(this->source_, &MongoPageSource::pageReady, this, &MongoTableModel::onPageReady);
+    QObject::connect(this->source_, &MongoPageSource::queryFailed, this, &MongoTableModel::onQueryFailed);
+    this->source_thread_.start();
+}
+
+MongoTableModel::~MongoTableModel()
+{
+    this->live_.reset();
+    this->source_thread_.quit();
+    this->source_thread_.wait();
+}
+
+void MongoTableModel::setQuery(const MongoTableQuery& query)
+{
+    this->live_.reset();
+    this->live_dirty_ = false;
+    this->live_since_ns_ = 0;
+
+    this->beginResetModel();
+    ++this->generation_;
+    this->query_ = query;
+    this->row_count_ = 0;
+    this->at_end_ = query.collection.isEmpty();
+    this->cache_.clear();
+    this->pending_.clear();
+    this->last_page_ = 0;
+    this->endResetModel();
+
+    MongoPageSource* source = this->source_;
+    const quint64 generation = this->generation_;
+    QMetaObject::invokeMethod(source, [source, generation, query]()
+    {
+        source->setQuery(generation, query);
+    }, Qt::QueuedConnection);
+
+    // Live tail: new _id values sort after the last row only in ascending _id order.
+    if (this->config_.live_tail && !query.collection.isEmpty() && query.sort_field.isEmpty()
+        && query.sort_order == Qt::AscendingOrder)
+    {
+        ChangeStreamConfig stream;
+        stream.uri = query.uri.toStdString();
+        stream.database = query.database.toStdString();
+        stream.collection = query.collection.toStdString();
+        stream.pipeline = R"([{"$match": {"operationType": "insert"}}, {"$project": {"operationType": 1}}])";
+        this->live_ = std::make_unique<ChangeStreamConsumer>(stream);
+        this->live_->setNotifier([this]()
+        {
+            QMetaObject::invokeMethod(this, &MongoTableModel::onLiveEvents, Qt::QueuedConnection);
+        });
+        this->live_->start();
+    }
+}
+
+const MongoTableQuery& MongoTableModel::query() const noexcept
+{
+    return this->query_;
+}
+
+void MongoTableModel::setFilter(const QString& json)
+{
+    MongoTableQuery query = this->query_;
+    query.filter = json;
+    this->setQuery(query);
+}
+
+bool MongoTableModel::isRowLoaded(int row) const
+{
+    return row >= 0 && row < this->row_count_ && this->cache_.contains(row / this->config_.page_size);
+}
+
+bool MongoTableModel::atEnd() const noexcept
+{
+    return this->at_end_;
+}
+
+std::uint64_t MongoTableModel::cacheHits() const noexcept
+{
+    return this->hits_;
+}
+
+std::uint64_t MongoTableModel::cacheMisses() const noexcept
+{
+    return this->misses_;
+}
+
+const LatencyHistogram& MongoTableModel::pageLatency() const noexcept
+{
+    return this->page_latency_;
+}
+
+bool MongoTableModel::isLive() const noexcept
+{
+    return this->live_ && this->live_->isWatching();
+}
+
+std::uint64_t MongoTableModel::liveEvents() const noexcept
+{
+    return this->live_events_;
+}
+
+const LatencyHistogram& MongoTableModel::liveLatency() const noexcept
+{
+    return this->live_latency_;
+}
+
+int MongoTableModel::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : this->row_count_;
+}
+
+int MongoTableModel::columnCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : static_cast<int>(this->query_.fields.size());
+}
+
+QVariant MongoTableModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || (role != Qt::DisplayRole && role != Qt::EditRole))
+        return QVariant();
+
+    const int page = index.row() / this->config_.page_size;
+    this->prefetchFrom(page);
+
+    // object() also marks the page as the most recently used.
+    const QVector<MongoRow>* rows = this->cache_.object(page);
+    if (!rows)
+    {
+        ++this->misses_;
+        this->requestPage(page);
+        return QStringLiteral("...");
+    }
+
+    // A page read again can be shorter (deleted documents).
+    ++this->hits_;
+    const int offset = index.row() % this->config_.page_size;
+    if (offset >= rows->size())
+        return QVariant();
+    const MongoRow& row = rows->at(offset);
+    return index.column() < row.size() ? row.at(index.column()) : QVariant();
+}
+
+QVariant MongoTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (role != Qt::DisplayRole)
+        return QVariant();
+    if (orientation == Qt::Vertical)
+        return section + 1;
+    return section < this->query_.fields.size() ? QVariant(this->query_.fields.at(section)) : QVariant();
+}
+
+bool MongoTableModel::canFetchMore(const QModelIndex& parent) const
+{
+    return !parent.isValid() && !this->at_end_;
+}
+
+void MongoTableModel::fetchMore(const QModelIndex& parent)
+{
+    if (this->canFetchMore(parent))
+        this->requestPage(this->row_count_ / this->config_.page_size);
+}
+
+void MongoTableModel::sort(int column, Qt::SortOrder order)
+{
+    const QString field = column >= 0 && column < this->query_.fields.size() ? this->query_.fields.at(column)
+                                                                             : QString();
+    if (field == this->query_.sort_field && order == this->query_.sort_order)
+        return;
+
+    MongoTableQuery query = this->query_;
+    query.sort_field = field;
+    query.sort_order = order;
+    this->setQuery(query);
+}
+
+void MongoTableModel::onPageReady(const MongoPage& page)
+{
+    if (page.generation != this->generation_)
+        return;
+
+    auto request = this->pending_.find(page.page);
+    if (request != this->pending_.end())
+    {
+        this->page_latency_.record(this->clock_.nsecsElapsed() - request.value());
+        this->pending_.erase(request);
+    }
+
+    const int first = page.page * this->config_.page_size;
+    const int count = static_cast<int>(page.rows.size());
+    const int loaded = std::clamp(this->row_count_ - first, 0, this->config_.page_size);
+    if (first <= this->row_count_ && loaded < this->config_.page_size)
+    {
+        // Next page, or the last one read again (live tail): rows after the loaded ones. A short page is the last one.
+        this->at_end_ = count < this->config_.page_size;
+        if (count > loaded)
+        {
+            this->beginInsertRows(QModelIndex(), this->row_count_, first + count - 1);
+            this->cache_.insert(page.page, new QVector<MongoRow>(page.rows), count);
+            this->row_count_ = first + count;
+            this->endInsertRows();
+            if (this->live_since_ns_ != 0)
+            {
+                this->live_latency_.record(ChangeStreamConsumer::nowNs() - this->live_since_ns_);
+                this->live_since_ns_ = 0;
+            }
+        }
+        else if (count > 0)
+            this->cache_.insert(page.page, new QVector<MongoRow>(page.rows), count);
+
+        if (loaded > 0 && count > 0)
+        {
+            const int last = first + std::min(loaded, count) - 1;
+            emit this->dataChanged(this->index(first, 0), this->index(last, this->columnCount() - 1));
+        }
+    }
+    else if (first < this->row_count_ && count > 0)
+    {
+        // Reloaded page: refresh the placeholders.
+        this->cache_.insert(page.page, new QVector<MongoRow>(page.rows), count);
+        emit this->dataChanged(this->index(first, 0), this->index(first + count - 1, this->columnCount() - 1));
+    }
+
+    // Events received before the end was reached or while the tail page was read: read it again.
+    if (this->live_dirty_ && this->at_end_ && !this->pending_.contains(this->row_count_ / this->config_.page_size))
+    {
+        this->live_dirty_ = false;
+        this->requestTail();
+    }
+}
+
+void MongoTableModel::onQueryFailed(quint64 generation, const QString& error)
+{
+    if (generation != this->generation_)
+        return;
+
+    // Stop fetching, the rows already read stay.
+    this->at_end_ = true;
+    this->pending_.clear();
+    std::cerr << "[MongoTableModel] Query failed: " << error.toStdString() << std::endl;
+    emit this->queryFailed(error);
+}
+
+void MongoTableModel::onLiveEvents()
+{
+    if (!this->live_)
+        return;
+
+    // Only the notification matters, the documents are read by the tail page.
+    this->live_batch_.clear();
+    const std::size_t count = this->live_->drain(this->live_batch_);
+    if (count == 0)
+        return;
+    this->live_events_ += count;
+    if (this->live_since_ns_ == 0)
+        this->live_since_ns_ = this->live_batch_.front().received_ns;
+    this->requestTail();
+}
+
+void MongoTableModel::requestTail()
+{
+    // Before the end (fetchMore() reads on) or while the tail page is being read: read it again later.
+    const int page = this->row_count_ / this->config_.page_size;
+    if (!this->at_end_ || this->pending_.contains(page))
+    {
+        this->live_dirty_ = true;
+        return;
+    }
+    this->requestPage(page);
+}
+
+void MongoTableModel::requestPage(int page) const
+{
+    if (this->pending_.contains(page))
+        return;
+    this->pending_.insert(page, this->clock_.nsecsElapsed());
+
+    MongoPageSource* source = this->source_;
+    const quint64 generation = this->generation_;
+    QMetaObject::invokeMethod(source, [source, generation, page]()
+    {
+        source->fetchPage(generation, page);
+    }, Qt::QueuedConnection);
+}
+
+void MongoTableModel::prefetchFrom(int page) const
+{
+    if (page == this->last_page_)
+        return;
+
+    const int step = page > this->last_page_ ? 1 : -1;
+    this->last_page_ = page;
+    for (int i = 1; i <= this->config_.prefetch_pages; ++i)
+    {
+        const int next = page + step * i;
+        if (next < 0)
+            break;
+
+        // Past the inserted rows: read the next page now instead of waiting for fetchMore() at the bottom.
+        if (next * this->config_.page_size >= this->row_count_)
+        {
+            if (!this->at_end_)
+                this->requestPage(this->row_count_ / this->config_.page_size);
+            break;
+        }
+        if (!this->cache_.contains(next))
+            this->requestPage(next);
+    }
+}
+
+// =====================================================================================================================
@@ -0,0 +1,185 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldQtMV – Lazy, paged table model of a MongoDB collection
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// QT INCLUDES
+#include <QAbstractTableModel>
+#include <QCache>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QThread>
+#include <QVector>
+
+// PROJECT INCLUDES
+#include "change_stream_consumer.h"
+#include "latency_histogram.h"
+#include "mongo_page_source.h"
+
+/**
+ * @brief Configuration of the MongoTableModel.
+ */
+struct MongoTableConfig
+{
+    int page_size = 200;       ///< Rows per server round trip.
+    int cache_rows = 20000;    ///< Decoded rows kept in memory (LRU window of pages).
+    int prefetch_pages = 2;    ///< Pages requested ahead of the scroll position.
+    bool live_tail = false;    ///< Show the documents inserted after the query (change stream, _id ascending only).
+};
+
+/**
+ * @brief Table model of a MongoDB query, loaded page by page in a worker thread.
+ *
+ * The rows grow with fetchMore() as the view scrolls down, so the first page is shown as soon as it arrives. Only
+ * the last `cache_rows` rows used stay decoded (QCache of pages); an evicted row shows a placeholder while its page is
+ * reloaded. Moving to a new page requests the next ones in the scroll direction. Sorting (sort()) and filtering
+ * (setFilter()) restart the query on the server, nothing is sorted or filtered in memory.
+ *
+ * Live tail: with the default order (_id ascending), a change stream of the inserts (only their notification, not the
+ * documents) makes the model read its last page again once the end of the query is reached (a view scrolled to the
+ * bottom keeps fetching), so the new documents are appended as rows with the same filter and keyset pages; the model
+ * is never reset. Documents inserted with a smaller _id than the last row (e.g. ObjectIds of other clients) appear on
+ * the next query only.
+ */
+class MongoTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+
+    /**
+     * @param config Page size, cache window and prefetch.
+     * @param parent Parent object.
+     */
+    explicit MongoTableModel(const MongoTableConfig& config = MongoTableConfig(), QObject* parent = nullptr);
+
+    /**
+     * @brief Stop the worker thread (the page being read is finished first).
+     */
+    ~MongoTableModel() override;
+
+    /**
+     * @brief Replace the query and reset the model.
+     */
+    void setQuery(const MongoTableQuery& query);
+
+    const MongoTableQuery& query() const noexcept;
+
+    /**
+     * @brief Replace the filter (Extended JSON) and reset the model.
+     */
+    void setFilter(const QString& json);
+
+    /**
+     * @brief True if the row is inserted and its page is decoded in memory.
+     */
+    bool isRowLoaded(int row) const;
+
+    /**
+     * @brief True once the last page of the query has been read.
+     */
+    bool atEnd() const noexcept;
+
+    std::uint64_t cacheHits() const noexcept;
+
+    std::uint64_t cacheMisses() const noexcept;
+
+    /**
+     * @brief Time from a page request to its arrival in this thread.
+     */
+    const LatencyHistogram& pageLatency() const noexcept;
+
+    /**
+     * @brief True while the live tail stream is open.
+     */
+    bool isLive() const noexcept;
+
+    /**
+     * @brief Insert events received by the live tail.
+     */
+    std::uint64_t liveEvents() const noexcept;
+
+    /**
+     * @brief Time from the reception of an insert event to the insertion of the new rows.
+     */
+    const LatencyHistogram& liveLatency() const noexcept;
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+    bool canFetchMore(const QModelIndex& parent) const override;
+
+    void fetchMore(const QModelIndex& parent) override;
+
+    /**
+     * @brief Sort by the column field on the server (a negative column sorts by _id).
+     */
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+
+signals:
+
+    void queryFailed(const QString& error);
+
+private slots:
+
+    void onPageReady(const MongoPage& page);
+
+    void onQueryFailed(quint64 generation, const QString& error);
+
+    void onLiveEvents();
+
+private:
+
+    void requestPage(int page) const;
+
+    void prefetchFrom(int page) const;
+
+    /**
+     * @brief Read the last page again for the inserted documents (at the end of the query only).
+     */
+    void requestTail();
+
+    MongoTableConfig config_;
+    MongoTableQuery query_;
+    quint64 generation_;
+    int row_count_;
+    bool at_end_;
+    mutable QCache<int, QVector<MongoRow>> cache_;
+    mutable QHash<int, qint64> pending_;   // Requested pages and request time.
+    mutable int last_page_;
+    mutable std::uint64_t hits_;
+    mutable std::uint64_t misses_;
+    LatencyHistogram page_latency_;
+    QElapsedTimer clock_;
+    QThread source_thread_;
+    MongoPageSource* source_;
+    std::unique_ptr<ChangeStreamConsumer> live_;
+    std::vector<ChangeEvent> live_batch_;
+    bool live_dirty_;                // Events not covered by a tail page read yet.
+    std::int64_t live_since_ns_;     // Reception of the oldest event not shown yet, 0 if none.
+    std::uint64_t live_events_;
+    LatencyHistogram live_latency_;
+};
+
+// =====================================================================================================================
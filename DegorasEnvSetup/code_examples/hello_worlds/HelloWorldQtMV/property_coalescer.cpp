@@ -0,0 +1,139 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <algorithm>
+#include <chrono>
+
+// QT INCLUDES
+#include <QMetaObject>
+
+// PROJECT INCLUDES
+#include "property_coalescer.h"
+
+PropertyCoalescer::PropertyCoalescer(std::chrono::milliseconds interval, QObject* parent) :
+    QObject(parent),
+    scheduled_(false),
+    received_(0),
+    delivered_(0),
+    batches_(0),
+    interval_(interval),
+    timer_(new QTimer(this))
+{
+    this->timer_->setSingleShot(true);
+    this->timer_->setTimerType(Qt::PreciseTimer);
+    QObject::connect(this->timer_, &QTimer::timeout, this, &PropertyCoalescer::deliver);
+}
+
+void PropertyCoalescer::setHandler(int key, Handler handler)
+{
+    this->handlers_[key] = std::move(handler);
+}
+
+void PropertyCoalescer::post(int key, const QVariant& value)
+{
+    const std::int64_t now_ns = PropertyCoalescer::nowNs();
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        auto [it, inserted] = this->pending_.try_emplace(key, Pending{value, now_ns});
+        if (!inserted)
+            it->second.value = value;
+    }
+    this->received_.fetch_add(1, std::memory_order_relaxed);
+
+    // Only the first update of a batch crosses the thread boundary.
+    if (!this->scheduled_.exchange(true, std::memory_order_acq_rel))
+        QMetaObject::invokeMethod(this, &PropertyCoalescer::schedule, Qt::QueuedConnection);
+}
+
+void PropertyCoalescer::setInterval(std::chrono::milliseconds interval)
+{
+    this->interval_ = interval;
+}
+
+std::chrono::milliseconds PropertyCoalescer::interval() const noexcept
+{
+    return this->interval_;
+}
+
+std::uint64_t PropertyCoalescer::received() const noexcept
+{
+    return this->received_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t PropertyCoalescer::delivered() const noexcept
+{
+    return this->delivered_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t PropertyCoalescer::batches() const noexcept
+{
+    return this->batches_.load(std::memory_order_relaxed);
+}
+
+const LatencyHistogram& PropertyCoalescer::latency() const noexcept
+{
+    return this->latency_;
+}
+
+void PropertyCoalescer::schedule()
+{
+    // Deliver now if the last batch is older than the interval, otherwise when the interval ends.
+    const qint64 elapsed_ms = this->last_delivery_.isValid() ? this->last_delivery_.elapsed() : this->interval_.count();
+    const qint64 remaining_ms = this->interval_.count() - elapsed_ms;
+    if (remaining_ms <= 0)
+        this->deliver();
+    else if (!this->timer_->isActive())
+        this->timer_->start(static_cast<int>(remaining_ms));
+}
+
+void PropertyCoalescer::deliver()
+{
+    // Re-arm before taking the values: a post() racing with this delivery schedules the next one.
+    this->scheduled_.store(false, std::memory_order_release);
+
+    this->batch_.clear();
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        for (auto& [key, pending] : this->pending_)
+            this->batch_.emplace_back(key, std::move(pending));
+        this->pending_.clear();
+    }
+    if (this->batch_.empty())
+        return;
+
+    std::sort(this->batch_.begin(), this->batch_.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+    this->last_delivery_.start();
+
+    // Handlers run without the lock, they may post again.
+    int count = 0;
+    for (const auto& [key, pending] : this->batch_)
+    {
+        auto it = this->handlers_.find(key);
+        if (it == this->handlers_.end())
+            continue;
+        this->latency_.record(PropertyCoalescer::nowNs() - pending.first_post_ns);
+        it->second(pending.value);
+        ++count;
+    }
+
+    this->delivered_.fetch_add(static_cast<std::uint64_t>(count), std::memory_order_relaxed);
+    this->batches_.fetch_add(1, std::memory_order_relaxed);
+    emit this->batchDelivered(count);
+}
+
+std::int64_t PropertyCoalescer::nowNs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// =====================================================================================================================
@@ -0,0 +1,132 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldQtMV – Coalescing of high-frequency property updates between threads
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// QT INCLUDES
+#include <QElapsedTimer>
+#include <QObject>
+#include <QTimer>
+#include <QVariant>
+
+// PROJECT INCLUDES
+#include "latency_histogram.h"
+
+/**
+ * @brief Keeps the latest value of each property and delivers them in batches, at most once per interval.
+ *
+ * post() can be called from any thread and only stores the value; the first post after a delivery schedules the
+ * next one in the coalescer thread (one queued event per batch instead of one per update). The handlers run in the
+ * coalescer thread, in key order, only for the properties changed since the previous delivery.
+ */
+class PropertyCoalescer : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    using Handler = std::function<void(const QVariant&)>;
+
+    /**
+     * @param interval Minimum time between two deliveries (default 16 ms, one 60 Hz frame).
+     * @param parent Parent object, its thread is the delivery thread.
+     */
+    explicit PropertyCoalescer(std::chrono::milliseconds interval = std::chrono::milliseconds(16),
+                               QObject* parent = nullptr);
+
+    /**
+     * @brief Set the receiver of a property. Call it from the coalescer thread.
+     */
+    void setHandler(int key, Handler handler);
+
+    /**
+     * @brief Store the new value of a property (thread-safe, never blocks on the receiver).
+     */
+    void post(int key, const QVariant& value);
+
+    /**
+     * @brief Change the delivery interval. Call it from the coalescer thread.
+     */
+    void setInterval(std::chrono::milliseconds interval);
+
+    std::chrono::milliseconds interval() const noexcept;
+
+    /**
+     * @brief Values passed to post().
+     */
+    std::uint64_t received() const noexcept;
+
+    /**
+     * @brief Values passed to the handlers (the rest were overwritten by newer ones).
+     */
+    std::uint64_t delivered() const noexcept;
+
+    /**
+     * @brief Batches delivered.
+     */
+    std::uint64_t batches() const noexcept;
+
+    /**
+     * @brief Time from the first post() of each delivered value (since the previous delivery) to its handler call.
+     */
+    const LatencyHistogram& latency() const noexcept;
+
+signals:
+
+    /**
+     * @brief Emitted after each batch with the number of values delivered.
+     */
+    void batchDelivered(int count);
+
+private:
+
+    void schedule();
+
+    void deliver();
+
+    /**
+     * @brief Latest value of a property and the time of the first post() it replaced.
+     */
+    struct Pending
+    {
+        QVariant value;
+        std::int64_t first_post_ns;
+    };
+
+    static std::int64_t nowNs() noexcept;
+
+    std::mutex mutex_;
+    std::unordered_map<int, Pending> pending_;
+    std::unordered_map<int, Handler> handlers_;
+    std::vector<std::pair<int, Pending>> batch_;
+    LatencyHistogram latency_;
+    std::atomic_bool scheduled_;
+    std::atomic<std::uint64_t> received_;
+    std::atomic<std::uint64_t> delivered_;
+    std::atomic<std::uint64_t> batches_;
+    std::chrono::milliseconds interval_;
+    QTimer* timer_;
+    QElapsedTimer last_delivery_;
+};
+
+// =====================================================================================================================
@@ -0,0 +1,275 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+// PROJECT INCLUDES
+#include "shutdown_coordinator.h"
+
+namespace
+{
+
+/**
+ * @brief Name of a step state.
+ */
+const char* stateName(ShutdownStepState state)
+{
+    switch (state)
+    {
+    case ShutdownStepState::Pending: return "pending";
+    case ShutdownStepState::Running: return "abandoned";
+    case ShutdownStepState::Done:    return "done";
+    case ShutdownStepState::Failed:  return "failed";
+    case ShutdownStepState::Skipped: return "skipped";
+    }
+    return "unknown";
+}
+
+} // namespace
+
+/**
+ * @brief Steps and scheduling state, shared with the step threads (they can outlive the coordinator).
+ */
+struct ShutdownCoordinator::State
+{
+    struct Entry
+    {
+        std::string name;
+        Step step;
+        std::vector<std::size_t> dependents;
+        std::size_t waiting = 0;   // Dependencies not done yet.
+        ShutdownStepState state = ShutdownStepState::Pending;
+        std::int64_t start_ns = -1;
+        std::int64_t end_ns = -1;
+        std::string error;
+    };
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<Entry> entries;
+    std::size_t open = 0;          // Steps neither finished nor skipped.
+    bool abandoned = false;        // Deadline reached, the report is frozen.
+    std::int64_t abandoned_ns = 0;
+    CancellationToken token;
+    std::chrono::steady_clock::time_point start;
+
+    std::int64_t nowNs() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /**
+     * @brief Start a step in its own thread. Called with the mutex held.
+     */
+    static void launch(const std::shared_ptr<State>& state, std::size_t index)
+    {
+        Entry& entry = state->entries[index];
+        entry.state = ShutdownStepState::Running;
+        entry.start_ns = state->nowNs();
+        std::thread([state, index]() { State::execute(state, index); }).detach();
+    }
+
+    /**
+     * @brief Mark a step and the pending ones depending on it as skipped. Called with the mutex held.
+     */
+    void skip(std::size_t index)
+    {
+        for (std::size_t dependent : this->entries[index].dependents)
+        {
+            Entry& entry = this->entries[dependent];
+            if (entry.state != ShutdownStepState::Pending)
+                continue;
+            entry.state = ShutdownStepState::Skipped;
+            --this->open;
+            this->skip(dependent);
+        }
+    }
+
+    /**
+     * @brief Body of a step thread: run the step, then release its dependents.
+     */
+    static void execute(const std::shared_ptr<State>& state, std::size_t index)
+    {
+        // The step function is not modified after run() starts, it can be read without the lock.
+        std::string error;
+        bool failed = false;
+        try
+        {
+            state->entries[index].step(state->token);
+        }
+        catch (const std::exception& e)
+        {
+            failed = true;
+            error = e.what();
+        }
+        catch (...)
+        {
+            failed = true;
+            error = "unknown exception";
+        }
+
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->abandoned)
+            return;
+
+        Entry& entry = state->entries[index];
+        entry.end_ns = state->nowNs();
+        entry.state = failed ? ShutdownStepState::Failed : ShutdownStepState::Done;
+        entry.error = std::move(error);
+        --state->open;
+
+        if (failed)
+            state->skip(index);
+        else
+        {
+            for (std::size_t dependent : entry.dependents)
+            {
+                Entry& next = state->entries[dependent];
+                if (--next.waiting == 0 && next.state == ShutdownStepState::Pending)
+                    State::launch(state, dependent);
+            }
+        }
+        state->cv.notify_all();
+    }
+};
+
+// =====================================================================================================================
+
+ShutdownCoordinator::ShutdownCoordinator(std::chrono::milliseconds deadline) :
+    deadline_(deadline),
+    elapsed_ns_(0),
+    state_(std::make_shared<State>())
+{}
+
+bool ShutdownCoordinator::addStep(const std::string& name, Step step, const std::vector<std::string>& depends_on)
+{
+    std::lock_guard<std::mutex> lock(this->state_->mutex);
+    auto& entries = this->state_->entries;
+    const auto find = [&entries](const std::string& step_name)
+    {
+        return std::find_if(entries.begin(), entries.end(), [&](const State::Entry& e) { return e.name == step_name; });
+    };
+
+    if (find(name) != entries.end())
+        return false;
+
+    std::vector<std::size_t> dependencies;
+    for (const std::string& dependency : depends_on)
+    {
+        const auto it = find(dependency);
+        if (it == entries.end())
+            return false;
+        dependencies.push_back(static_cast<std::size_t>(it - entries.begin()));
+    }
+
+    // Dependencies are added first, so the graph has no cycles.
+    const std::size_t index = entries.size();
+    State::Entry entry;
+    entry.name = name;
+    entry.step = std::move(step);
+    entry.waiting = dependencies.size();
+    entries.push_back(std::move(entry));
+    for (std::size_t dependency : dependencies)
+        entries[dependency].dependents.push_back(index);
+    ++this->state_->open;
+    return true;
+}
+
+bool ShutdownCoordinator::run()
+{
+    State& state = *this->state_;
+    std::unique_lock<std::mutex> lock(state.mutex);
+    state.start = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < state.entries.size(); ++i)
+    {
+        if (state.entries[i].waiting == 0)
+            State::launch(this->state_, i);
+    }
+
+    const bool finished = state.cv.wait_until(lock, state.start + this->deadline_, [&state]()
+    {
+        return state.open == 0;
+    });
+
+    if (!finished)
+    {
+        // Freeze the report and ask the running steps to give up.
+        state.abandoned = true;
+        state.abandoned_ns = state.nowNs();
+        state.token.cancel();
+    }
+    this->elapsed_ns_ = state.nowNs();
+
+    return finished && std::all_of(state.entries.begin(), state.entries.end(), [](const State::Entry& entry)
+    {
+        return entry.state == ShutdownStepState::Done;
+    });
+}
+
+std::chrono::milliseconds ShutdownCoordinator::deadline() const noexcept
+{
+    return this->deadline_;
+}
+
+std::int64_t ShutdownCoordinator::elapsedNs() const noexcept
+{
+    return this->elapsed_ns_;
+}
+
+std::vector<ShutdownStepReport> ShutdownCoordinator::report() const
+{
+    std::lock_guard<std::mutex> lock(this->state_->mutex);
+    std::vector<ShutdownStepReport> report;
+    report.reserve(this->state_->entries.size());
+    for (const State::Entry& entry : this->state_->entries)
+    {
+        std::int64_t duration_ns = 0;
+        if (entry.state == ShutdownStepState::Running)
+            duration_ns = this->state_->abandoned_ns - entry.start_ns;
+        else if (entry.end_ns >= 0)
+            duration_ns = entry.end_ns - entry.start_ns;
+        report.push_back({entry.name, entry.state, entry.start_ns, duration_ns, entry.error});
+    }
+    return report;
+}
+
+std::string ShutdownCoordinator::summary() const
+{
+    const std::vector<ShutdownStepReport> steps = this->report();
+    const bool completed = std::all_of(steps.begin(), steps.end(), [](const ShutdownStepReport& step)
+    {
+        return step.state == ShutdownStepState::Done;
+    });
+
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3);
+    out << (completed ? "completed" : "incomplete") << " in " << this->elapsed_ns_ / 1e6 << " ms (budget "
+        << this->deadline_.count() << " ms)\n";
+    for (const ShutdownStepReport& step : steps)
+    {
+        out << "  " << std::left << std::setw(24) << step.name << std::setw(10) << stateName(step.state)
+            << std::right << " start " << std::setw(9) << (step.start_ns < 0 ? 0.0 : step.start_ns / 1e6)
+            << " ms, took " << std::setw(9) << step.duration_ns / 1e6 << " ms";
+        if (!step.error.empty())
+            out << " (" << step.error << ")";
+        out << '\n';
+    }
+    return out.str();
+}
+
+// =====================================================================================================================
@@ -0,0 +1,109 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldQtMV – Shutdown coordinator (concurrent cleanup steps under a global deadline)
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// PROJECT INCLUDES
+#include "task_executor.h"
+
+/**
+ * @brief Final state of a shutdown step.
+ */
+enum class ShutdownStepState
+{
+    Pending,    ///< Not started (deadline reached before its dependencies finished).
+    Running,    ///< Still running at the deadline, abandoned.
+    Done,       ///< Finished.
+    Failed,     ///< Threw an exception.
+    Skipped     ///< Not run because a dependency failed or was abandoned.
+};
+
+/**
+ * @brief Timing of one shutdown step, relative to the start of run().
+ */
+struct ShutdownStepReport
+{
+    std::string name;           ///< Step name.
+    ShutdownStepState state;    ///< Final state.
+    std::int64_t start_ns;      ///< Start time (-1 if it never started).
+    std::int64_t duration_ns;   ///< Run time, or time run until the deadline.
+    std::string error;          ///< Exception message of a failed step.
+};
+
+/**
+ * @brief Runs cleanup steps concurrently, each as soon as its dependencies are done, under a global deadline.
+ *
+ * Every step runs in its own thread and gets a token cancelled at the deadline, so a step waiting on it
+ * (CancellationToken::waitFor) gives up in time. At the deadline run() returns anyway: the steps still running are
+ * abandoned (their threads are detached and keep only shared state alive) and the caller is expected to end the
+ * process without waiting for them.
+ */
+class ShutdownCoordinator
+{
+public:
+
+    using Step = std::function<void(const CancellationToken&)>;
+
+    /**
+     * @param deadline Time budget of run() for all the steps.
+     */
+    explicit ShutdownCoordinator(std::chrono::milliseconds deadline);
+
+    /**
+     * @brief Add a step. The dependencies must be added before it. Call it before run().
+     * @return False if the name is repeated or a dependency is unknown (the step is not added).
+     */
+    bool addStep(const std::string& name, Step step, const std::vector<std::string>& depends_on = {});
+
+    /**
+     * @brief Run all the steps and wait until they finish or the deadline passes.
+     * @return True if every step finished (Done) in time.
+     */
+    bool run();
+
+    std::chrono::milliseconds deadline() const noexcept;
+
+    /**
+     * @brief Wall time of run().
+     */
+    std::int64_t elapsedNs() const noexcept;
+
+    /**
+     * @brief Per step timing, in the order the steps were added. Valid after run().
+     */
+    std::vector<ShutdownStepReport> report() const;
+
+    /**
+     * @brief Human readable report (one line per step).
+     */
+    std::string summary() const;
+
+private:
+
+    struct State;
+
+    std::chrono::milliseconds deadline_;
+    std::int64_t elapsed_ns_;
+    std::shared_ptr<State> state_;
+};
+
+// =====================================================================================================================
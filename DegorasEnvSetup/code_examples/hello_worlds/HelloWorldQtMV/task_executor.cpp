@@ -0,0 +1,190 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <exception>
+
+// PROJECT INCLUDES
+#include "task_executor.h"
+
+// =====================================================================================================================
+// CancellationToken
+// =====================================================================================================================
+
+CancellationToken::CancellationToken() :
+    state_(std::make_shared<State>())
+{}
+
+void CancellationToken::cancel() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(this->state_->mutex);
+        this->state_->cancelled.store(true, std::memory_order_relaxed);
+    }
+    this->state_->cv.notify_all();
+}
+
+bool CancellationToken::isCancelled() const noexcept
+{
+    return this->state_->cancelled.load(std::memory_order_relaxed);
+}
+
+bool CancellationToken::waitFor(std::chrono::milliseconds timeout) const
+{
+    std::unique_lock<std::mutex> lock(this->state_->mutex);
+    return this->state_->cv.wait_for(lock, timeout, [this]
+    {
+        return this->state_->cancelled.load(std::memory_order_relaxed);
+    });
+}
+
+// =====================================================================================================================
+// TaskContext
+// =====================================================================================================================
+
+TaskContext::TaskContext(TaskExecutor* executor, TaskId id, CancellationToken token) :
+    executor_(executor),
+    id_(id),
+    token_(std::move(token)),
+    last_progress_()
+{}
+
+TaskId TaskContext::id() const noexcept
+{
+    return this->id_;
+}
+
+const CancellationToken& TaskContext::token() const noexcept
+{
+    return this->token_;
+}
+
+bool TaskContext::isCancelled() const noexcept
+{
+    return this->token_.isCancelled();
+}
+
+void TaskContext::reportProgress(int percent, const QString& message)
+{
+    // Throttle: a tight loop reporting every step must not flood the receiver's event queue.
+    const auto now = std::chrono::steady_clock::now();
+    if (percent < 100 && now - this->last_progress_ < this->executor_->progressInterval())
+        return;
+    this->last_progress_ = now;
+
+    emit this->executor_->taskProgress(this->id_, percent, message);
+}
+
+// =====================================================================================================================
+// TaskExecutor
+// =====================================================================================================================
+
+TaskExecutor::TaskExecutor(std::size_t thread_count, QObject* parent) :
+    QObject(parent),
+    next_id_(1),
+    progress_interval_ms_(100),
+    pool_(thread_count)
+{}
+
+TaskExecutor::~TaskExecutor()
+{
+    this->cancelAll();
+    this->pool_.waitForDone();
+}
+
+TaskId TaskExecutor::submit(Work work)
+{
+    const TaskId id = this->next_id_.fetch_add(1, std::memory_order_relaxed);
+    CancellationToken token;
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->tokens_.emplace(id, token);
+    }
+
+    this->pool_.submit([this, id, token, work = std::move(work)]
+    {
+        this->runTask(id, token, work);
+    });
+    return id;
+}
+
+bool TaskExecutor::cancel(TaskId id)
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    auto it = this->tokens_.find(id);
+    if (it == this->tokens_.end())
+        return false;
+    it->second.cancel();
+    return true;
+}
+
+void TaskExecutor::cancelAll()
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    for (auto& [id, token] : this->tokens_)
+        token.cancel();
+}
+
+std::size_t TaskExecutor::activeTasks() const
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    return this->tokens_.size();
+}
+
+void TaskExecutor::setProgressInterval(std::chrono::milliseconds interval) noexcept
+{
+    this->progress_interval_ms_.store(interval.count(), std::memory_order_relaxed);
+}
+
+std::chrono::milliseconds TaskExecutor::progressInterval() const noexcept
+{
+    return std::chrono::milliseconds(this->progress_interval_ms_.load(std::memory_order_relaxed));
+}
+
+void TaskExecutor::runTask(TaskId id, const CancellationToken& token, const Work& work)
+{
+    QVariant result;
+    QString error;
+    bool failed = false;
+
+    // Cancelled while queued: do not even start.
+    if (!token.isCancelled())
+    {
+        TaskContext context(this, id, token);
+        try
+        {
+            result = work(context);
+        }
+        catch (const std::exception& e)
+        {
+            failed = true;
+            error = QString::fromStdString(e.what());
+        }
+        catch (...)
+        {
+            failed = true;
+            error = QStringLiteral("unknown exception");
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->tokens_.erase(id);
+    }
+
+    if (failed)
+        emit this->taskFailed(id, error);
+    else if (token.isCancelled())
+        emit this->taskCanceled(id);
+    else
+        emit this->taskFinished(id, result);
+}
+
+// =====================================================================================================================
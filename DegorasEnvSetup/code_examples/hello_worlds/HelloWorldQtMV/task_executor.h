@@ -0,0 +1,176 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldQtMV – Cancellable task executor for the model long actions
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+// QT INCLUDES
+#include <QObject>
+#include <QString>
+#include <QVariant>
+
+// PROJECT INCLUDES
+#include "work_stealing_pool.h"
+
+using TaskId = quint64;
+
+/**
+ * @brief Shared cancellation flag of a task. Copies refer to the same flag.
+ */
+class CancellationToken
+{
+public:
+
+    CancellationToken();
+
+    /**
+     * @brief Request the cancellation and wake up the waitFor() calls.
+     */
+    void cancel() noexcept;
+
+    bool isCancelled() const noexcept;
+
+    /**
+     * @brief Sleep for `timeout` or until cancelled, whichever comes first.
+     * @return True if the token is cancelled.
+     */
+    bool waitFor(std::chrono::milliseconds timeout) const;
+
+private:
+
+    struct State
+    {
+        std::atomic_bool cancelled{false};
+        mutable std::mutex mutex;
+        mutable std::condition_variable cv;
+    };
+
+    std::shared_ptr<State> state_;
+};
+
+class TaskExecutor;
+
+/**
+ * @brief Handle given to a running task: cancellation token and throttled progress reporting.
+ */
+class TaskContext
+{
+public:
+
+    TaskId id() const noexcept;
+
+    const CancellationToken& token() const noexcept;
+
+    bool isCancelled() const noexcept;
+
+    /**
+     * @brief Emit TaskExecutor::taskProgress, at most once per progress interval (100 % is always emitted).
+     */
+    void reportProgress(int percent, const QString& message = QString());
+
+private:
+
+    friend class TaskExecutor;
+
+    TaskContext(TaskExecutor* executor, TaskId id, CancellationToken token);
+
+    TaskExecutor* executor_;
+    TaskId id_;
+    CancellationToken token_;
+    std::chrono::steady_clock::time_point last_progress_;
+};
+
+/**
+ * @brief Runs long actions on a work-stealing pool as cancellable tasks.
+ *
+ * The signals are emitted from the pool threads, so the receivers living in other threads (the model, the view) get
+ * them through queued connections. A task that returns after its token was cancelled reports taskCanceled() instead
+ * of taskFinished(); an exception reports taskFailed().
+ */
+class TaskExecutor : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    using Work = std::function<QVariant(TaskContext&)>;
+
+    /**
+     * @param thread_count Pool workers (0 = hardware concurrency).
+     * @param parent Parent object.
+     */
+    explicit TaskExecutor(std::size_t thread_count = 0, QObject* parent = nullptr);
+
+    /**
+     * @brief Cancel all the tasks and wait for them.
+     */
+    ~TaskExecutor() override;
+
+    /**
+     * @brief Queue a task.
+     * @return Identifier used by the signals and by cancel().
+     */
+    TaskId submit(Work work);
+
+    /**
+     * @brief Cancel a queued or running task.
+     * @return False if the task is unknown or already done.
+     */
+    bool cancel(TaskId id);
+
+    void cancelAll();
+
+    /**
+     * @brief Tasks queued or running.
+     */
+    std::size_t activeTasks() const;
+
+    /**
+     * @brief Minimum time between two progress signals of the same task (default 100 ms).
+     */
+    void setProgressInterval(std::chrono::milliseconds interval) noexcept;
+
+    std::chrono::milliseconds progressInterval() const noexcept;
+
+signals:
+
+    void taskProgress(TaskId id, int percent, const QString& message);
+
+    void taskFinished(TaskId id, const QVariant& result);
+
+    void taskCanceled(TaskId id);
+
+    void taskFailed(TaskId id, const QString& error);
+
+private:
+
+    void runTask(TaskId id, const CancellationToken& token, const Work& work);
+
+    mutable std::mutex mutex_;
+    std::unordered_map<TaskId, CancellationToken> tokens_;
+    std::atomic<TaskId> next_id_;
+    std::atomic<std::int64_t> progress_interval_ms_;
+    WorkStealingPool pool_;   // Last member: joined first, while the rest is still alive.
+};
+
+// =====================================================================================================================
@@ -0,0 +1,172 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <algorithm>
+#include <exception>
+#include <iostream>
+
+// PROJECT INCLUDES
+#include "work_stealing_pool.h"
+
+namespace
+{
+
+// Pool and worker index of the current thread (nullptr outside the workers).
+thread_local const WorkStealingPool* tl_pool = nullptr;
+thread_local std::size_t tl_worker = 0;
+
+} // namespace
+
+WorkStealingPool::WorkStealingPool(std::size_t thread_count) :
+    queued_(0),
+    pending_(0),
+    next_worker_(0),
+    stolen_(0),
+    stop_(false)
+{
+    if (thread_count == 0)
+        thread_count = std::max(2u, std::thread::hardware_concurrency());
+
+    this->workers_.reserve(thread_count);
+    for (std::size_t i = 0; i < thread_count; ++i)
+        this->workers_.push_back(std::make_unique<Worker>());
+
+    this->threads_.reserve(thread_count);
+    for (std::size_t i = 0; i < thread_count; ++i)
+        this->threads_.emplace_back(&WorkStealingPool::run, this, i);
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    this->waitForDone();
+    {
+        std::lock_guard<std::mutex> lock(this->wake_mutex_);
+        this->stop_ = true;
+    }
+    this->wake_cv_.notify_all();
+    for (auto& thread : this->threads_)
+        thread.join();
+}
+
+void WorkStealingPool::submit(Task task)
+{
+    // Own deque when called from a worker of this pool, round-robin otherwise.
+    const std::size_t index = tl_pool == this ?
+        tl_worker : this->next_worker_.fetch_add(1, std::memory_order_relaxed) % this->workers_.size();
+
+    // Count it before it can be popped (the worker decrements on pop, the counter must never wrap), under the wake
+    // mutex so a worker about to sleep cannot miss it. A worker seeing the count first retries until the push.
+    this->pending_.fetch_add(1, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(this->wake_mutex_);
+        this->queued_.fetch_add(1, std::memory_order_relaxed);
+    }
+    {
+        std::lock_guard<std::mutex> lock(this->workers_[index]->mutex);
+        this->workers_[index]->tasks.push_back(std::move(task));
+    }
+    this->wake_cv_.notify_one();
+}
+
+void WorkStealingPool::waitForDone()
+{
+    std::unique_lock<std::mutex> lock(this->wake_mutex_);
+    this->done_cv_.wait(lock, [this] { return this->pending_.load(std::memory_order_relaxed) == 0; });
+}
+
+std::size_t WorkStealingPool::threadCount() const noexcept
+{
+    return this->threads_.size();
+}
+
+std::size_t WorkStealingPool::pending() const noexcept
+{
+    return this->pending_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t WorkStealingPool::stolen() const noexcept
+{
+    return this->stolen_.load(std::memory_order_relaxed);
+}
+
+bool WorkStealingPool::popLocal(std::size_t index, Task& task)
+{
+    Worker& worker = *this->workers_[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (worker.tasks.empty())
+        return false;
+    task = std::move(worker.tasks.back());
+    worker.tasks.pop_back();
+    return true;
+}
+
+bool WorkStealingPool::steal(std::size_t index, Task& task)
+{
+    const std::size_t count = this->workers_.size();
+    for (std::size_t offset = 1; offset < count; ++offset)
+    {
+        Worker& victim = *this->workers_[(index + offset) % count];
+        std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+        if (!lock.owns_lock() || victim.tasks.empty())
+            continue;
+        task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        this->stolen_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingPool::run(std::size_t index)
+{
+    tl_pool = this;
+    tl_worker = index;
+
+    while (true)
+    {
+        Task task;
+        if (this->popLocal(index, task) || this->steal(index, task))
+        {
+            this->queued_.fetch_sub(1, std::memory_order_relaxed);
+            try
+            {
+                task();
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << "[WorkStealingPool] Task failed: " << e.what() << std::endl;
+            }
+            catch (...)
+            {
+                std::cerr << "[WorkStealingPool] Task failed: unknown exception" << std::endl;
+            }
+            task = nullptr; // Release the captures before reporting the task as done.
+
+            if (this->pending_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                std::lock_guard<std::mutex> lock(this->wake_mutex_);
+                this->done_cv_.notify_all();
+            }
+            continue;
+        }
+
+        // Nothing to run or steal: sleep until a task is queued (a try_lock miss in steal() retries here).
+        std::unique_lock<std::mutex> lock(this->wake_mutex_);
+        this->wake_cv_.wait(lock, [this]
+        {
+            return this->stop_ || this->queued_.load(std::memory_order_relaxed) > 0;
+        });
+        if (this->stop_ && this->queued_.load(std::memory_order_relaxed) == 0)
+            return;
+    }
+}
+
+// =====================================================================================================================
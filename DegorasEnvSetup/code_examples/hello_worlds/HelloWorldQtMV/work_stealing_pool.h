@@ -0,0 +1,103 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldQtMV – Work-stealing thread pool
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed size thread pool with one task deque per worker.
+ *
+ * Tasks submitted from outside are spread round-robin over the workers, tasks submitted from a worker go to its own
+ * deque. A worker runs its newest task first (LIFO, cache friendly) and, when its deque is empty, steals the oldest
+ * task of another worker (FIFO), so a worker stuck in a long task never holds back the queued ones.
+ */
+class WorkStealingPool
+{
+public:
+
+    using Task = std::function<void()>;
+
+    /**
+     * @param thread_count Number of workers (0 = hardware concurrency, at least 2).
+     */
+    explicit WorkStealingPool(std::size_t thread_count = 0);
+
+    /**
+     * @brief Wait for all the submitted tasks, then stop the workers.
+     */
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * @brief Queue a task. Exceptions thrown by the task are reported to std::cerr and swallowed.
+     */
+    void submit(Task task);
+
+    /**
+     * @brief Block until every submitted task has finished (must not be called from a worker).
+     */
+    void waitForDone();
+
+    std::size_t threadCount() const noexcept;
+
+    /**
+     * @brief Tasks queued or running.
+     */
+    std::size_t pending() const noexcept;
+
+    /**
+     * @brief Tasks run by a worker other than the one they were queued on.
+     */
+    std::uint64_t stolen() const noexcept;
+
+private:
+
+    struct Worker
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void run(std::size_t index);
+
+    bool popLocal(std::size_t index, Task& task);
+
+    bool steal(std::size_t index, Task& task);
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::vector<std::thread> threads_;
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+    std::condition_variable done_cv_;
+    std::atomic<std::size_t> queued_;
+    std::atomic<std::size_t> pending_;
+    std::atomic<std::size_t> next_worker_;
+    std::atomic<std::uint64_t> stolen_;
+    bool stop_;
+};
+
+// =====================================================================================================================
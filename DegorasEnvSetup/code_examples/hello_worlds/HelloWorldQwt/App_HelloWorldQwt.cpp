@@ -13,8 +13,15 @@
  **********************************************************************************************************************/
 
 // C++ INCLUDES
+#include <algorithm>
 #include <iostream>
 #include <cmath>
+#include <memory>
+#include <optional>
+#include <random>
+#include <vector>
+#include <string>
+#include <string_view>
 
 // QT INCLUDES
 #include <QApplication>
@@ -30,9 +37,56 @@
 #include <qwt/qwt_plot_grid.h>
 #include <qwt/qwt_legend.h>
 #include <qwt/qwt_text.h>
+#include <qwt/qwt_plot_panner.h>
+#include <qwt/qwt_plot_magnifier.h>
+#include <qwt/qwt_plot_textlabel.h>
+#include <qwt/qwt_scale_div.h>
+
+// MONGOCXX INCLUDES
+#include <mongocxx/instance.hpp>
+
+// PROJECT INCLUDES
+#include "change_stream_series.h"
+#include "event_loop_watchdog.h"
+#include "frame_stats.h"
+#include "incremental_plotter.h"
+#include "lod_series_data.h"
+#include "mongo_series_loader.h"
+#include "progressive_series_data.h"
+#include "ring_series_data.h"
+#include "sample_producer.h"
+#include "simd_kernels.h"
+#include "spsc_queue.h"
+
+// Constant expresions.
+constexpr std::size_t kAnimatedPoints = 200;
+constexpr std::size_t kTracePoints = 2'000'000;
+constexpr double kStreamRate = 100'000.0;           // Acquisition rate, samples/s.
+constexpr std::size_t kStreamWindow = 100'000;      // Samples shown by the stream curve (1 s).
+constexpr std::size_t kStreamQueue = 1 << 16;       // Queue capacity (~0.65 s of GUI stall before dropping).
+constexpr int kFramePeriodMs = 8;                   // Plot loop timer (120 Hz).
+constexpr qint64 kOverlayRefreshNs = 250'000'000;   // Refresh period of the frame statistics overlay.
+constexpr std::size_t kLiveWindow = 10'000;         // Points shown by the live (change stream) curve.
+constexpr std::size_t kLiveEventsPerFrame = 4096;   // Change events drained per frame at most.
+constexpr std::size_t kHistoryChunksPerFrame = 8;   // Loaded chunks of the stored series applied per frame at most.
 
 /**
  * @brief MainWindow hosting both static and animated Qwt plots.
+ *
+ * The large trace (kTracePoints, decimated to the visible range) is only built on request, it takes most of the
+ * startup time and memory. So is the stream curve, fed by a producer thread at kStreamRate.
+ *
+ * In append mode (which needs the stream) the plot is only replotted when needed and the stream curve is drawn
+ * incrementally, the animated curve is drawn once and kept still (it is not append-only).
+ *
+ * Every frame records the timer lateness, the data preparation, the replot and the whole callback time. The
+ * optional overlay shows the fps, the p99 frame time and the missed frames on the canvas.
+ *
+ * With a live collection, the documents inserted in it are plotted in a second plot (change stream, see
+ * ChangeStreamSeries), which is only replotted in the frames that received points.
+ *
+ * With a stored series, it is loaded progressively from its chunk documents (see MongoSeriesLoader) into a third
+ * plot: the overview is drawn first and refined as the chunks arrive, the chunks of the visible range first.
  */
 class MainWindow : public QMainWindow
 {
@@ -40,15 +94,38 @@ class MainWindow : public QMainWindow
 
 public:
 
-    explicit MainWindow(QWidget* parent = nullptr): 
+    explicit MainWindow(bool append_mode = false, bool stats_overlay = false, bool show_trace = false,
+                        bool show_stream = false,
+                        const ChangeStreamConfig& live_config = ChangeStreamConfig(),
+                        const ChangeStreamFields& live_fields = ChangeStreamFields(),
+                        const SeriesLoaderConfig& history_config = SeriesLoaderConfig(), QWidget* parent = nullptr):
         QMainWindow(parent),
         plot_(new QwtPlot(QwtText("HELLO QWT C++ EXAMPLE"))),
         curve_static_(new QwtPlotCurve("y = sin(x)")),
         curve_animated_(new QwtPlotCurve("y = sin(x + t)")),
+        curve_trace_(show_trace ? new LodPlotCurve("trace (min/max LOD)") : nullptr),
+        curve_stream_(show_stream ? new QwtPlotCurve("stream 100 kS/s") : nullptr),
+        stream_data_(show_stream ? new RingSeriesData(kStreamWindow) : nullptr),
+        stream_queue_(show_stream ? std::make_unique<SpscQueue<QPointF>>(kStreamQueue) : nullptr),
+        stream_producer_(show_stream ? std::make_unique<SampleProducer>(*stream_queue_, kStreamRate) : nullptr),
+        stream_dropped_(0),
+        incremental_(nullptr),
+        animated_data_(new RingSeriesData(kAnimatedPoints)),
+        animated_x_(kAnimatedPoints),
+        animated_y_(kAnimatedPoints),
         timer_(new QTimer(this)),
 		elapsed_(),               
         last_frame_time_(0),      
-        phase_(0.0)
+        phase_(0.0),
+        frame_stats_(std::chrono::milliseconds(kFramePeriodMs)),
+        stats_overlay_(nullptr),
+        last_tick_ns_(-1),
+        overlay_frames_(0),
+        overlay_time_ns_(0),
+        live_plot_(nullptr),
+        history_plot_(nullptr),
+        history_min_(0.0),
+        history_max_(0.0)
     {
         // Set background
         plot_->setCanvasBackground(Qt::white);
@@ -74,8 +151,34 @@ public:
         // Animated curve setup
         this->curve_animated_->setRenderHint(QwtPlotItem::RenderAntialiased);
         this->curve_animated_->setPen(QPen(Qt::blue, 2, Qt::DashLine));
+        this->curve_animated_->setData(this->animated_data_); // The curve owns the data.
         this->curve_animated_->attach(this->plot_);
 
+        // Zoom with the wheel and pan with the mouse.
+        new QwtPlotPanner(this->plot_->canvas());
+        new QwtPlotMagnifier(this->plot_->canvas());
+
+        // Stream curve setup (acquisition time on the top axis, scrolling window)
+        if (this->curve_stream_)
+        {
+            this->curve_stream_->setPen(QPen(Qt::black, 1, Qt::SolidLine));
+            this->curve_stream_->setXAxis(QwtPlot::xTop);
+            this->curve_stream_->setPaintAttribute(QwtPlotCurve::FilterPointsAggressive, true);
+            this->curve_stream_->setData(this->stream_data_); // The curve owns the data.
+            this->curve_stream_->attach(this->plot_);
+            this->plot_->setAxisVisible(QwtPlot::xTop);
+            if (append_mode)
+                this->incremental_ = new IncrementalPlotter(this->plot_, this->curve_stream_, this->stream_data_, 1.0);
+        }
+
+        // Frame statistics overlay (top right corner of the canvas)
+        if (stats_overlay)
+        {
+            this->stats_overlay_ = new QwtPlotTextLabel();
+            this->stats_overlay_->setZ(100.0);
+            this->stats_overlay_->attach(this->plot_);
+        }
+
         // Static data initialization
         constexpr int N = 200;
         QVector<double> x(N), y(N);
@@ -86,12 +189,80 @@ public:
         }
         this->curve_static_->setSamples(x, y);
 
+        // Initial animated frame (the only one in append mode)
+        for (std::size_t i = 0; i < kAnimatedPoints; ++i)
+            this->animated_x_[i] = i / 10.0;
+        this->computeAnimatedFrame(1.0, 0.0);
+
+        // Large trace curve setup (decimated for the visible range), with a noisy signal and a few spikes that must
+        // survive the decimation.
+        if (this->curve_trace_)
+        {
+            this->curve_trace_->setPen(QPen(Qt::darkGreen, 1, Qt::SolidLine));
+            this->curve_trace_->attach(this->plot_);
+
+            std::vector<double> trace_x(kTracePoints), trace_y(kTracePoints);
+            std::mt19937 rng(42);
+            std::normal_distribution<double> noise(0.0, 0.05);
+            for (std::size_t i = 0; i < kTracePoints; ++i)
+                trace_x[i] = 20.0 * i / (kTracePoints - 1);
+            simdAffine(trace_x.data(), trace_y.data(), kTracePoints, 7.0, 0.0);
+            simdSin(trace_y.data(), trace_y.data(), kTracePoints);
+            simdAffine(trace_y.data(), trace_y.data(), kTracePoints, 0.3, 0.0);
+            for (std::size_t i = 0; i < kTracePoints; ++i)
+                trace_y[i] += noise(rng);
+            for (std::size_t i = kTracePoints / 7; i < kTracePoints; i += kTracePoints / 7)
+                trace_y[i] = 1.4;
+            LodSeriesData* trace_data = new LodSeriesData();
+            trace_data->setSamples(std::move(trace_x), std::move(trace_y));
+            this->curve_trace_->setLodData(trace_data); // The curve owns the data.
+        }
+
         // UI Setup
         QWidget* central = new QWidget();
         QVBoxLayout* layout = new QVBoxLayout(central);
         layout->addWidget(plot_);
         this->setCentralWidget(central);
 
+        // Live plot of the documents inserted in a collection (autoscaled, below the main one)
+        if (!live_config.collection.empty())
+        {
+            this->live_plot_ = new QwtPlot(QwtText(QString::fromStdString(
+                "LIVE " + live_config.database + "." + live_config.collection)));
+            this->live_plot_->setCanvasBackground(Qt::white);
+            this->live_plot_->setAutoReplot(false);
+            QwtPlotCurve* live_curve = new QwtPlotCurve(QString::fromStdString(live_fields.y));
+            live_curve->setPen(QPen(Qt::darkMagenta, 1, Qt::SolidLine));
+            RingSeriesData* live_data = new RingSeriesData(kLiveWindow);
+            live_curve->setData(live_data); // The curve owns the data.
+            live_curve->attach(this->live_plot_);
+            layout->addWidget(this->live_plot_);
+
+            this->live_series_ = std::make_unique<ChangeStreamSeries>(live_config, live_fields, live_data);
+            this->live_series_->start();
+        }
+
+        // Stored series loaded progressively (autoscaled to the overview, zoom with the wheel and pan with the mouse)
+        if (!history_config.series.empty())
+        {
+            this->history_plot_ = new QwtPlot(QwtText(QString::fromStdString(
+                "HISTORY " + history_config.database + "." + history_config.collection + "/" + history_config.series)));
+            this->history_plot_->setCanvasBackground(Qt::white);
+            this->history_plot_->setAutoReplot(false);
+            ProgressivePlotCurve* history_curve =
+                new ProgressivePlotCurve(QString::fromStdString(history_config.series));
+            history_curve->setPen(QPen(Qt::darkCyan, 1, Qt::SolidLine));
+            ProgressiveSeriesData* history_data = new ProgressiveSeriesData();
+            history_curve->setProgressiveData(history_data); // The curve owns the data.
+            history_curve->attach(this->history_plot_);
+            new QwtPlotPanner(this->history_plot_->canvas());
+            new QwtPlotMagnifier(this->history_plot_->canvas());
+            layout->addWidget(this->history_plot_);
+
+            this->history_loader_ = std::make_unique<MongoSeriesLoader>(history_config, history_data);
+            this->history_loader_->start();
+        }
+
         this->resize(800, 600);
         this->setWindowTitle("Hello QWT C++ Example – Static + Animated Sine");
 
@@ -100,7 +271,35 @@ public:
         // Timer Setup for 120 Hz.
         this->timer_->setTimerType(Qt::PreciseTimer);
         this->connect(this->timer_, &QTimer::timeout, this, &MainWindow::updateAnimatedCurve);
-        this->timer_->start(8);
+        this->timer_->start(kFramePeriodMs);
+
+        // Start the acquisition.
+        if (this->stream_producer_)
+            this->stream_producer_->start();
+    }
+
+    /**
+     * @brief Frame timing statistics of the plot loop.
+     */
+    const FrameStats& frameStats() const
+    {
+        return this->frame_stats_;
+    }
+
+    /**
+     * @brief Live curve feed, null without a live collection.
+     */
+    const ChangeStreamSeries* liveSeries() const
+    {
+        return this->live_series_.get();
+    }
+
+    /**
+     * @brief Stored series loader, null without a stored series.
+     */
+    const MongoSeriesLoader* historyLoader() const
+    {
+        return this->history_loader_.get();
     }
 
 private slots:
@@ -110,6 +309,57 @@ private slots:
      */
     void updateAnimatedCurve()
     {
+        // Frame start and timer lateness (tick interval beyond the period).
+        const qint64 tick_ns = this->elapsed_.nsecsElapsed();
+        const qint64 lateness_ns = this->last_tick_ns_ < 0 ? 0 :
+                                       tick_ns - this->last_tick_ns_ - qint64{kFramePeriodMs} * 1'000'000;
+        this->last_tick_ns_ = tick_ns;
+
+        // Live documents: appended in place, the live plot is only replotted when points arrived.
+        if (this->live_series_ && this->live_series_->update(kLiveEventsPerFrame) > 0)
+        {
+            this->live_plot_->replot();
+            this->live_series_->displayed();
+        }
+
+        // Stored series: chunks of the new view first (pan or zoom), replotted only when chunks arrived.
+        if (this->history_loader_)
+        {
+            const QwtScaleDiv& scale = this->history_plot_->axisScaleDiv(QwtPlot::xBottom);
+            if (scale.lowerBound() != this->history_min_ || scale.upperBound() != this->history_max_)
+            {
+                this->history_min_ = scale.lowerBound();
+                this->history_max_ = scale.upperBound();
+                this->history_loader_->setViewRange(this->history_min_, this->history_max_);
+            }
+            if (this->history_loader_->update(kHistoryChunksPerFrame) > 0)
+            {
+                this->history_plot_->replot();
+                this->history_loader_->displayed();
+            }
+        }
+
+        // Report the drops (queue full because the GUI stalled), in both modes: setTitle() updates the legend.
+        const std::uint64_t dropped = this->stream_producer_ ? this->stream_producer_->dropped() : 0;
+        if (dropped != this->stream_dropped_)
+        {
+            this->stream_dropped_ = dropped;
+            this->curve_stream_->setTitle(QString("stream 100 kS/s (dropped %1)").arg(static_cast<qint64>(dropped)));
+        }
+
+        // Append mode: draw only the new stream samples.
+        if (this->incremental_)
+        {
+            this->stream_queue_->consume([this](const QPointF* block, std::size_t count)
+            {
+                this->incremental_->append(block, count);
+            });
+            const qint64 prep_end_ns = this->elapsed_.nsecsElapsed();
+            this->incremental_->render();
+            this->finishFrame(tick_ns, lateness_ns, prep_end_ns);
+            return;
+        }
+
         // Compute delta time (in seconds)
         qint64 now = elapsed_.elapsed();
         double dt = (now - last_frame_time_) / 1000.0;
@@ -131,33 +381,113 @@ private slots:
         double t = elapsed_.elapsed() / 1000.0; // time in seconds
         double amplitude = minAmp + (maxAmp - minAmp) * (0.5 + 0.5 * std::sin(2 * M_PI * ampSpeed * t));
 
-        // Recompute sine curve
-        constexpr int N = 200;
-        QVector<double> x(N), y(N);
-        for (int i = 0; i < N; ++i)
+        // Recompute sine curve in place (no allocation, the bounding rect is updated in the same pass).
+        this->computeAnimatedFrame(amplitude, this->phase_);
+
+        // Drain everything the producer queued since the last tick in one batch.
+        if (this->stream_queue_)
         {
-            x[i] = i / 10.0;
-            y[i] = amplitude * std::sin(x[i] + phase_);
+            this->stream_queue_->consume([this](const QPointF* block, std::size_t count)
+            {
+                this->stream_data_->append(block, count);
+            });
         }
 
-        // Set samples and replot.
-        this->curve_animated_->setSamples(x, y);
+        // Replot.
+        const qint64 prep_end_ns = this->elapsed_.nsecsElapsed();
         this->plot_->replot();
+        this->finishFrame(tick_ns, lateness_ns, prep_end_ns);
     }
 
 private:
 
+    /**
+     * @brief Record the frame timings and refresh the overlay (its new text is shown by the next replot).
+     */
+    void finishFrame(qint64 tick_ns, qint64 lateness_ns, qint64 prep_end_ns)
+    {
+        const qint64 end_ns = this->elapsed_.nsecsElapsed();
+        this->frame_stats_.recordFrame({lateness_ns, prep_end_ns - tick_ns, end_ns - prep_end_ns, end_ns - tick_ns});
+
+        if (!this->stats_overlay_ || end_ns - this->overlay_time_ns_ < kOverlayRefreshNs)
+            return;
+
+        const std::uint64_t frames = this->frame_stats_.frames();
+        const double fps = (frames - this->overlay_frames_) * 1e9 / (end_ns - this->overlay_time_ns_);
+        this->overlay_frames_ = frames;
+        this->overlay_time_ns_ = end_ns;
+
+        QwtText text(QString("%1 fps | p99 %2 ms | missed %3")
+                         .arg(fps, 0, 'f', 1)
+                         .arg(this->frame_stats_.total().percentileNs(0.99) / 1e6, 0, 'f', 2)
+                         .arg(static_cast<qint64>(this->frame_stats_.missedFrames())));
+        text.setRenderFlags(Qt::AlignRight | Qt::AlignTop);
+        text.setBackgroundBrush(QBrush(QColor(255, 255, 255, 200)));
+        this->stats_overlay_->setText(text);
+
+        // In append mode the canvas is only repainted by a full replot.
+        if (this->incremental_)
+            this->incremental_->invalidate();
+    }
+
+    /**
+     * @brief Compute y = amplitude * sin(x + phase) with the SIMD kernels and load it into the animated curve.
+     */
+    void computeAnimatedFrame(double amplitude, double phase)
+    {
+        double* y = this->animated_y_.data();
+        simdAffine(this->animated_x_.data(), y, kAnimatedPoints, 1.0, phase);
+        simdSin(y, y, kAnimatedPoints);
+        simdAffine(y, y, kAnimatedPoints, amplitude, 0.0);
+
+        const double* x = this->animated_x_.data();
+        this->animated_data_->assign(kAnimatedPoints, [x, y](std::size_t i)
+        {
+            return QPointF(x[i], y[i]);
+        });
+    }
+
     QwtPlot* plot_;
     QwtPlotCurve* curve_static_;
     QwtPlotCurve* curve_animated_;
+    LodPlotCurve* curve_trace_;
+    QwtPlotCurve* curve_stream_;
+    RingSeriesData* stream_data_;
+    std::unique_ptr<SpscQueue<QPointF>> stream_queue_;
+    std::unique_ptr<SampleProducer> stream_producer_;
+    std::uint64_t stream_dropped_;
+    IncrementalPlotter* incremental_;
+    RingSeriesData* animated_data_;
+    std::vector<double> animated_x_;
+    std::vector<double> animated_y_;
     QTimer* timer_;
     QElapsedTimer elapsed_;
     qint64 last_frame_time_;
     double phase_;
+    FrameStats frame_stats_;
+    QwtPlotTextLabel* stats_overlay_;
+    qint64 last_tick_ns_;
+    std::uint64_t overlay_frames_;
+    qint64 overlay_time_ns_;
+    QwtPlot* live_plot_;
+    std::unique_ptr<ChangeStreamSeries> live_series_;
+    QwtPlot* history_plot_;
+    std::unique_ptr<MongoSeriesLoader> history_loader_;
+    double history_min_;
+    double history_max_;
 };
 
 /**
  * @brief Main entry point of the App_HelloWorldQwt application.
+ *
+ * Usage: App_HelloWorldQwt [--stream] [--append] [--overlay] [--trace] [--stats <file.csv|file.json>]
+ *                          [--watch <db>.<collection> [--uri <uri>] [--watch-fields <x>,<y>] [--resume-file <path>]]
+ *                          [--history <db>.<collection>/<series> [--uri <uri>]]
+ *
+ * --stream adds the 100 kS/s acquisition curve, --append (implies --stream) draws it incrementally. --trace adds the
+ * 2M point trace (level of detail decimation). --watch plots the documents inserted in the collection (change stream,
+ * needs a replica set), --resume-file keeps the resume token between runs. --history loads a series stored in chunks
+ * (see MongoSeriesLoader::store()).
  */
 int main(int argc, char** argv)
 {
@@ -167,7 +497,72 @@ int main(int argc, char** argv)
 
     QApplication app(argc, argv);
 
-    MainWindow window;
+    bool append_mode = false;
+    bool stats_overlay = false;
+    bool show_trace = false;
+    bool show_stream = false;
+    std::string stats_path;
+    ChangeStreamConfig live_config;
+    ChangeStreamFields live_fields;
+    SeriesLoaderConfig history_config;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg(argv[i]);
+        if (arg == "--stream")
+            show_stream = true;
+        else if (arg == "--append")
+            append_mode = show_stream = true;
+        else if (arg == "--overlay")
+            stats_overlay = true;
+        else if (arg == "--trace")
+            show_trace = true;
+        else if (arg == "--stats" && i + 1 < argc)
+            stats_path = argv[++i];
+        else if (arg == "--watch" && i + 1 < argc)
+        {
+            const std::string_view target(argv[++i]);
+            const std::size_t dot = target.find('.');
+            live_config.database = std::string(target.substr(0, dot));
+            if (dot != std::string_view::npos)
+                live_config.collection = std::string(target.substr(dot + 1));
+        }
+        else if (arg == "--uri" && i + 1 < argc)
+            live_config.uri = argv[++i];
+        else if (arg == "--watch-fields" && i + 1 < argc)
+        {
+            const std::string_view fields(argv[++i]);
+            const std::size_t comma = fields.find(',');
+            live_fields.x = std::string(fields.substr(0, comma));
+            if (comma != std::string_view::npos)
+                live_fields.y = std::string(fields.substr(comma + 1));
+        }
+        else if (arg == "--resume-file" && i + 1 < argc)
+            live_config.resume_token_path = argv[++i];
+        else if (arg == "--history" && i + 1 < argc)
+        {
+            const std::string_view target(argv[++i]);
+            const std::size_t dot = target.find('.');
+            const std::size_t slash = target.find('/', dot == std::string_view::npos ? 0 : dot);
+            history_config.database = std::string(target.substr(0, std::min(dot, slash)));
+            if (dot != std::string_view::npos)
+                history_config.collection = std::string(target.substr(dot + 1, slash - dot - 1));
+            if (slash != std::string_view::npos)
+                history_config.series = std::string(target.substr(slash + 1));
+        }
+    }
+    history_config.uri = live_config.uri;
+
+    // The driver instance is only created for a live collection or a stored series, and outlives the window (their
+    // reader threads).
+    std::optional<mongocxx::instance> mongo_instance;
+    if (!live_config.collection.empty() || !history_config.series.empty())
+        mongo_instance.emplace();
+
+    // GUI thread watchdog: a replot or slot blocking the loop past the threshold is logged.
+    EventLoopWatchdog watchdog;
+    watchdog.start();
+
+    MainWindow window(append_mode, stats_overlay, show_trace, show_stream, live_config, live_fields, history_config);
 	window.setWindowState(window.windowState() & ~Qt::WindowMinimized);
     window.show();
 	
@@ -179,7 +574,31 @@ int main(int argc, char** argv)
         window.activateWindow();
     });
 	
-    return app.exec();
+    const int result = app.exec();
+    watchdog.stop();
+
+    // Frame timing report.
+    std::cout << "[INFO] Frame timing: " << window.frameStats().summary() << std::flush;
+    if (!stats_path.empty() && window.frameStats().write(stats_path))
+        std::cout << "[INFO] Frame timing written to " << stats_path << std::endl;
+    std::cout << "[INFO] GUI event loop: " << watchdog.summary() << std::flush;
+    if (const ChangeStreamSeries* live = window.liveSeries())
+    {
+        const LatencyHistogram& latency = live->displayLatency();
+        std::cout << "[INFO] Live curve: " << live->points() << " points (" << live->skipped() << " skipped), "
+                  << live->consumer().restarts() << " stream restarts, insert-to-display p50 "
+                  << latency.percentileNs(0.50) / 1e6 << " ms, p99 " << latency.percentileNs(0.99) / 1e6
+                  << " ms, max " << latency.maxNs() / 1e6 << " ms" << std::endl;
+    }
+    if (const MongoSeriesLoader* history = window.historyLoader())
+    {
+        auto ms = [](std::int64_t ns) { return ns < 0 ? std::string("-") : std::to_string(ns / 1'000'000) + " ms"; };
+        std::cout << "[INFO] Stored series: " << history->loadedBytes() / (1 << 20) << " MiB loaded, first paint "
+                  << ms(history->firstPaintNs()) << ", complete " << ms(history->completeNs()) << ", "
+                  << history->reprioritized() << " finds abandoned by view changes" << std::endl;
+    }
+
+    return result;
 }
 
 // Include mocs
@@ -0,0 +1,1202 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   BenchHelloWorldQwt – Frame time of the live curve update paths (rendered offscreen)
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <cmath>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <new>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+// QT INCLUDES
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QTimer>
+#include <QImage>
+#include <QPainter>
+
+// QWT INCLUDES
+#include <qwt/qwt_plot.h>
+#include <qwt/qwt_plot_curve.h>
+#include <qwt/qwt_plot_grid.h>
+#include <qwt/qwt_legend.h>
+#include <qwt/qwt_plot_renderer.h>
+
+// BSONCXX INCLUDES
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+
+// MONGOCXX INCLUDES
+#include <mongocxx/client.hpp>
+#include <mongocxx/instance.hpp>
+#include <mongocxx/options/insert.hpp>
+#include <mongocxx/uri.hpp>
+
+// PROJECT INCLUDES
+#include "bench_report.h"
+#include "change_stream_series.h"
+#include "frame_stats.h"
+#include "incremental_plotter.h"
+#include "lod_series_data.h"
+#include "mongo_series_loader.h"
+#include "progressive_series_data.h"
+#include "ring_series_data.h"
+#include "sample_producer.h"
+#include "simd_kernels.h"
+#include "spsc_queue.h"
+
+// Constant expresions.
+constexpr int kCanvasWidth = 800;
+constexpr int kCanvasHeight = 600;
+constexpr const char* kLiveDatabase = "degoras_bench";
+constexpr const char* kLiveCollection = "bench_stream";
+constexpr std::size_t kLiveWindow = 10'000;         // Points of the live curve (as App_HelloWorldQwt).
+constexpr std::size_t kLiveEventsPerFrame = 4096;   // Change events drained per frame at most (as App_HelloWorldQwt).
+constexpr std::int64_t kLiveInsertRate = 1000;      // Inserts per second of the latency run.
+constexpr std::int64_t kLiveSeconds = 3;            // Duration of the latency run.
+constexpr std::int64_t kLiveBurstDocs = 100'000;    // Documents of the throughput run.
+constexpr int kLiveInsertBatch = 1000;              // Documents per insert_many of the throughput run.
+constexpr int kLiveTimeoutMs = 30'000;              // Limit of each live run (and of the stream opening).
+constexpr const char* kSeriesCollection = "bench_series";
+constexpr std::size_t kSeriesPoints = 10'000'000;   // Points of the stored series.
+constexpr std::size_t kSeriesChunksPerFrame = 8;    // Loaded chunks applied per frame at most (as App_HelloWorldQwt).
+constexpr int kSeriesTimeoutMs = 120'000;           // Limit of each load.
+
+/**
+ * @brief Mean costs of one frame, in milliseconds.
+ */
+struct FrameCost
+{
+    double update_ms;   ///< Data update (generation + handing the samples to the curve).
+    double frame_ms;    ///< Data update + replot + render.
+};
+
+/**
+ * @brief Print one benchmark result line.
+ */
+void printResult(std::string_view name, double value, std::string_view unit)
+{
+    BenchReport::instance().add(std::string(name), value, std::string(unit));
+    std::cout << "  " << std::left << std::setw(52) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(3) << value
+              << " " << unit << '\n';
+}
+
+/**
+ * @brief Plot with the same look as App_HelloWorldQwt, rendered into an offscreen image.
+ */
+class BenchPlot
+{
+public:
+
+    explicit BenchPlot(QwtPlotCurve* curve = new QwtPlotCurve("y = sin(x + t)")) :
+        curve_(curve),
+        image_(kCanvasWidth, kCanvasHeight, QImage::Format_ARGB32_Premultiplied)
+    {
+        this->plot_.setCanvasBackground(Qt::white);
+        this->plot_.setAxisScale(QwtPlot::yLeft, -1.6, 1.6);
+        this->plot_.setAutoReplot(false);
+        this->plot_.resize(kCanvasWidth, kCanvasHeight);
+
+        QwtPlotGrid* grid = new QwtPlotGrid();
+        grid->setPen(Qt::gray, 0.0, Qt::DotLine);
+        grid->attach(&this->plot_);
+
+        this->curve_->setRenderHint(QwtPlotItem::RenderAntialiased);
+        this->curve_->setPen(QPen(Qt::blue, 2, Qt::DashLine));
+        this->curve_->attach(&this->plot_);
+    }
+
+    QwtPlotCurve* curve()
+    {
+        return this->curve_;
+    }
+
+    QwtPlot* plot()
+    {
+        return &this->plot_;
+    }
+
+    /**
+     * @brief Update the scales and render the plot.
+     */
+    void render()
+    {
+        this->plot_.replot();
+        this->image_.fill(Qt::white);
+        this->renderer_.renderTo(&this->plot_, this->image_);
+    }
+
+private:
+
+    QwtPlot plot_;
+    QwtPlotCurve* curve_;
+    QwtPlotRenderer renderer_;
+    QImage image_;
+};
+
+/**
+ * @brief Run `frames` frames of the animated sine with `update(phase)` and return the mean costs.
+ */
+template <typename F>
+FrameCost runFrames(BenchPlot& bench, int frames, F&& update)
+{
+    QElapsedTimer timer;
+    qint64 update_ns = 0;
+    qint64 frame_ns = 0;
+
+    for (int f = 0; f < frames; ++f)
+    {
+        const double phase = 0.05 * f;
+
+        timer.start();
+        update(phase);
+        update_ns += timer.nsecsElapsed();
+        bench.render();
+        frame_ns += timer.nsecsElapsed();
+    }
+
+    return {update_ns / 1e6 / frames, frame_ns / 1e6 / frames};
+}
+
+/**
+ * @brief Compare the setSamples() path (two new vectors + copy per frame) against the in-place RingSeriesData.
+ */
+void benchCurveUpdate()
+{
+    BenchReport::instance().beginSection("Animated curve update");
+    std::cout << "[Animated curve update] " << kCanvasWidth << "x" << kCanvasHeight << " offscreen" << std::endl;
+
+    for (int n : {1'000, 10'000, 100'000, 1'000'000})
+    {
+        const int frames = n >= 1'000'000 ? 10 : 60;
+        const std::string label = std::to_string(n) + " pts ";
+
+        // Current path: allocate, fill and copy into the curve.
+        BenchPlot vectors;
+        const FrameCost set_samples = runFrames(vectors, frames, [&](double phase)
+        {
+            QVector<double> x(n), y(n);
+            for (int i = 0; i < n; ++i)
+            {
+                x[i] = i * 20.0 / n;
+                y[i] = std::sin(x[i] + phase);
+            }
+            vectors.curve()->setSamples(x, y);
+        });
+
+        // Ring path: rewrite in place.
+        BenchPlot ring;
+        RingSeriesData* data = new RingSeriesData(static_cast<std::size_t>(n));
+        ring.curve()->setData(data);
+        const FrameCost in_place = runFrames(ring, frames, [&](double phase)
+        {
+            data->assign(static_cast<std::size_t>(n), [n, phase](std::size_t i)
+            {
+                const double x = i * 20.0 / n;
+                return QPointF(x, std::sin(x + phase));
+            });
+        });
+
+        printResult(label + "setSamples update", set_samples.update_ms, "ms/frame");
+        printResult(label + "setSamples frame", set_samples.frame_ms, "ms/frame");
+        printResult(label + "RingSeriesData update", in_place.update_ms, "ms/frame");
+        printResult(label + "RingSeriesData frame", in_place.frame_ms, "ms/frame");
+    }
+}
+
+/**
+ * @brief Cost of keeping the bounding rect of a full (wrapped) RingSeriesData while samples scroll in.
+ *
+ * Each frame appends the samples of 1/60 s of a 100 kS/s stream and asks for the bounding rect, as the autoscaled
+ * stream and live curves do on every replot. Time-ordered x is the incremental path; unordered x is the fallback that
+ * rescans x when an edge scrolls out.
+ */
+void benchRingBounds()
+{
+    BenchReport::instance().beginSection("Ring bounds");
+    std::cout << "[Ring bounds] append + boundingRect() after the ring has wrapped" << std::endl;
+
+    constexpr int kFrames = 600;
+    constexpr std::size_t kBlock = 1'667;
+    for (std::size_t n : {10'000, 100'000, 1'000'000})
+    {
+        const std::string label = std::to_string(n) + " pts ";
+        for (const bool ordered : {true, false})
+        {
+            RingSeriesData data(n);
+            std::vector<QPointF> block(kBlock);
+            std::uint64_t seq = 0;
+            std::uint64_t lcg = 1;
+            auto fill = [&]()
+            {
+                for (QPointF& point : block)
+                {
+                    lcg = lcg * 6364136223846793005ULL + 1442695040888963407ULL;
+                    const double x = ordered ? static_cast<double>(seq) : static_cast<double>(lcg >> 11);
+                    point = QPointF(x, std::sin(0.001 * static_cast<double>(seq)));
+                    ++seq;
+                }
+            };
+
+            // Wrap the ring before measuring.
+            while (seq < 2 * n)
+            {
+                fill();
+                data.append(block.data(), block.size());
+            }
+
+            double sink = 0.0;
+            QElapsedTimer timer;
+            qint64 elapsed_ns = 0;
+            for (int f = 0; f < kFrames; ++f)
+            {
+                fill();
+                timer.start();
+                data.append(block.data(), block.size());
+                sink += data.boundingRect().height();
+                elapsed_ns += timer.nsecsElapsed();
+            }
+
+            printResult(label + (ordered ? "time-ordered x" : "unordered x"), elapsed_ns / 1e6 / kFrames,
+                        "ms/frame");
+            if (sink < 0.0)
+                std::cout << "  (empty bounds)" << std::endl;
+        }
+    }
+}
+
+/**
+ * @brief Mean replot + render time of `frames` frames, in milliseconds.
+ */
+double renderMs(BenchPlot& bench, int frames)
+{
+    return runFrames(bench, frames, [](double) {}).frame_ms;
+}
+
+/**
+ * @brief Compare the replot time of plain and decimated curves from 10^4 to 10^8 points, full view and 1% zoom.
+ */
+void benchLod()
+{
+    BenchReport::instance().beginSection("Min/max LOD replot");
+    std::cout << "[Min/max LOD replot] " << kCanvasWidth << "x" << kCanvasHeight << " offscreen" << std::endl;
+
+    for (std::size_t n : {std::size_t{10'000}, std::size_t{100'000}, std::size_t{1'000'000},
+                          std::size_t{10'000'000}, std::size_t{100'000'000}})
+    {
+        const std::string label = std::to_string(n) + " pts ";
+        const int frames = n >= 10'000'000 ? 3 : 20;
+
+        // Noisy sine with spikes, x in [0, 20].
+        LodSeriesData* data = new LodSeriesData();
+        try
+        {
+            std::vector<double> x(n), y(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                x[i] = 20.0 * i / n;
+                y[i] = std::sin(7.0 * x[i]) * (1.0 + 0.1 * std::sin(1e3 * x[i]));
+            }
+
+            QElapsedTimer timer;
+            timer.start();
+            data->setSamples(std::move(x), std::move(y));
+            printResult(label + "pyramid build", timer.nsecsElapsed() / 1e6, "ms");
+        }
+        catch (const std::bad_alloc&)
+        {
+            delete data;
+            std::cout << "  " << label << "skipped (not enough memory)" << std::endl;
+            continue;
+        }
+
+        // The decimated curve owns the data, the plain ones read the same arrays without copying.
+        LodPlotCurve* lod_curve = new LodPlotCurve("lod");
+        lod_curve->setLodData(data);
+        BenchPlot lod(lod_curve);
+
+        BenchPlot plain;
+        plain.curve()->setRawSamples(data->xData().data(), data->yData().data(), static_cast<int>(n));
+
+        BenchPlot filtered;
+        filtered.curve()->setRawSamples(data->xData().data(), data->yData().data(), static_cast<int>(n));
+        filtered.curve()->setPaintAttribute(QwtPlotCurve::FilterPointsAggressive, true);
+
+        for (const bool zoom : {false, true})
+        {
+            const std::string view = zoom ? "zoom 1% " : "full ";
+            for (BenchPlot* bench : {&plain, &filtered, &lod})
+                bench->plot()->setAxisScale(QwtPlot::xBottom, zoom ? 10.0 : 0.0, zoom ? 10.2 : 20.0);
+
+            printResult(label + view + "QwtPlotCurve", renderMs(plain, frames), "ms/frame");
+            printResult(label + view + "FilterPointsAggressive", renderMs(filtered, frames), "ms/frame");
+            const double lod_ms = renderMs(lod, frames);
+            printResult(label + view + "LodPlotCurve (" + std::to_string(data->size()) + " drawn)", lod_ms, "ms/frame");
+        }
+    }
+}
+
+/**
+ * @brief Run the 120 Hz GUI tick for `seconds` with a producer at `rate_hz` (0 = no producer) and print the jitter.
+ *
+ * Every tick drains the queue into a 1 s RingSeriesData window and renders the plot, as App_HelloWorldQwt does.
+ */
+void runStreaming(double rate_hz, int seconds)
+{
+    const std::string label = rate_hz > 0.0 ? std::to_string(static_cast<int>(rate_hz / 1000)) + " kS/s " : "idle ";
+
+    QwtPlotCurve* curve = new QwtPlotCurve("stream");
+    curve->setPaintAttribute(QwtPlotCurve::FilterPointsAggressive, true);
+    RingSeriesData* data = new RingSeriesData(rate_hz > 0.0 ? static_cast<std::size_t>(rate_hz) : 1);
+    curve->setData(data);
+    BenchPlot bench(curve);
+
+    SpscQueue<QPointF> queue(1 << 16);
+    SampleProducer producer(queue, rate_hz > 0.0 ? rate_hz : 1.0);
+    if (rate_hz > 0.0)
+        producer.start();
+
+    std::vector<double> intervals_ms;
+    intervals_ms.reserve(static_cast<std::size_t>(seconds) * 125);
+    std::uint64_t drained = 0;
+    QElapsedTimer clock;
+    qint64 last_ns = -1;
+
+    QEventLoop loop;
+    QTimer tick;
+    tick.setTimerType(Qt::PreciseTimer);
+    QObject::connect(&tick, &QTimer::timeout, [&]()
+    {
+        const qint64 now_ns = clock.nsecsElapsed();
+        if (last_ns >= 0)
+            intervals_ms.push_back((now_ns - last_ns) / 1e6);
+        last_ns = now_ns;
+
+        drained += queue.consume([data](const QPointF* block, std::size_t count) { data->append(block, count); });
+        bench.render();
+    });
+
+    clock.start();
+    tick.start(8);
+    QTimer::singleShot(seconds * 1000, &loop, &QEventLoop::quit);
+    loop.exec();
+    tick.stop();
+    producer.stop();
+
+    // Interval statistics.
+    std::sort(intervals_ms.begin(), intervals_ms.end());
+    const double count = static_cast<double>(std::max<std::size_t>(intervals_ms.size(), 1));
+    const double mean = std::accumulate(intervals_ms.begin(), intervals_ms.end(), 0.0) / count;
+    double var = 0.0;
+    for (double v : intervals_ms)
+        var += (v - mean) * (v - mean);
+    const double p99 = intervals_ms.empty() ? 0.0 : intervals_ms[static_cast<std::size_t>(0.99 * (count - 1))];
+
+    printResult(label + "tick interval mean", mean, "ms");
+    printResult(label + "tick interval stddev (jitter)", std::sqrt(var / count), "ms");
+    printResult(label + "tick interval p99", p99, "ms");
+    printResult(label + "tick interval max", intervals_ms.empty() ? 0.0 : intervals_ms.back(), "ms");
+    if (rate_hz > 0.0)
+    {
+        printResult(label + "produced", static_cast<double>(producer.produced()), "samples");
+        printResult(label + "drained", static_cast<double>(drained), "samples");
+        printResult(label + "dropped", static_cast<double>(producer.dropped()), "samples");
+    }
+}
+
+/**
+ * @brief GUI frame jitter without and with the acquisition thread streaming at 100k samples/s.
+ */
+void benchStreaming()
+{
+    BenchReport::instance().beginSection("SPSC streaming");
+    std::cout << "[SPSC streaming] 8 ms tick, drain + render offscreen, 5 s per run" << std::endl;
+    runStreaming(0.0, 5);
+    runStreaming(100'000.0, 5);
+}
+
+/**
+ * @brief Mean GUI-thread time per frame of a visible plot fed with `rate_hz` samples/s at 120 Hz.
+ *
+ * Painting is synchronous (QwtPlot::replot and QwtPlotDirectPainter repaint immediately), so the wall time of the
+ * frame is the GUI thread CPU time spent on it.
+ */
+double streamFrameMs(double rate_hz, bool append_mode, std::uint64_t& full_replots)
+{
+    constexpr int kFrames = 240;
+    const std::size_t per_frame = static_cast<std::size_t>(rate_hz / 120.0);
+
+    QwtPlot plot;
+    plot.setCanvasBackground(Qt::white);
+    plot.setAxisScale(QwtPlot::yLeft, -1.6, 1.6);
+    plot.setAutoReplot(false);
+    plot.insertLegend(new QwtLegend(), QwtPlot::BottomLegend);
+    QwtPlotGrid* grid = new QwtPlotGrid();
+    grid->setPen(Qt::gray, 0.0, Qt::DotLine);
+    grid->attach(&plot);
+
+    QwtPlotCurve* static_curve = new QwtPlotCurve("y = sin(x)");
+    QVector<double> sx(200), sy(200);
+    for (int i = 0; i < 200; ++i)
+    {
+        sx[i] = i / 200.0;
+        sy[i] = std::sin(20.0 * sx[i]);
+    }
+    static_curve->setSamples(sx, sy);
+    static_curve->attach(&plot);
+
+    QwtPlotCurve* curve = new QwtPlotCurve("stream");
+    RingSeriesData* data = new RingSeriesData(static_cast<std::size_t>(rate_hz) + 1);
+    curve->setData(data);
+    curve->attach(&plot);
+
+    plot.resize(kCanvasWidth, kCanvasHeight);
+    plot.show();
+    QCoreApplication::processEvents();
+
+    IncrementalPlotter* incremental = append_mode ? new IncrementalPlotter(&plot, curve, data, 1.0) : nullptr;
+
+    std::vector<QPointF> block(per_frame);
+    std::uint64_t index = 0;
+    QElapsedTimer timer;
+    qint64 total_ns = 0;
+
+    for (int f = 0; f < kFrames; ++f)
+    {
+        for (QPointF& sample : block)
+        {
+            const double t = index++ / rate_hz;
+            sample = QPointF(t, 0.8 * std::sin(12.566370614359172 * t));
+        }
+
+        timer.start();
+        if (incremental)
+        {
+            incremental->append(block.data(), block.size());
+            incremental->render();
+        }
+        else
+        {
+            data->append(block.data(), block.size());
+            plot.replot();
+        }
+        total_ns += timer.nsecsElapsed();
+    }
+
+    full_replots = incremental ? incremental->fullReplots() : kFrames;
+    return total_ns / 1e6 / kFrames;
+}
+
+/**
+ * @brief Compare full replot against incremental drawing of the new segments at several data rates.
+ */
+void benchIncremental()
+{
+    BenchReport::instance().beginSection("Incremental rendering");
+    std::cout << "[Incremental rendering] visible " << kCanvasWidth << "x" << kCanvasHeight
+              << " plot, 240 frames at 120 Hz" << std::endl;
+
+    for (double rate_hz : {10'000.0, 100'000.0, 1'000'000.0})
+    {
+        const std::string label = std::to_string(static_cast<int>(rate_hz / 1000)) + " kS/s ";
+        std::uint64_t full_replots = 0;
+
+        printResult(label + "full replot", streamFrameMs(rate_hz, false, full_replots), "ms/frame");
+        const double append_ms = streamFrameMs(rate_hz, true, full_replots);
+        printResult(label + "append mode", append_ms, "ms/frame");
+        printResult(label + "append mode full replots", static_cast<double>(full_replots), "replots");
+    }
+}
+
+/**
+ * @brief Time `repeats` calls of `kernel` and return the mean cost in nanoseconds per element.
+ */
+template <typename F>
+double kernelNsPerElement(std::size_t n, int repeats, F&& kernel)
+{
+    kernel(); // Warm up (page faults, dispatch table).
+    QElapsedTimer timer;
+    timer.start();
+    for (int r = 0; r < repeats; ++r)
+        kernel();
+    return static_cast<double>(timer.nsecsElapsed()) / repeats / n;
+}
+
+/**
+ * @brief Check the SIMD kernels of every supported level against the standard library, then time them.
+ * @return False if any level exceeds the documented error bound or gives a different min/max.
+ */
+bool benchSimdKernels()
+{
+    constexpr std::size_t kCount = 1'000'003; // Odd size, the scalar tails are also checked.
+    constexpr int kRepeats = 50;
+
+    BenchReport::instance().beginSection("SIMD kernels");
+    std::cout << "[SIMD kernels] " << kCount << " doubles, detected level "
+              << simdLevelName(detectSimdLevel()) << std::endl;
+
+    // Half of the inputs in the plotting range, half up to the documented limit, plus the edge cases.
+    std::vector<double> x(kCount), out(kCount), ref_sin(kCount), ref_cos(kCount);
+    std::mt19937_64 rng(7);
+    std::uniform_real_distribution<double> near(-20.0, 20.0);
+    std::uniform_real_distribution<double> far(-kSimdTrigMaxInput, kSimdTrigMaxInput);
+    for (std::size_t i = 0; i < kCount; ++i)
+        x[i] = (i % 2) ? far(rng) : near(rng);
+    x[0] = 0.0;
+    x[1] = -0.0;
+    x[2] = M_PI;
+    x[3] = M_PI_2;
+    x[4] = kSimdTrigMaxInput;
+    x[5] = -kSimdTrigMaxInput;
+    for (std::size_t i = 0; i < kCount; ++i)
+    {
+        ref_sin[i] = std::sin(x[i]);
+        ref_cos[i] = std::cos(x[i]);
+    }
+    const auto ref_minmax = std::minmax_element(x.begin(), x.end());
+
+    auto maxError = [&out](const std::vector<double>& ref)
+    {
+        double error = 0.0;
+        for (std::size_t i = 0; i < ref.size(); ++i)
+            error = std::max(error, std::fabs(out[i] - ref[i]));
+        return error;
+    };
+
+    // Baseline: the plain loop the kernels replace.
+    const double std_sin_ns = kernelNsPerElement(kCount, kRepeats, [&]()
+    {
+        for (std::size_t i = 0; i < kCount; ++i)
+            out[i] = std::sin(x[i]);
+    });
+    const double std_affine_ns = kernelNsPerElement(kCount, kRepeats, [&]()
+    {
+        for (std::size_t i = 0; i < kCount; ++i)
+            out[i] = 0.5 * x[i] + 1.0;
+    });
+    printResult("std::sin loop", std_sin_ns, "ns/elem");
+    printResult("affine loop", std_affine_ns, "ns/elem");
+
+    const SimdLevel detected = detectSimdLevel();
+    bool all_ok = true;
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512})
+    {
+        if (static_cast<int>(level) > static_cast<int>(detected))
+            continue;
+        setSimdLevel(level);
+        const std::string label = std::string(simdLevelName(level)) + " ";
+
+        // Accuracy.
+        simdSin(x.data(), out.data(), kCount);
+        const double sin_error = maxError(ref_sin);
+        simdCos(x.data(), out.data(), kCount);
+        const double cos_error = maxError(ref_cos);
+        const MinMax minmax = simdMinMax(x.data(), kCount);
+        const bool ok = sin_error <= kSimdTrigMaxError && cos_error <= kSimdTrigMaxError &&
+                        minmax.min == *ref_minmax.first && minmax.max == *ref_minmax.second;
+        all_ok = all_ok && ok;
+
+        printResult(label + "sin max abs error", sin_error * 1e15, "1e-15");
+        printResult(label + "cos max abs error", cos_error * 1e15, "1e-15");
+        std::cout << "  " << label << "accuracy: " << (ok ? "PASS" : "FAIL") << '\n';
+
+        // Throughput.
+        const double sin_ns = kernelNsPerElement(kCount, kRepeats, [&]() { simdSin(x.data(), out.data(), kCount); });
+        printResult(label + "simdSin", sin_ns, "ns/elem");
+        printResult(label + "simdSin speedup vs std::sin", std_sin_ns / sin_ns, "x");
+        printResult(label + "simdAffine", kernelNsPerElement(kCount, kRepeats, [&]()
+        {
+            simdAffine(x.data(), out.data(), kCount, 0.5, 1.0);
+        }), "ns/elem");
+        printResult(label + "simdMultiply", kernelNsPerElement(kCount, kRepeats, [&]()
+        {
+            simdMultiply(x.data(), ref_sin.data(), out.data(), kCount);
+        }), "ns/elem");
+        printResult(label + "simdMinMax", kernelNsPerElement(kCount, kRepeats, [&]()
+        {
+            volatile double sink = simdMinMax(x.data(), kCount).max;
+            (void)sink;
+        }), "ns/elem");
+    }
+
+    setSimdLevel(detected);
+    return all_ok;
+}
+
+/**
+ * @brief Cost of the frame timing instrumentation of the plot loop, relative to the 120 Hz frame budget.
+ */
+void benchFrameStats()
+{
+    constexpr int kFrames = 1'000'000;
+    constexpr double kBudgetNs = 1e9 / 120.0;
+
+    BenchReport::instance().beginSection("Frame statistics");
+    std::cout << "[Frame statistics] " << kFrames << " frames, 120 Hz budget" << std::endl;
+
+    // Same work as the App per frame: 4 clock reads and one recordFrame().
+    FrameStats stats(std::chrono::milliseconds(8));
+    QElapsedTimer clock;
+    clock.start();
+    QElapsedTimer timer;
+    timer.start();
+    qint64 last_tick = clock.nsecsElapsed();
+    for (int i = 0; i < kFrames; ++i)
+    {
+        const qint64 tick = clock.nsecsElapsed();
+        const qint64 prep_end = clock.nsecsElapsed();
+        const qint64 end = clock.nsecsElapsed();
+        stats.recordFrame({tick - last_tick, prep_end - tick, end - prep_end, end - tick});
+        last_tick = tick;
+    }
+    const double frame_ns = static_cast<double>(timer.nsecsElapsed()) / kFrames;
+
+    // Overlay refresh: one fps/p99/missed text, 4 times per second.
+    constexpr int kRefreshes = 10'000;
+    timer.restart();
+    for (int i = 0; i < kRefreshes; ++i)
+    {
+        volatile std::int64_t sink = stats.total().percentileNs(0.99) + static_cast<std::int64_t>(stats.missedFrames());
+        (void)sink;
+    }
+    const double overlay_ns = static_cast<double>(timer.nsecsElapsed()) / kRefreshes;
+
+    printResult("instrumentation per frame", frame_ns, "ns");
+    printResult("instrumentation / frame budget", 100.0 * frame_ns / kBudgetNs, "%");
+    printResult("overlay statistics per refresh", overlay_ns, "ns");
+    printResult("overlay statistics / budget (4 Hz)", 100.0 * overlay_ns * 4.0 / 120.0 / kBudgetNs, "%");
+}
+
+/**
+ * @brief Wait until the stream of `consumer` is open (or it gave up). False on timeout or failure.
+ */
+bool waitWatching(const ChangeStreamConsumer& consumer)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(kLiveTimeoutMs);
+    while (!consumer.isWatching() && consumer.isRunning() && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    return consumer.isWatching();
+}
+
+/**
+ * @brief Run the 120 Hz GUI tick of the live curve (drain, append, render) until `done()` or the timeout.
+ */
+template <typename F>
+void runLiveTick(ChangeStreamSeries& series, BenchPlot& bench, F&& done)
+{
+    QEventLoop loop;
+    QTimer tick;
+    tick.setTimerType(Qt::PreciseTimer);
+    QObject::connect(&tick, &QTimer::timeout, [&]()
+    {
+        if (series.update(kLiveEventsPerFrame) > 0)
+        {
+            bench.render();
+            series.displayed();
+        }
+        if (done())
+            loop.quit();
+    });
+
+    tick.start(8);
+    QTimer::singleShot(kLiveTimeoutMs, &loop, &QEventLoop::quit);
+    loop.exec();
+}
+
+/**
+ * @brief Insert-to-display latency and throughput of the live curve fed by a change stream (needs a replica set).
+ *
+ * Latency: one insert_one every millisecond, stamped with the insertion time. Throughput: a burst of insert_many,
+ * displayed at most kLiveEventsPerFrame events per frame (the rest waits in the consumer queue and in the server).
+ */
+void benchChangeStream(const std::string& uri)
+{
+    if (uri.empty())
+    {
+        std::cout << "[Change stream] skipped (--mongo <uri> of a replica set to run it)" << std::endl;
+        return;
+    }
+
+    using bsoncxx::builder::basic::kvp;
+    using bsoncxx::builder::basic::make_document;
+
+    BenchReport::instance().beginSection("Change stream");
+    std::cout << "[Change stream] " << kLiveDatabase << "." << kLiveCollection << " inserts -> live curve, 8 ms tick"
+              << std::endl;
+
+    ChangeStreamConfig config;
+    config.uri = uri;
+    config.database = kLiveDatabase;
+    config.collection = kLiveCollection;
+    {
+        mongocxx::client client{mongocxx::uri{uri}};
+        client[kLiveDatabase][kLiveCollection].drop();
+    }
+
+    // Inserter thread, errors are reported and end the inserts.
+    auto insert = [&uri](auto&& body)
+    {
+        return std::thread([&uri, body]()
+        {
+            try
+            {
+                mongocxx::client client{mongocxx::uri{uri}};
+                mongocxx::collection collection = client[kLiveDatabase][kLiveCollection];
+                body(collection);
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << "[ERROR] Change stream inserts: " << e.what() << std::endl;
+            }
+        });
+    };
+
+    // Latency at a steady insert rate.
+    {
+        QwtPlotCurve* curve = new QwtPlotCurve("live");
+        RingSeriesData* data = new RingSeriesData(kLiveWindow);
+        curve->setData(data);
+        BenchPlot bench(curve);
+        bench.plot()->setAxisAutoScale(QwtPlot::yLeft);
+        ChangeStreamSeries series(config, ChangeStreamFields(), data);
+        series.start();
+        if (!waitWatching(series.consumer()))
+        {
+            std::cerr << "[ERROR] Change stream not opened: " << series.consumer().lastError() << std::endl;
+            return;
+        }
+
+        std::atomic<std::int64_t> inserted(0);
+        std::thread inserter = insert([&inserted](mongocxx::collection& collection)
+        {
+            const auto period = std::chrono::nanoseconds(1'000'000'000 / kLiveInsertRate);
+            auto next = std::chrono::steady_clock::now();
+            for (std::int64_t seq = 0; seq < kLiveInsertRate * kLiveSeconds; ++seq)
+            {
+                collection.insert_one(make_document(kvp("seq", seq), kvp("value", std::sin(0.01 * seq)),
+                                                    kvp("sent_ns", ChangeStreamConsumer::nowNs())));
+                inserted.fetch_add(1);
+                next += period;
+                std::this_thread::sleep_until(next);
+            }
+        });
+        runLiveTick(series, bench, [&series]()
+        {
+            return series.points() >= static_cast<std::uint64_t>(kLiveInsertRate * kLiveSeconds);
+        });
+        inserter.join();
+        series.stop();
+
+        const LatencyHistogram& latency = series.displayLatency();
+        const std::string label = std::to_string(kLiveInsertRate) + " inserts/s: ";
+        printResult(label + "displayed", static_cast<double>(series.points()), "docs");
+        printResult(label + "not displayed", static_cast<double>(inserted.load()) - series.points(), "docs");
+        printResult(label + "insert to display p50", latency.percentileNs(0.50) / 1e6, "ms");
+        printResult(label + "insert to display p99", latency.percentileNs(0.99) / 1e6, "ms");
+        printResult(label + "insert to display max", latency.maxNs() / 1e6, "ms");
+    }
+
+    // Throughput of a burst.
+    {
+        QwtPlotCurve* curve = new QwtPlotCurve("live");
+        RingSeriesData* data = new RingSeriesData(kLiveWindow);
+        curve->setData(data);
+        BenchPlot bench(curve);
+        bench.plot()->setAxisAutoScale(QwtPlot::yLeft);
+        ChangeStreamSeries series(config, ChangeStreamFields(), data);
+        series.start();
+        if (!waitWatching(series.consumer()))
+        {
+            std::cerr << "[ERROR] Change stream not opened: " << series.consumer().lastError() << std::endl;
+            return;
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+        std::thread inserter = insert([](mongocxx::collection& collection)
+        {
+            mongocxx::options::insert insert_options;
+            insert_options.ordered(false);
+            std::vector<bsoncxx::document::value> batch;
+            batch.reserve(kLiveInsertBatch);
+            for (std::int64_t seq = 0; seq < kLiveBurstDocs; ++seq)
+            {
+                batch.push_back(make_document(kvp("seq", seq), kvp("value", std::sin(0.01 * seq)),
+                                              kvp("sent_ns", ChangeStreamConsumer::nowNs())));
+                if (static_cast<int>(batch.size()) == kLiveInsertBatch || seq + 1 == kLiveBurstDocs)
+                {
+                    collection.insert_many(batch, insert_options);
+                    batch.clear();
+                }
+            }
+        });
+        runLiveTick(series, bench, [&series]()
+        {
+            return series.points() >= static_cast<std::uint64_t>(kLiveBurstDocs);
+        });
+        const double seconds = timer.nsecsElapsed() / 1e9;
+        inserter.join();
+        series.stop();
+
+        const ChangeStreamConsumer& consumer = series.consumer();
+        const std::string label = "burst " + std::to_string(kLiveBurstDocs / 1000) + "k: ";
+        printResult(label + "displayed", static_cast<double>(series.points()), "docs");
+        printResult(label + "insert to display throughput", series.points() / seconds, "docs/s");
+        printResult(label + "insert to display p99", series.displayLatency().percentileNs(0.99) / 1e6, "ms");
+        printResult(label + "reader backpressure waits", static_cast<double>(consumer.backpressureWaits()), "waits");
+        printResult(label + "reader backpressure time", consumer.backpressureNs() / 1e6, "ms");
+        printResult(label + "stream restarts", static_cast<double>(consumer.restarts()), "restarts");
+    }
+}
+
+/**
+ * @brief Run the 120 Hz GUI tick of the stored series (apply the loaded chunks, render) until `done()` or the timeout.
+ */
+template <typename F>
+void runSeriesTick(MongoSeriesLoader& loader, BenchPlot& bench, F&& done)
+{
+    QEventLoop loop;
+    QTimer tick;
+    tick.setTimerType(Qt::PreciseTimer);
+    QObject::connect(&tick, &QTimer::timeout, [&]()
+    {
+        if (loader.update(kSeriesChunksPerFrame) > 0)
+        {
+            bench.render();
+            loader.displayed();
+        }
+        if (done() || (!loader.isLoading() && !loader.lastError().empty()))
+            loop.quit();
+    });
+
+    tick.start(8);
+    QTimer::singleShot(kSeriesTimeoutMs, &loop, &QEventLoop::quit);
+    loop.exec();
+}
+
+/**
+ * @brief Time to first paint and total load time of a 10^7 points series stored in MongoDB, read in one go and
+ *        progressively, and the refinement time after a zoom during the load.
+ */
+void benchProgressiveLoad(const std::string& uri)
+{
+    if (uri.empty())
+    {
+        std::cout << "[Progressive load] skipped (--mongo <uri> to run it)" << std::endl;
+        return;
+    }
+
+    BenchReport::instance().beginSection("Progressive load");
+    std::cout << "[Progressive load] " << kSeriesPoints << " pts in " << kLiveDatabase << "." << kSeriesCollection
+              << ", chunks of " << MongoSeriesLoader::kChunkSamples << " pts, 8 ms tick" << std::endl;
+
+    SeriesLoaderConfig config;
+    config.uri = uri;
+    config.database = kLiveDatabase;
+    config.collection = kSeriesCollection;
+    config.series = "bench";
+
+    // Noisy sine, x in [0, 20] (as benchLod).
+    try
+    {
+        std::vector<double> x(kSeriesPoints), y(kSeriesPoints);
+        for (std::size_t i = 0; i < kSeriesPoints; ++i)
+        {
+            x[i] = 20.0 * i / kSeriesPoints;
+            y[i] = std::sin(7.0 * x[i]) * (1.0 + 0.1 * std::sin(1e3 * x[i]));
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+        mongocxx::client client{mongocxx::uri{uri}};
+        mongocxx::collection collection = client[kLiveDatabase][kSeriesCollection];
+        const std::size_t chunks = MongoSeriesLoader::store(collection, config.series, x, y);
+        printResult("store (" + std::to_string(chunks) + " chunks)", timer.nsecsElapsed() / 1e6, "ms");
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "[ERROR] Progressive load store: " << e.what() << std::endl;
+        return;
+    }
+
+    // A fresh plot, loader and data per run.
+    struct Run
+    {
+        explicit Run(const SeriesLoaderConfig& config) :
+            data(new ProgressiveSeriesData()),
+            curve(new ProgressivePlotCurve("stored")),
+            bench(curve),
+            loader(config, data)
+        {
+            this->curve->setProgressiveData(this->data); // The curve owns the data.
+            this->bench.plot()->setAxisAutoScale(QwtPlot::yLeft);
+        }
+
+        ProgressiveSeriesData* data;
+        ProgressivePlotCurve* curve;
+        BenchPlot bench;
+        MongoSeriesLoader loader;
+    };
+
+    // Baseline: every chunk read and decoded before the first paint.
+    {
+        Run run(config);
+        QElapsedTimer timer;
+        timer.start();
+        run.loader.start();
+        while (run.loader.isLoading() && timer.elapsed() < kSeriesTimeoutMs)
+        {
+            if (run.loader.update(std::numeric_limits<std::size_t>::max()) == 0)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        run.loader.update(std::numeric_limits<std::size_t>::max());
+        if (!run.data->isComplete())
+        {
+            std::cerr << "[ERROR] Progressive load: " << run.loader.lastError() << std::endl;
+            return;
+        }
+        run.bench.render();
+        printResult("load all, then paint: first paint", timer.nsecsElapsed() / 1e6, "ms");
+    }
+
+    // Progressive: overview first, then a few chunks per frame.
+    {
+        Run run(config);
+        run.loader.start();
+        runSeriesTick(run.loader, run.bench, [&run]() { return run.loader.completeNs() >= 0; });
+        const double complete_ms = run.loader.completeNs() / 1e6;
+        printResult("progressive: first paint (overview)", run.loader.firstPaintNs() / 1e6, "ms");
+        printResult("progressive: complete", complete_ms, "ms");
+        printResult("progressive: throughput", run.loader.loadedBytes() / 1048576.0 / (complete_ms / 1e3), "MiB/s");
+    }
+
+    // Zoom into the last 5% (read last in seq order) as soon as the overview is shown.
+    {
+        Run run(config);
+        std::int64_t zoom_ns = -1;
+        std::int64_t refined_ns = -1;
+        run.loader.start();
+        runSeriesTick(run.loader, run.bench, [&]()
+        {
+            if (zoom_ns < 0 && run.loader.firstPaintNs() >= 0)
+            {
+                run.bench.plot()->setAxisScale(QwtPlot::xBottom, 19.0, 20.0);
+                run.loader.setViewRange(19.0, 20.0);
+                zoom_ns = ChangeStreamConsumer::nowNs();
+            }
+            if (zoom_ns >= 0 && refined_ns < 0 && run.data->isRangeLoaded(19.0, 20.0))
+                refined_ns = ChangeStreamConsumer::nowNs() - zoom_ns;
+            return refined_ns >= 0;
+        });
+        printResult("zoom to last 5%: refined after", refined_ns / 1e6, "ms");
+        printResult("zoom to last 5%: finds abandoned", static_cast<double>(run.loader.reprioritized()), "finds");
+    }
+}
+
+/**
+ * @brief One configuration of the replot throughput grid.
+ */
+struct ReplotConfig
+{
+    int points;             ///< Points per curve.
+    int curves;             ///< Number of curves.
+    bool antialias;         ///< QwtPlotItem::RenderAntialiased.
+    double pen_width;       ///< Pen width in pixels.
+    Qt::PenStyle pen_style; ///< Qt::SolidLine or Qt::DashLine.
+};
+
+/**
+ * @brief Render one configuration until about 0.5 s is spent (3 to 60 frames) and return the mean ms per frame.
+ */
+double replotMs(const ReplotConfig& config, const std::vector<double>& x, const std::vector<std::vector<double>>& y,
+                int& frames)
+{
+    constexpr Qt::GlobalColor kColors[] = {Qt::blue, Qt::red, Qt::darkGreen, Qt::black};
+
+    BenchPlot bench;
+    for (int c = 0; c < config.curves; ++c)
+    {
+        QwtPlotCurve* curve = c == 0 ? bench.curve() : new QwtPlotCurve(QString("curve %1").arg(c));
+        curve->setRenderHint(QwtPlotItem::RenderAntialiased, config.antialias);
+        curve->setPen(QPen(kColors[c % 4], config.pen_width, config.pen_style));
+        curve->setRawSamples(x.data(), y[c].data(), config.points);
+        if (c != 0)
+            curve->attach(bench.plot()); // The plot owns the curve.
+    }
+
+    // Warm up (layout, scales, glyph caches) and size the run from the first frame.
+    QElapsedTimer timer;
+    timer.start();
+    bench.render();
+    const double first_ms = std::max(timer.nsecsElapsed() / 1e6, 0.001);
+    frames = std::clamp(static_cast<int>(500.0 / first_ms), 3, 60);
+
+    timer.start();
+    for (int f = 0; f < frames; ++f)
+        bench.render();
+    return timer.nsecsElapsed() / 1e6 / frames;
+}
+
+/**
+ * @brief Replot throughput over a grid of point counts, antialiasing, pen widths, pen styles and curve counts.
+ *
+ * The results are also written as CSV to `csv_path` (if not empty) for regression tracking.
+ */
+void benchReplotGrid(const std::string& csv_path)
+{
+    constexpr int kPointCounts[] = {1'000, 10'000, 100'000, 1'000'000};
+    constexpr int kCurveCounts[] = {1, 4};
+    constexpr double kPenWidths[] = {1.0, 2.0};
+    constexpr Qt::PenStyle kPenStyles[] = {Qt::SolidLine, Qt::DashLine};
+    constexpr int kMaxCurves = 4;
+    constexpr int kMaxPoints = 1'000'000;
+
+    BenchReport::instance().beginSection("Replot throughput");
+    std::cout << "[Replot throughput] " << kCanvasWidth << "x" << kCanvasHeight << " offscreen, QwtPlotRenderer"
+              << " into QImage" << std::endl;
+
+    // One sine per curve over the same x, shared by all the configurations (setRawSamples does not copy).
+    std::vector<double> x(kMaxPoints);
+    std::vector<std::vector<double>> y(kMaxCurves, std::vector<double>(kMaxPoints));
+    for (int i = 0; i < kMaxPoints; ++i)
+        x[i] = 20.0 * i / (kMaxPoints - 1);
+    for (int c = 0; c < kMaxCurves; ++c)
+    {
+        simdAffine(x.data(), y[c].data(), kMaxPoints, 1.0, 0.7 * c);
+        simdSin(y[c].data(), y[c].data(), kMaxPoints);
+    }
+
+    std::ofstream csv;
+    if (!csv_path.empty())
+    {
+        csv.open(csv_path, std::ios::trunc);
+        if (!csv.is_open())
+            std::cerr << "[ERROR] Cannot open " << csv_path << std::endl;
+        else
+            csv << "points,curves,antialias,pen_width,pen_style,frames,ms_per_frame,replots_per_s\n";
+    }
+
+    for (int points : kPointCounts)
+    for (int curves : kCurveCounts)
+    for (bool antialias : {false, true})
+    for (double pen_width : kPenWidths)
+    for (Qt::PenStyle pen_style : kPenStyles)
+    {
+        const ReplotConfig config{points, curves, antialias, pen_width, pen_style};
+        int frames = 0;
+        const double ms = replotMs(config, x, y, frames);
+        const char* style = pen_style == Qt::DashLine ? "dash" : "solid";
+
+        const std::string label = std::to_string(points) + " pts x" + std::to_string(curves) +
+                                  (antialias ? " AA " : " noAA ") + std::to_string(static_cast<int>(pen_width)) +
+                                  "px " + style + " ";
+        printResult(label + "frame", ms, "ms/frame");
+        printResult(label + "throughput", 1000.0 / ms, "replots/s");
+
+        if (csv.is_open())
+        {
+            csv << points << ',' << curves << ',' << (antialias ? 1 : 0) << ',' << pen_width << ',' << style << ','
+                << frames << ',' << ms << ',' << 1000.0 / ms << '\n';
+        }
+    }
+
+    if (csv.is_open())
+        std::cout << "  results written to " << csv_path << std::endl;
+}
+
+/**
+ * @brief Main entry point of the Bench_HelloWorldQwt application.
+ *
+ * Usage: Bench_HelloWorldQwt [--replot-only] [--csv <file>] [--mongo <uri>]
+ *
+ * --replot-only runs only the replot throughput grid, --csv writes its results as CSV, --mongo runs the change stream
+ * benchmark on a replica set (it drops degoras_bench.bench_stream).
+ */
+int main(int argc, char** argv)
+{
+    std::cout << "==================================" << std::endl;
+    std::cout << "= HELLO WORLD QWT BENCHMARKS     =" << std::endl;
+    std::cout << "==================================" << std::endl;
+
+    // No window is shown, run without a display unless a platform is forced.
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QApplication app(argc, argv);
+
+    bool replot_only = false;
+    std::string csv_path;
+    std::string json_path;
+    std::string mongo_uri;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg(argv[i]);
+        if (arg == "--replot-only")
+            replot_only = true;
+        else if (arg == "--csv" && i + 1 < argc)
+            csv_path = argv[++i];
+        else if (arg == "--json" && i + 1 < argc)
+            json_path = argv[++i];
+        else if (arg == "--mongo" && i + 1 < argc)
+            mongo_uri = argv[++i];
+    }
+    BenchReport::instance().setSuite("HelloWorldQwt");
+
+    // One driver instance per process (change stream and stored series runs).
+    mongocxx::instance mongo_instance{};
+
+    if (!replot_only)
+    {
+        benchCurveUpdate();
+        benchRingBounds();
+        benchLod();
+        benchStreaming();
+        benchIncremental();
+        benchFrameStats();
+        benchChangeStream(mongo_uri);
+        benchProgressiveLoad(mongo_uri);
+
+        // The kernel accuracy checks make the benchmark fail.
+        if (!benchSimdKernels())
+        {
+            std::cerr << "[ERROR] SIMD kernels out of the documented accuracy." << std::endl;
+            if (!json_path.empty())
+                BenchReport::instance().writeJson(json_path);
+            return 1;
+        }
+    }
+
+    benchReplotGrid(csv_path);
+
+    if (!json_path.empty() && !BenchReport::instance().writeJson(json_path))
+        return 1;
+
+    // All ok.
+    return 0;
+}
+
+// =====================================================================================================================
@@ -0,0 +1,137 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// BSONCXX INCLUDES
+#include <bsoncxx/document/view.hpp>
+#include <bsoncxx/types.hpp>
+
+// PROJECT INCLUDES
+#include "change_stream_series.h"
+
+namespace
+{
+
+/**
+ * @brief Stream configuration with an inserts-only pipeline.
+ */
+ChangeStreamConfig insertsOnly(ChangeStreamConfig config)
+{
+    config.pipeline = R"([{"$match": {"operationType": "insert"}}])";
+    return config;
+}
+
+/**
+ * @brief Numeric value of an element (dates in seconds). False if missing or not a number.
+ */
+bool toNumber(const bsoncxx::document::element& element, double& value)
+{
+    if (!element)
+        return false;
+
+    switch (element.type())
+    {
+    case bsoncxx::type::k_double:
+        value = element.get_double().value;
+        return true;
+    case bsoncxx::type::k_int32:
+        value = element.get_int32().value;
+        return true;
+    case bsoncxx::type::k_int64:
+        value = static_cast<double>(element.get_int64().value);
+        return true;
+    case bsoncxx::type::k_date:
+        value = element.get_date().value.count() / 1000.0;
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // namespace
+
+// =====================================================================================================================
+
+ChangeStreamSeries::ChangeStreamSeries(const ChangeStreamConfig& config, const ChangeStreamFields& fields,
+                                       RingSeriesData* data) :
+    consumer_(insertsOnly(config)),
+    fields_(fields),
+    data_(data),
+    points_(0),
+    skipped_(0)
+{}
+
+void ChangeStreamSeries::start()
+{
+    this->consumer_.start();
+}
+
+void ChangeStreamSeries::stop()
+{
+    this->consumer_.stop();
+}
+
+std::size_t ChangeStreamSeries::update(std::size_t max_events)
+{
+    this->events_.clear();
+    if (this->consumer_.drain(this->events_, max_events) == 0)
+        return 0;
+
+    this->block_.clear();
+    for (const ChangeEvent& event : this->events_)
+    {
+        double x = 0.0;
+        double y = 0.0;
+        if (!event.document || !toNumber(event.document->view()[this->fields_.x], x)
+            || !toNumber(event.document->view()[this->fields_.y], y))
+        {
+            ++this->skipped_;
+            continue;
+        }
+        this->block_.emplace_back(x, y);
+
+        const bsoncxx::document::element stamp = event.document->view()[this->fields_.stamp];
+        this->pending_ns_.push_back(stamp && stamp.type() == bsoncxx::type::k_int64 ? stamp.get_int64().value
+                                                                                    : event.received_ns);
+    }
+
+    this->data_->append(this->block_.data(), this->block_.size());
+    this->points_ += this->block_.size();
+    return this->block_.size();
+}
+
+void ChangeStreamSeries::displayed()
+{
+    const std::int64_t now_ns = ChangeStreamConsumer::nowNs();
+    for (const std::int64_t start_ns : this->pending_ns_)
+        this->display_latency_.record(now_ns - start_ns);
+    this->pending_ns_.clear();
+}
+
+const ChangeStreamConsumer& ChangeStreamSeries::consumer() const noexcept
+{
+    return this->consumer_;
+}
+
+std::uint64_t ChangeStreamSeries::points() const noexcept
+{
+    return this->points_;
+}
+
+std::uint64_t ChangeStreamSeries::skipped() const noexcept
+{
+    return this->skipped_;
+}
+
+const LatencyHistogram& ChangeStreamSeries::displayLatency() const noexcept
+{
+    return this->display_latency_;
+}
+
+// =====================================================================================================================
@@ -0,0 +1,96 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldQwt – Live curve fed by the documents inserted in a MongoDB collection (change stream)
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// QT INCLUDES
+#include <QPointF>
+
+// PROJECT INCLUDES
+#include "change_stream_consumer.h"
+#include "latency_histogram.h"
+#include "ring_series_data.h"
+
+/**
+ * @brief Fields of the inserted documents plotted by a ChangeStreamSeries.
+ */
+struct ChangeStreamFields
+{
+    std::string x = "seq";            ///< Abscissa (number or date, dates in seconds).
+    std::string y = "value";          ///< Ordinate (number).
+    std::string stamp = "sent_ns";    ///< Insertion time in ChangeStreamConsumer::nowNs() clock, if present.
+};
+
+/**
+ * @brief Appends the (x, y) of each inserted document to a RingSeriesData, a few batches per frame.
+ *
+ * The change stream only asks for the inserts. update() runs in the GUI thread once per frame: it drains at most
+ * `max_events` (the rest wait in the consumer queue and then in the server) and appends the points in place, the
+ * curve is never reloaded. Documents without numeric x and y are counted and skipped.
+ *
+ * displayed() closes the insert-to-display latency of the points appended since the last call: from the `stamp`
+ * field when the writer sets it (same host), otherwise from the time the event was read.
+ */
+class ChangeStreamSeries
+{
+public:
+
+    /**
+     * @param config Stream (its pipeline is replaced by an inserts-only one).
+     * @param fields Plotted fields.
+     * @param data Series of the curve, owned by the curve.
+     */
+    ChangeStreamSeries(const ChangeStreamConfig& config, const ChangeStreamFields& fields, RingSeriesData* data);
+
+    void start();
+
+    void stop();
+
+    /**
+     * @brief Drain up to `max_events` and append their points. Returns the points appended.
+     */
+    std::size_t update(std::size_t max_events);
+
+    /**
+     * @brief Record the latency of the points appended since the last call (call it after the replot).
+     */
+    void displayed();
+
+    const ChangeStreamConsumer& consumer() const noexcept;
+
+    std::uint64_t points() const noexcept;
+
+    std::uint64_t skipped() const noexcept;
+
+    const LatencyHistogram& displayLatency() const noexcept;
+
+private:
+
+    ChangeStreamConsumer consumer_;
+    ChangeStreamFields fields_;
+    RingSeriesData* data_;
+    std::vector<ChangeEvent> events_;
+    std::vector<QPointF> block_;
+    std::vector<std::int64_t> pending_ns_;   // Start of the latency of the points not displayed yet.
+    std::uint64_t points_;
+    std::uint64_t skipped_;
+    LatencyHistogram display_latency_;
+};
+
+// =====================================================================================================================
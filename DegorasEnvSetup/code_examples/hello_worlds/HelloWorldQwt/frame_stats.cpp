@@ -0,0 +1,207 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+// PROJECT INCLUDES
+#include "frame_stats.h"
+
+namespace
+{
+
+// Percentiles of the dumps.
+constexpr double kQuantiles[] = {0.5, 0.9, 0.99, 0.999};
+constexpr const char* kQuantileNames[] = {"p50", "p90", "p99", "p999"};
+
+/**
+ * @brief Nanoseconds to milliseconds.
+ */
+inline double toMs(double ns)
+{
+    return ns / 1e6;
+}
+
+} // namespace
+
+// =====================================================================================================================
+// FrameStats
+// =====================================================================================================================
+
+FrameStats::FrameStats(std::chrono::nanoseconds period) noexcept :
+    period_(period),
+    frames_(0),
+    missed_(0)
+{}
+
+void FrameStats::recordFrame(const FrameTiming& timing) noexcept
+{
+    this->lateness_.record(timing.lateness_ns);
+    this->prep_.record(timing.prep_ns);
+    this->replot_.record(timing.replot_ns);
+    this->total_.record(timing.total_ns);
+    this->frames_.fetch_add(1, std::memory_order_relaxed);
+
+    // Skipped ticks, then the frame itself if it finished after its deadline.
+    const std::int64_t period = std::max<std::int64_t>(this->period_.count(), 1);
+    const std::int64_t lateness = std::max<std::int64_t>(timing.lateness_ns, 0);
+    std::uint64_t missed = static_cast<std::uint64_t>(lateness / period);
+    if (lateness % period + timing.total_ns > period)
+        ++missed;
+    if (missed)
+        this->missed_.fetch_add(missed, std::memory_order_relaxed);
+}
+
+void FrameStats::reset() noexcept
+{
+    this->lateness_.reset();
+    this->prep_.reset();
+    this->replot_.reset();
+    this->total_.reset();
+    this->frames_.store(0, std::memory_order_relaxed);
+    this->missed_.store(0, std::memory_order_relaxed);
+}
+
+std::chrono::nanoseconds FrameStats::period() const noexcept
+{
+    return this->period_;
+}
+
+std::uint64_t FrameStats::frames() const noexcept
+{
+    return this->frames_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t FrameStats::missedFrames() const noexcept
+{
+    return this->missed_.load(std::memory_order_relaxed);
+}
+
+const LatencyHistogram& FrameStats::lateness() const noexcept
+{
+    return this->lateness_;
+}
+
+const LatencyHistogram& FrameStats::prep() const noexcept
+{
+    return this->prep_;
+}
+
+const LatencyHistogram& FrameStats::replot() const noexcept
+{
+    return this->replot_;
+}
+
+const LatencyHistogram& FrameStats::total() const noexcept
+{
+    return this->total_;
+}
+
+std::array<std::pair<const char*, const LatencyHistogram*>, 4> FrameStats::histograms() const noexcept
+{
+    return {{{"lateness", &this->lateness_}, {"prep", &this->prep_}, {"replot", &this->replot_},
+             {"total", &this->total_}}};
+}
+
+std::string FrameStats::summary() const
+{
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3);
+    out << "frames " << this->frames() << ", missed " << this->missedFrames()
+        << ", budget " << toMs(static_cast<double>(this->period_.count())) << " ms\n";
+
+    for (const auto& [name, histogram] : this->histograms())
+    {
+        out << "  " << std::left << std::setw(10) << name << std::right
+            << " mean " << toMs(histogram->meanNs())
+            << " p99 " << toMs(static_cast<double>(histogram->percentileNs(0.99)))
+            << " max " << toMs(static_cast<double>(histogram->maxNs())) << " ms\n";
+    }
+    return out.str();
+}
+
+std::string FrameStats::toCsv() const
+{
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(6);
+    out << "metric,count,mean_ms";
+    for (const char* name : kQuantileNames)
+        out << ',' << name << "_ms";
+    out << ",max_ms,frames,missed_frames,budget_ms\n";
+
+    for (const auto& [name, histogram] : this->histograms())
+    {
+        out << name << ',' << histogram->count() << ',' << toMs(histogram->meanNs());
+        for (double q : kQuantiles)
+            out << ',' << toMs(static_cast<double>(histogram->percentileNs(q)));
+        out << ',' << toMs(static_cast<double>(histogram->maxNs())) << ',' << this->frames() << ','
+            << this->missedFrames() << ',' << toMs(static_cast<double>(this->period_.count())) << '\n';
+    }
+    return out.str();
+}
+
+std::string FrameStats::toJson() const
+{
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(6);
+    out << "{\n  \"budget_ms\": " << toMs(static_cast<double>(this->period_.count()))
+        << ",\n  \"frames\": " << this->frames()
+        << ",\n  \"missed_frames\": " << this->missedFrames()
+        << ",\n  \"metrics\": {";
+
+    bool first_metric = true;
+    for (const auto& [name, histogram] : this->histograms())
+    {
+        out << (first_metric ? "" : ",") << "\n    \"" << name << "\": {\"count\": " << histogram->count()
+            << ", \"mean_ms\": " << toMs(histogram->meanNs());
+        for (std::size_t i = 0; i < std::size(kQuantiles); ++i)
+        {
+            out << ", \"" << kQuantileNames[i] << "_ms\": "
+                << toMs(static_cast<double>(histogram->percentileNs(kQuantiles[i])));
+        }
+        out << ", \"max_ms\": " << toMs(static_cast<double>(histogram->maxNs()));
+
+        // Only the used buckets, as [upper bound ms, count] pairs.
+        out << ", \"buckets\": [";
+        bool first_bucket = true;
+        for (std::size_t i = 0; i < LatencyHistogram::kBucketCount; ++i)
+        {
+            const std::uint64_t count = histogram->bucketCount(i);
+            if (!count)
+                continue;
+            out << (first_bucket ? "" : ", ") << '[' << toMs(static_cast<double>(LatencyHistogram::bucketUpperNs(i)))
+                << ", " << count << ']';
+            first_bucket = false;
+        }
+        out << "]}";
+        first_metric = false;
+    }
+    out << "\n  }\n}\n";
+    return out.str();
+}
+
+bool FrameStats::write(const std::string& path) const
+{
+    const bool json = path.size() >= 5 && path.compare(path.size() - 5, 5, ".json") == 0;
+    std::ofstream file(path, std::ios::trunc);
+    if (!file)
+    {
+        std::cerr << "[FrameStats] Cannot open " << path << std::endl;
+        return false;
+    }
+    file << (json ? this->toJson() : this->toCsv());
+    return static_cast<bool>(file);
+}
+
+// =====================================================================================================================
@@ -0,0 +1,103 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldQwt – Frame timing statistics for the plot loop
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+// PROJECT INCLUDES
+#include "latency_histogram.h"
+
+/**
+ * @brief Timings of one frame of the plot loop, in nanoseconds.
+ */
+struct FrameTiming
+{
+    std::int64_t lateness_ns;   ///< Tick interval minus the timer period (time the callback started late).
+    std::int64_t prep_ns;       ///< Data preparation (generation, queue drain, curve data update).
+    std::int64_t replot_ns;     ///< replot() or incremental drawing.
+    std::int64_t total_ns;      ///< Whole callback.
+};
+
+/**
+ * @brief Frame timing statistics of a periodic plot loop.
+ *
+ * A frame is missed when the timer ticks are late by whole periods (those ticks never ran) or when the lateness
+ * plus the callback time overruns the period (the frame is shown on the next tick).
+ */
+class FrameStats
+{
+public:
+
+    explicit FrameStats(std::chrono::nanoseconds period) noexcept;
+
+    /**
+     * @brief Record the timings of one frame.
+     */
+    void recordFrame(const FrameTiming& timing) noexcept;
+
+    /**
+     * @brief Clear all the statistics.
+     */
+    void reset() noexcept;
+
+    std::chrono::nanoseconds period() const noexcept;
+
+    std::uint64_t frames() const noexcept;
+
+    std::uint64_t missedFrames() const noexcept;
+
+    const LatencyHistogram& lateness() const noexcept;
+
+    const LatencyHistogram& prep() const noexcept;
+
+    const LatencyHistogram& replot() const noexcept;
+
+    const LatencyHistogram& total() const noexcept;
+
+    /**
+     * @brief Human readable summary (one line per histogram).
+     */
+    std::string summary() const;
+
+    /**
+     * @brief Write the statistics to `path`: JSON (summary + buckets) if it ends with ".json", CSV summary otherwise.
+     * @return False if the file cannot be written.
+     */
+    bool write(const std::string& path) const;
+
+private:
+
+    std::array<std::pair<const char*, const LatencyHistogram*>, 4> histograms() const noexcept;
+
+    std::string toCsv() const;
+
+    std::string toJson() const;
+
+    std::chrono::nanoseconds period_;
+    std::atomic<std::uint64_t> frames_;
+    std::atomic<std::uint64_t> missed_;
+    LatencyHistogram lateness_;
+    LatencyHistogram prep_;
+    LatencyHistogram replot_;
+    LatencyHistogram total_;
+};
+
+// =====================================================================================================================
@@ -0,0 +1,136 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <cmath>
+
+// QT INCLUDES
+#include <QEvent>
+
+// PROJECT INCLUDES
+#include "incremental_plotter.h"
+
+namespace
+{
+
+/**
+ * @brief Check if two maps transform the same scale interval to the same pixel interval.
+ */
+bool sameMap(const QwtScaleMap& a, const QwtScaleMap& b)
+{
+    return a.s1() == b.s1() && a.s2() == b.s2() && a.p1() == b.p1() && a.p2() == b.p2();
+}
+
+} // namespace
+
+// =====================================================================================================================
+
+IncrementalPlotter::IncrementalPlotter(QwtPlot* plot, QwtPlotCurve* curve, RingSeriesData* data, double window) :
+    QObject(plot),
+    plot_(plot),
+    curve_(curve),
+    data_(data),
+    painter_(new QwtPlotDirectPainter(this)),
+    window_(window > 0.0 ? window : 1.0),
+    x0_(0.0),
+    drawn_(0),
+    replot_req_(true),
+    last_x_map_(),
+    last_y_map_(),
+    full_replots_(0),
+    incremental_draws_(0)
+{
+    // Keep the segments in the backing store, so an expose does not erase them.
+    this->painter_->setAttribute(QwtPlotDirectPainter::CopyBackingStore, true);
+
+    this->plot_->setAxisScale(this->curve_->xAxis(), this->x0_, this->x0_ + this->window_);
+    this->plot_->canvas()->installEventFilter(this);
+}
+
+void IncrementalPlotter::append(const QPointF* points, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        // Wrap-around: restart the data at the window of the new sample.
+        if (points[i].x() >= this->x0_ + this->window_ || this->data_->size() == this->data_->capacity())
+        {
+            this->x0_ = std::floor(points[i].x() / this->window_) * this->window_;
+            this->plot_->setAxisScale(this->curve_->xAxis(), this->x0_, this->x0_ + this->window_);
+            this->data_->clear();
+            this->drawn_ = 0;
+            this->replot_req_ = true;
+        }
+        this->data_->append(points[i]);
+    }
+}
+
+void IncrementalPlotter::render()
+{
+    const std::size_t size = this->data_->size();
+
+    if (this->replot_req_ || this->scalesChanged())
+    {
+        this->plot_->replot();
+        this->scalesChanged(); // Store the maps after the replot.
+        this->replot_req_ = false;
+        this->drawn_ = size;
+        ++this->full_replots_;
+        return;
+    }
+
+    if (size > this->drawn_)
+    {
+        // Start at the last drawn sample so the new segment is connected.
+        const int from = this->drawn_ > 0 ? static_cast<int>(this->drawn_ - 1) : 0;
+        this->painter_->drawSeries(this->curve_, from, static_cast<int>(size - 1));
+        this->drawn_ = size;
+        ++this->incremental_draws_;
+    }
+}
+
+void IncrementalPlotter::invalidate() noexcept
+{
+    this->replot_req_ = true;
+}
+
+std::uint64_t IncrementalPlotter::fullReplots() const noexcept
+{
+    return this->full_replots_;
+}
+
+std::uint64_t IncrementalPlotter::incrementalDraws() const noexcept
+{
+    return this->incremental_draws_;
+}
+
+bool IncrementalPlotter::eventFilter(QObject* object, QEvent* event)
+{
+    // The backing store is rebuilt on resize, the direct painter state is no longer valid.
+    if (object == this->plot_->canvas() && event->type() == QEvent::Resize)
+    {
+        this->painter_->reset();
+        this->replot_req_ = true;
+    }
+    return QObject::eventFilter(object, event);
+}
+
+bool IncrementalPlotter::scalesChanged()
+{
+    // Zoom/pan change the scale intervals, resize changes the pixel intervals.
+    const QwtScaleMap x_map = this->plot_->canvasMap(this->curve_->xAxis());
+    const QwtScaleMap y_map = this->plot_->canvasMap(this->curve_->yAxis());
+    const bool changed = !sameMap(x_map, this->last_x_map_) || !sameMap(y_map, this->last_y_map_);
+
+    this->last_x_map_ = x_map;
+    this->last_y_map_ = y_map;
+    return changed;
+}
+
+// =====================================================================================================================
@@ -0,0 +1,97 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldQwt – Incremental rendering of an append-only curve with QwtPlotDirectPainter
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <cstddef>
+#include <cstdint>
+
+// QT INCLUDES
+#include <QObject>
+#include <QPointF>
+
+// QWT INCLUDES
+#include <qwt/qwt_plot.h>
+#include <qwt/qwt_plot_curve.h>
+#include <qwt/qwt_plot_directpainter.h>
+#include <qwt/qwt_scale_map.h>
+
+// PROJECT INCLUDES
+#include "ring_series_data.h"
+
+/**
+ * @brief Sweep-mode driver that draws only the new segments of an append-only curve.
+ *
+ * The curve shows a fixed x window [x0, x0 + window). New samples are painted with QwtPlotDirectPainter straight on
+ * the canvas and into its backing store, so the grid, the legend and the other items are not repainted. A full
+ * replot is only done when the samples leave the window (wrap-around: the data restarts at the next window), when
+ * the canvas is resized, or when the scales change (zoom, pan, autoscale).
+ *
+ * The data capacity must hold a whole window, it is never scrolled.
+ */
+class IncrementalPlotter : public QObject
+{
+public:
+
+    /**
+     * @param plot Plot that owns the curve.
+     * @param curve Append-only curve, attached to the plot.
+     * @param data Series of the curve (owned by the curve).
+     * @param window Width of the x window, in x units.
+     */
+    IncrementalPlotter(QwtPlot* plot, QwtPlotCurve* curve, RingSeriesData* data, double window);
+
+    /**
+     * @brief Append samples with increasing x. Nothing is drawn until render().
+     */
+    void append(const QPointF* points, std::size_t count);
+
+    /**
+     * @brief Draw the samples appended since the last call, or replot if needed.
+     */
+    void render();
+
+    /**
+     * @brief Force a full replot on the next render().
+     */
+    void invalidate() noexcept;
+
+    std::uint64_t fullReplots() const noexcept;
+
+    std::uint64_t incrementalDraws() const noexcept;
+
+protected:
+
+    bool eventFilter(QObject* object, QEvent* event) override;
+
+private:
+
+    bool scalesChanged();
+
+    QwtPlot* plot_;
+    QwtPlotCurve* curve_;
+    RingSeriesData* data_;
+    QwtPlotDirectPainter* painter_;
+    double window_;
+    double x0_;
+    std::size_t drawn_;
+    bool replot_req_;
+    QwtScaleMap last_x_map_;
+    QwtScaleMap last_y_map_;
+    std::uint64_t full_replots_;
+    std::uint64_t incremental_draws_;
+};
+
+// =====================================================================================================================
@@ -0,0 +1,233 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// QWT INCLUDES
+#include <qwt/qwt_scale_map.h>
+
+// PROJECT INCLUDES
+#include "lod_series_data.h"
+
+namespace
+{
+
+// Levels coarser than this number of buckets are not built.
+constexpr std::size_t kMinLevelBuckets = 64;
+
+} // namespace
+
+// =====================================================================================================================
+// LodSeriesData
+// =====================================================================================================================
+
+LodSeriesData::LodSeriesData() :
+    bounds_(1.0, 1.0, -2.0, -2.0),
+    level_(0),
+    raw_first_(0),
+    raw_count_(0)
+{}
+
+void LodSeriesData::setSamples(std::vector<double> x, std::vector<double> y)
+{
+    const std::size_t count = std::min(x.size(), y.size());
+    x.resize(count);
+    y.resize(count);
+    this->x_ = std::move(x);
+    this->y_ = std::move(y);
+
+    this->buildPyramid();
+
+    // Full-resolution view of everything until the first select().
+    this->level_ = 0;
+    this->raw_first_ = 0;
+    this->raw_count_ = count;
+}
+
+void LodSeriesData::select(double x_min, double x_max, double pixels) const
+{
+    const std::size_t n = this->x_.size();
+    if (x_min > x_max)
+        std::swap(x_min, x_max);
+
+    // Visible index range, plus one sample on each side so the line reaches the canvas edges.
+    std::size_t first = static_cast<std::size_t>(
+        std::lower_bound(this->x_.begin(), this->x_.end(), x_min) - this->x_.begin());
+    std::size_t last = static_cast<std::size_t>(
+        std::upper_bound(this->x_.begin(), this->x_.end(), x_max) - this->x_.begin());
+    first = first > 0 ? first - 1 : 0;
+    last = std::min(last + 1, n);
+
+    // Finest level with at most two buckets per pixel (four samples per pixel at most).
+    const std::size_t target = 2 * static_cast<std::size_t>(std::max(1.0, std::ceil(pixels)));
+    std::size_t level = 0;
+    std::size_t bucket_size = 1;
+    while (level < this->levels_.size() && (last - first) / bucket_size > target)
+    {
+        ++level;
+        bucket_size *= kLodFactor;
+    }
+
+    this->level_ = level;
+    if (level == 0)
+    {
+        // Full resolution: the view is just an offset into the raw samples.
+        this->raw_first_ = first;
+        this->raw_count_ = last - first;
+        this->view_.clear();
+        return;
+    }
+
+    // Min and max of each visible bucket, in x order. The buffer only grows, so steady state does not allocate.
+    const std::vector<Bucket>& buckets = this->levels_[level - 1];
+    const std::size_t b_first = first / bucket_size;
+    const std::size_t b_last = std::min((last + bucket_size - 1) / bucket_size, buckets.size());
+
+    this->view_.clear();
+    this->view_.reserve(2 * (b_last - b_first));
+    for (std::size_t b = b_first; b < b_last; ++b)
+    {
+        const std::uint32_t lo = std::min(buckets[b].min_idx, buckets[b].max_idx);
+        const std::uint32_t hi = std::max(buckets[b].min_idx, buckets[b].max_idx);
+        this->view_.emplace_back(this->x_[lo], this->y_[lo]);
+        if (hi != lo)
+            this->view_.emplace_back(this->x_[hi], this->y_[hi]);
+    }
+}
+
+std::size_t LodSeriesData::rawSize() const noexcept
+{
+    return this->x_.size();
+}
+
+std::size_t LodSeriesData::selectedLevel() const noexcept
+{
+    return this->level_;
+}
+
+const std::vector<double>& LodSeriesData::xData() const noexcept
+{
+    return this->x_;
+}
+
+const std::vector<double>& LodSeriesData::yData() const noexcept
+{
+    return this->y_;
+}
+
+size_t LodSeriesData::size() const
+{
+    return this->level_ == 0 ? this->raw_count_ : this->view_.size();
+}
+
+QPointF LodSeriesData::sample(size_t i) const
+{
+    if (this->level_ == 0)
+        return QPointF(this->x_[this->raw_first_ + i], this->y_[this->raw_first_ + i]);
+    return this->view_[i];
+}
+
+QRectF LodSeriesData::boundingRect() const
+{
+    // Always the full data, so autoscaling does not depend on the current view.
+    return this->bounds_;
+}
+
+void LodSeriesData::buildPyramid()
+{
+    this->levels_.clear();
+
+    const std::size_t n = this->x_.size();
+    if (n == 0)
+    {
+        this->bounds_ = QRectF(1.0, 1.0, -2.0, -2.0);
+        return;
+    }
+
+    // First level, straight from the samples.
+    std::vector<Bucket> level((n + kLodFactor - 1) / kLodFactor);
+    for (std::size_t b = 0; b < level.size(); ++b)
+    {
+        const std::size_t begin = b * kLodFactor;
+        const std::size_t end = std::min(begin + kLodFactor, n);
+        std::size_t min_idx = begin;
+        std::size_t max_idx = begin;
+        for (std::size_t i = begin + 1; i < end; ++i)
+        {
+            if (this->y_[i] < this->y_[min_idx]) min_idx = i;
+            if (this->y_[i] > this->y_[max_idx]) max_idx = i;
+        }
+        level[b] = {static_cast<std::uint32_t>(min_idx), static_cast<std::uint32_t>(max_idx)};
+    }
+    this->levels_.push_back(std::move(level));
+
+    // Next levels, from the previous one.
+    while (this->levels_.back().size() > kMinLevelBuckets)
+    {
+        const std::vector<Bucket>& prev = this->levels_.back();
+        std::vector<Bucket> next((prev.size() + kLodFactor - 1) / kLodFactor);
+        for (std::size_t b = 0; b < next.size(); ++b)
+        {
+            const std::size_t begin = b * kLodFactor;
+            const std::size_t end = std::min(begin + kLodFactor, prev.size());
+            Bucket bucket = prev[begin];
+            for (std::size_t i = begin + 1; i < end; ++i)
+            {
+                if (this->y_[prev[i].min_idx] < this->y_[bucket.min_idx]) bucket.min_idx = prev[i].min_idx;
+                if (this->y_[prev[i].max_idx] > this->y_[bucket.max_idx]) bucket.max_idx = prev[i].max_idx;
+            }
+            next[b] = bucket;
+        }
+        this->levels_.push_back(std::move(next));
+    }
+
+    // The coarsest level gives the y range in a few steps.
+    double y_min = std::numeric_limits<double>::max();
+    double y_max = std::numeric_limits<double>::lowest();
+    for (const Bucket& bucket : this->levels_.back())
+    {
+        y_min = std::min(y_min, this->y_[bucket.min_idx]);
+        y_max = std::max(y_max, this->y_[bucket.max_idx]);
+    }
+    this->bounds_ = QRectF(this->x_.front(), y_min, this->x_.back() - this->x_.front(), y_max - y_min);
+}
+
+// =====================================================================================================================
+// LodPlotCurve
+// =====================================================================================================================
+
+LodPlotCurve::LodPlotCurve(const QString& title) :
+    QwtPlotCurve(title),
+    lod_(nullptr)
+{}
+
+void LodPlotCurve::setLodData(LodSeriesData* data)
+{
+    this->lod_ = data;
+    this->setData(data);
+}
+
+void LodPlotCurve::drawSeries(QPainter* painter, const QwtScaleMap& x_map, const QwtScaleMap& y_map,
+                              const QRectF& canvas_rect, int from, int to) const
+{
+    // The indices given by Qwt refer to the previous view, draw the whole refreshed one.
+    if (this->lod_)
+    {
+        this->lod_->select(x_map.s1(), x_map.s2(), std::abs(x_map.pDist()));
+        from = 0;
+        to = -1;
+    }
+    QwtPlotCurve::drawSeries(painter, x_map, y_map, canvas_rect, from, to);
+}
+
+// =====================================================================================================================
@@ -0,0 +1,126 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldQwt – Min/max level-of-detail series for multi-million-point curves
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// QT INCLUDES
+#include <QPointF>
+#include <QRectF>
+
+// QWT INCLUDES
+#include <qwt/qwt_series_data.h>
+#include <qwt/qwt_plot_curve.h>
+
+/**
+ * @brief QwtSeriesData that exposes a decimated view of a large, x-sorted series.
+ *
+ * A min/max pyramid is built once over the samples: each level groups kLodFactor buckets of the previous one and
+ * keeps the indices of their minimum and maximum. For a visible x range and a width in pixels, select() picks the
+ * finest level with at most two buckets per pixel and exposes two samples (min and max, in x order) per bucket. The
+ * rendered count is then O(pixels) whatever the size of the data, and no peak is lost. Indices are 32-bit, so a
+ * series holds up to 2^32 samples.
+ *
+ * The view is refreshed by LodPlotCurve on every draw, so zooming and panning just work.
+ */
+class LodSeriesData final : public QwtSeriesData<QPointF>
+{
+public:
+
+    static constexpr std::size_t kLodFactor = 8;   ///< Buckets of a level grouped by each bucket of the next one.
+
+    LodSeriesData();
+
+    /**
+     * @brief Replace the samples and rebuild the pyramid. The x values must be non-decreasing.
+     */
+    void setSamples(std::vector<double> x, std::vector<double> y);
+
+    /**
+     * @brief Refresh the view for the visible x range and its width in pixels.
+     */
+    void select(double x_min, double x_max, double pixels) const;
+
+    /**
+     * @brief Number of full-resolution samples.
+     */
+    std::size_t rawSize() const noexcept;
+
+    /**
+     * @brief Pyramid level of the current view (0 = full resolution).
+     */
+    std::size_t selectedLevel() const noexcept;
+
+    const std::vector<double>& xData() const noexcept;
+
+    const std::vector<double>& yData() const noexcept;
+
+    size_t size() const override;
+
+    QPointF sample(size_t i) const override;
+
+    QRectF boundingRect() const override;
+
+private:
+
+    /**
+     * @brief Indices of the extremes of one bucket.
+     */
+    struct Bucket
+    {
+        std::uint32_t min_idx;
+        std::uint32_t max_idx;
+    };
+
+    void buildPyramid();
+
+    std::vector<double> x_;
+    std::vector<double> y_;
+    std::vector<std::vector<Bucket>> levels_;   // levels_[k - 1] groups kLodFactor^k samples per bucket.
+    QRectF bounds_;
+
+    // Current view.
+    mutable std::size_t level_;
+    mutable std::size_t raw_first_;
+    mutable std::size_t raw_count_;
+    mutable std::vector<QPointF> view_;
+};
+
+/**
+ * @brief QwtPlotCurve that refreshes its LodSeriesData view for the current scale and canvas width before drawing.
+ */
+class LodPlotCurve final : public QwtPlotCurve
+{
+public:
+
+    explicit LodPlotCurve(const QString& title = QString());
+
+    /**
+     * @brief Attach the data (the curve takes the ownership, as with setData()).
+     */
+    void setLodData(LodSeriesData* data);
+
+    void drawSeries(QPainter* painter, const QwtScaleMap& x_map, const QwtScaleMap& y_map,
+                    const QRectF& canvas_rect, int from, int to) const override;
+
+private:
+
+    LodSeriesData* lod_;
+};
+
+// =====================================================================================================================
@@ -0,0 +1,498 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+// BSONCXX INCLUDES
+#include <bsoncxx/builder/basic/array.hpp>
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/document/view.hpp>
+#include <bsoncxx/types.hpp>
+
+// MONGOCXX INCLUDES
+#include <mongocxx/client.hpp>
+#include <mongocxx/options/find.hpp>
+#include <mongocxx/uri.hpp>
+
+// PROJECT INCLUDES
+#include "mongo_series_loader.h"
+
+namespace
+{
+
+// Chunks per insert_many of store() (8 MiB per message).
+constexpr std::size_t kStoreBatch = 8;
+
+/**
+ * @brief Numeric value of an element (0 if missing or not a number).
+ */
+double readNumber(const bsoncxx::document::element& element)
+{
+    if (!element)
+        return 0.0;
+
+    switch (element.type())
+    {
+    case bsoncxx::type::k_double:
+        return element.get_double().value;
+    case bsoncxx::type::k_int32:
+        return element.get_int32().value;
+    case bsoncxx::type::k_int64:
+        return static_cast<double>(element.get_int64().value);
+    default:
+        return 0.0;
+    }
+}
+
+/**
+ * @brief Doubles of a binary element. False if missing, not binary or not a whole number of doubles.
+ */
+bool readDoubles(const bsoncxx::document::element& element, std::vector<double>& values)
+{
+    if (!element || element.type() != bsoncxx::type::k_binary)
+        return false;
+
+    const auto binary = element.get_binary();
+    if (binary.size % sizeof(double) != 0)
+        return false;
+    values.resize(binary.size / sizeof(double));
+    if (!values.empty())
+        std::memcpy(values.data(), binary.bytes, binary.size);
+    return true;
+}
+
+/**
+ * @brief Binary element of `count` doubles (host byte order, the bytes are copied by the builder).
+ */
+bsoncxx::types::b_binary binaryOf(const double* values, std::size_t count)
+{
+    return bsoncxx::types::b_binary{bsoncxx::binary_sub_type::k_binary,
+                                    static_cast<std::uint32_t>(count * sizeof(double)),
+                                    reinterpret_cast<const std::uint8_t*>(values)};
+}
+
+} // namespace
+
+// =====================================================================================================================
+
+MongoSeriesLoader::MongoSeriesLoader(const SeriesLoaderConfig& config, ProgressiveSeriesData* data) :
+    config_(config),
+    data_(data),
+    overview_ready_(false),
+    view_min_(0.0),
+    view_max_(0.0),
+    has_view_(false),
+    view_generation_(0),
+    overview_applied_(false),
+    start_ns_(0),
+    first_paint_ns_(-1),
+    complete_ns_(-1),
+    stop_req_(false),
+    loading_(false),
+    loaded_bytes_(0),
+    reprioritized_(0)
+{
+    this->config_.chunks_per_query = std::max<std::size_t>(this->config_.chunks_per_query, 1);
+    this->config_.max_queued_chunks = std::max<std::size_t>(this->config_.max_queued_chunks, 1);
+}
+
+MongoSeriesLoader::~MongoSeriesLoader()
+{
+    this->cancel();
+}
+
+void MongoSeriesLoader::setNotifier(std::function<void()> notifier)
+{
+    this->notifier_ = std::move(notifier);
+}
+
+void MongoSeriesLoader::start()
+{
+    if (this->worker_.joinable())
+        return;
+
+    this->start_ns_ = MongoSeriesLoader::nowNs();
+    this->stop_req_.store(false);
+    this->loading_.store(true);
+    this->worker_ = std::thread(&MongoSeriesLoader::run, this);
+}
+
+void MongoSeriesLoader::cancel()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->stop_req_.store(true);
+    }
+    this->space_cv_.notify_all();
+    if (this->worker_.joinable())
+        this->worker_.join();
+
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    this->queue_.clear();
+}
+
+void MongoSeriesLoader::setViewRange(double x_min, double x_max)
+{
+    if (x_min > x_max)
+        std::swap(x_min, x_max);
+
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    if (this->has_view_ && x_min == this->view_min_ && x_max == this->view_max_)
+        return;
+    this->view_min_ = x_min;
+    this->view_max_ = x_max;
+    this->has_view_ = true;
+    this->view_generation_.fetch_add(1);
+}
+
+std::size_t MongoSeriesLoader::update(std::size_t max_chunks)
+{
+    std::size_t changes = 0;
+
+    // The overview comes first, the chunks refer to its positions.
+    if (!this->overview_applied_)
+    {
+        std::vector<SeriesChunkSummary> overview;
+        {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            if (!this->overview_ready_)
+                return 0;
+            overview = std::move(this->overview_);
+        }
+        this->data_->setOverview(std::move(overview));
+        this->overview_applied_ = true;
+        ++changes;
+    }
+
+    std::vector<LoadedChunk> chunks;
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        while (!this->queue_.empty() && chunks.size() < max_chunks)
+        {
+            chunks.push_back(std::move(this->queue_.front()));
+            this->queue_.pop_front();
+        }
+    }
+    if (chunks.empty())
+        return changes;
+
+    this->space_cv_.notify_one();
+    for (LoadedChunk& chunk : chunks)
+        this->data_->setChunk(chunk.index, std::move(chunk.data));
+    return changes + chunks.size();
+}
+
+void MongoSeriesLoader::displayed()
+{
+    if (!this->overview_applied_)
+        return;
+
+    const std::int64_t elapsed_ns = MongoSeriesLoader::nowNs() - this->start_ns_;
+    if (this->first_paint_ns_ < 0)
+        this->first_paint_ns_ = elapsed_ns;
+    if (this->complete_ns_ < 0 && this->data_->isComplete())
+        this->complete_ns_ = elapsed_ns;
+}
+
+bool MongoSeriesLoader::isLoading() const noexcept
+{
+    return this->loading_.load();
+}
+
+std::string MongoSeriesLoader::lastError() const
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    return this->last_error_;
+}
+
+std::int64_t MongoSeriesLoader::firstPaintNs() const noexcept
+{
+    return this->first_paint_ns_;
+}
+
+std::int64_t MongoSeriesLoader::completeNs() const noexcept
+{
+    return this->complete_ns_;
+}
+
+std::uint64_t MongoSeriesLoader::loadedBytes() const noexcept
+{
+    return this->loaded_bytes_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t MongoSeriesLoader::reprioritized() const noexcept
+{
+    return this->reprioritized_.load(std::memory_order_relaxed);
+}
+
+std::size_t MongoSeriesLoader::store(mongocxx::collection& collection, const std::string& series,
+                                     const std::vector<double>& x, const std::vector<double>& y,
+                                     std::size_t chunk_samples)
+{
+    using bsoncxx::builder::basic::kvp;
+    using bsoncxx::builder::basic::make_document;
+
+    const std::size_t count = std::min(x.size(), y.size());
+    chunk_samples = std::max<std::size_t>(chunk_samples, 1);
+
+    collection.delete_many(make_document(kvp("series", series)));
+    collection.create_index(make_document(kvp("series", 1), kvp("seq", 1)));
+
+    std::vector<bsoncxx::document::value> batch;
+    std::vector<double> preview_x;
+    std::vector<double> preview_y;
+    std::size_t chunks = 0;
+    for (std::size_t begin = 0; begin < count; begin += chunk_samples, ++chunks)
+    {
+        const std::size_t end = std::min(begin + chunk_samples, count);
+
+        // Preview: min and max of each bucket, in x order. Their extremes are the ones of the chunk.
+        const std::size_t bucket = (end - begin + kPreviewBuckets - 1) / kPreviewBuckets;
+        double y_min = std::numeric_limits<double>::max();
+        double y_max = std::numeric_limits<double>::lowest();
+        preview_x.clear();
+        preview_y.clear();
+        for (std::size_t b = begin; b < end; b += bucket)
+        {
+            const std::size_t b_end = std::min(b + bucket, end);
+            std::size_t min_idx = b;
+            std::size_t max_idx = b;
+            for (std::size_t i = b + 1; i < b_end; ++i)
+            {
+                if (y[i] < y[min_idx]) min_idx = i;
+                if (y[i] > y[max_idx]) max_idx = i;
+            }
+            const std::size_t lo = std::min(min_idx, max_idx);
+            const std::size_t hi = std::max(min_idx, max_idx);
+            preview_x.push_back(x[lo]);
+            preview_y.push_back(y[lo]);
+            if (hi != lo)
+            {
+                preview_x.push_back(x[hi]);
+                preview_y.push_back(y[hi]);
+            }
+            y_min = std::min(y_min, y[min_idx]);
+            y_max = std::max(y_max, y[max_idx]);
+        }
+
+        batch.push_back(make_document(
+            kvp("series", series), kvp("seq", static_cast<std::int64_t>(chunks)),
+            kvp("n", static_cast<std::int64_t>(end - begin)), kvp("x_first", x[begin]), kvp("x_last", x[end - 1]),
+            kvp("y_min", y_min), kvp("y_max", y_max),
+            kvp("preview_x", binaryOf(preview_x.data(), preview_x.size())),
+            kvp("preview_y", binaryOf(preview_y.data(), preview_y.size())),
+            kvp("x", binaryOf(x.data() + begin, end - begin)), kvp("y", binaryOf(y.data() + begin, end - begin))));
+        if (batch.size() == kStoreBatch)
+        {
+            collection.insert_many(batch);
+            batch.clear();
+        }
+    }
+    if (!batch.empty())
+        collection.insert_many(batch);
+
+    return chunks;
+}
+
+void MongoSeriesLoader::run()
+{
+    using bsoncxx::builder::basic::kvp;
+    using bsoncxx::builder::basic::make_document;
+
+    try
+    {
+        mongocxx::client client{mongocxx::uri{this->config_.uri}};
+        mongocxx::collection collection = client[this->config_.database][this->config_.collection];
+
+        // Summaries, without the samples (a few KiB per chunk).
+        mongocxx::options::find summary_options;
+        summary_options.projection(make_document(kvp("x", 0), kvp("y", 0)));
+        summary_options.sort(make_document(kvp("seq", 1)));
+        std::vector<SeriesChunkSummary> overview;
+        for (const bsoncxx::document::view& doc :
+             collection.find(make_document(kvp("series", this->config_.series)), summary_options))
+        {
+            SeriesChunkSummary chunk;
+            chunk.seq = static_cast<std::int64_t>(readNumber(doc["seq"]));
+            chunk.count = static_cast<std::size_t>(readNumber(doc["n"]));
+            chunk.x_first = readNumber(doc["x_first"]);
+            chunk.x_last = readNumber(doc["x_last"]);
+            chunk.y_min = readNumber(doc["y_min"]);
+            chunk.y_max = readNumber(doc["y_max"]);
+            if (!readDoubles(doc["preview_x"], chunk.preview_x) || !readDoubles(doc["preview_y"], chunk.preview_y)
+                || chunk.preview_x.size() != chunk.preview_y.size())
+                throw std::runtime_error("Malformed summary of chunk " + std::to_string(chunk.seq));
+            overview.push_back(std::move(chunk));
+            if (this->stop_req_.load())
+                break;
+        }
+        if (overview.empty() && !this->stop_req_.load())
+            throw std::runtime_error("No chunks of the series " + this->config_.series);
+
+        std::vector<std::int64_t> seqs;
+        seqs.reserve(overview.size());
+        for (const SeriesChunkSummary& chunk : overview)
+            seqs.push_back(chunk.seq);
+        {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            this->overview_ = overview;
+            this->overview_ready_ = true;
+        }
+        this->notify();
+
+        // Samples, without the previews, a few chunks per find.
+        mongocxx::options::find chunk_options;
+        chunk_options.projection(make_document(kvp("preview_x", 0), kvp("preview_y", 0)));
+        std::vector<bool> loaded(overview.size(), false);
+        std::size_t remaining = overview.size();
+        while (remaining > 0 && !this->stop_req_.load())
+        {
+            double x_min = 0.0;
+            double x_max = 0.0;
+            bool has_view = false;
+            std::uint64_t generation = 0;
+            {
+                std::lock_guard<std::mutex> lock(this->mutex_);
+                x_min = this->view_min_;
+                x_max = this->view_max_;
+                has_view = this->has_view_;
+                generation = this->view_generation_.load();
+            }
+
+            const std::vector<std::size_t> wanted = this->nextBatch(overview, loaded, x_min, x_max, has_view);
+            bsoncxx::builder::basic::array wanted_seqs;
+            for (const std::size_t index : wanted)
+                wanted_seqs.append(seqs[index]);
+
+            std::size_t received = 0;
+            bool abandoned = false;
+            for (const bsoncxx::document::view& doc : collection.find(
+                     make_document(kvp("series", this->config_.series),
+                                   kvp("seq", make_document(kvp("$in", wanted_seqs.extract())))), chunk_options))
+            {
+                const auto seq = static_cast<std::int64_t>(readNumber(doc["seq"]));
+                const auto it = std::lower_bound(seqs.begin(), seqs.end(), seq);
+                if (it == seqs.end() || *it != seq || loaded[static_cast<std::size_t>(it - seqs.begin())])
+                    continue;
+                const std::size_t index = static_cast<std::size_t>(it - seqs.begin());
+
+                // Decoded and decimated here, the GUI thread only takes the pointer.
+                std::vector<double> x;
+                std::vector<double> y;
+                if (!readDoubles(doc["x"], x) || !readDoubles(doc["y"], y) || x.size() != y.size())
+                    throw std::runtime_error("Malformed samples of chunk " + std::to_string(seq));
+                this->loaded_bytes_.fetch_add(2 * sizeof(double) * x.size(), std::memory_order_relaxed);
+                auto data = std::make_unique<LodSeriesData>();
+                data->setSamples(std::move(x), std::move(y));
+
+                loaded[index] = true;
+                --remaining;
+                ++received;
+                if (!this->push({index, std::move(data)}))
+                    break;
+
+                // The view moved: the rest of this find may be far from it.
+                if (this->view_generation_.load() != generation)
+                {
+                    this->reprioritized_.fetch_add(1, std::memory_order_relaxed);
+                    abandoned = true;
+                    break;
+                }
+            }
+
+            if (!abandoned && !this->stop_req_.load() && received < wanted.size())
+                throw std::runtime_error("Chunks of the series " + this->config_.series + " removed while loading");
+        }
+    }
+    catch (const std::exception& e)
+    {
+        this->fail(e.what());
+    }
+
+    this->loading_.store(false);
+    this->notify();
+}
+
+std::vector<std::size_t> MongoSeriesLoader::nextBatch(const std::vector<SeriesChunkSummary>& overview,
+                                                      const std::vector<bool>& loaded, double x_min, double x_max,
+                                                      bool has_view) const
+{
+    // Distance from each unloaded chunk to the view (0 if visible), ties in x order.
+    std::vector<std::pair<double, std::size_t>> order;
+    for (std::size_t i = 0; i < overview.size(); ++i)
+    {
+        if (loaded[i])
+            continue;
+        const double distance = has_view ? std::max({0.0, overview[i].x_first - x_max, x_min - overview[i].x_last})
+                                         : 0.0;
+        order.emplace_back(distance, i);
+    }
+
+    const std::size_t count = std::min(order.size(), this->config_.chunks_per_query);
+    std::partial_sort(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(count), order.end());
+
+    std::vector<std::size_t> batch(count);
+    for (std::size_t i = 0; i < count; ++i)
+        batch[i] = order[i].second;
+    return batch;
+}
+
+bool MongoSeriesLoader::push(LoadedChunk chunk)
+{
+    bool notify = false;
+    {
+        std::unique_lock<std::mutex> lock(this->mutex_);
+
+        // Backpressure: wait for the GUI, the rest of the series waits in the server.
+        this->space_cv_.wait(lock, [this]()
+        {
+            return this->stop_req_.load() || this->queue_.size() < this->config_.max_queued_chunks;
+        });
+        if (this->stop_req_.load())
+            return false;
+
+        notify = this->queue_.empty();
+        this->queue_.push_back(std::move(chunk));
+    }
+
+    if (notify)
+        this->notify();
+    return true;
+}
+
+void MongoSeriesLoader::notify()
+{
+    if (this->notifier_)
+        this->notifier_();
+}
+
+void MongoSeriesLoader::fail(const std::string& error)
+{
+    std::cerr << "[MongoSeriesLoader] " << this->config_.database << "." << this->config_.collection << "/"
+              << this->config_.series << ": " << error << std::endl;
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    this->last_error_ = error;
+}
+
+std::int64_t MongoSeriesLoader::nowNs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// =====================================================================================================================
@@ -0,0 +1,208 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldQwt – Progressive loader of a large series stored in chunks in MongoDB
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// MONGOCXX INCLUDES
+#include <mongocxx/collection.hpp>
+
+// PROJECT INCLUDES
+#include "lod_series_data.h"
+#include "progressive_series_data.h"
+
+/**
+ * @brief Configuration of a MongoSeriesLoader.
+ */
+struct SeriesLoaderConfig
+{
+    std::string uri = "mongodb://localhost:27017";   ///< Server URI.
+    std::string database;                            ///< Database name.
+    std::string collection;                          ///< Collection of the chunks.
+    std::string series;                              ///< Value of the "series" field of the chunks.
+    std::size_t chunks_per_query = 8;                ///< Chunks per find, the granularity of a view change.
+    std::size_t max_queued_chunks = 16;              ///< The reader waits while this many chunks are queued.
+};
+
+/**
+ * @brief Loads a series stored in chunk documents into a ProgressiveSeriesData, in its own thread.
+ *
+ * Chunk documents (written by store()), one per kChunkSamples samples:
+ *   {series, seq, n, x_first, x_last, y_min, y_max, preview_x, preview_y, x, y}
+ * The arrays are binary (BinData, doubles in host byte order) so decoding is a copy. The previews hold the min and
+ * max of kPreviewBuckets buckets of the chunk.
+ *
+ * The reader first reads the summaries (every field but x and y, sorted by seq): the curve is drawn from them at
+ * once. Then it reads the chunks with finds of `chunks_per_query` seqs, the visible ones first and then the nearest
+ * to the view, decodes them and builds their min/max pyramids, so the GUI thread only swaps pointers. When the view
+ * changes (setViewRange()) the current find is abandoned after the chunk being read and the order is recomputed.
+ * At most `max_queued_chunks` decoded chunks wait for the GUI (backpressure).
+ *
+ * update() and displayed() run in the GUI thread once per frame, as ChangeStreamSeries. A mongocxx::instance must be
+ * alive while it runs.
+ */
+class MongoSeriesLoader
+{
+public:
+
+    // Constant expresions.
+    static constexpr std::size_t kChunkSamples = 65'536;   ///< Samples per chunk written by store() (1 MiB of x, y).
+    static constexpr std::size_t kPreviewBuckets = 64;     ///< Min/max buckets of the preview of each chunk.
+
+    /**
+     * @param config Series to load.
+     * @param data Series of the curve, owned by the curve.
+     */
+    MongoSeriesLoader(const SeriesLoaderConfig& config, ProgressiveSeriesData* data);
+
+    MongoSeriesLoader(const MongoSeriesLoader&) = delete;
+    MongoSeriesLoader& operator=(const MongoSeriesLoader&) = delete;
+
+    /**
+     * @brief Cancel the load (see cancel()).
+     */
+    ~MongoSeriesLoader();
+
+    /**
+     * @brief Function called from the reader thread when the summaries or a chunk are ready and nothing was queued.
+     *
+     * Meant to wake up the GUI (e.g. a queued invokeMethod). Set it before start().
+     */
+    void setNotifier(std::function<void()> notifier);
+
+    /**
+     * @brief Start the reader thread. The times of firstPaintNs() and completeNs() start here.
+     */
+    void start();
+
+    /**
+     * @brief Stop the reader (after the chunk being read) and drop the queued chunks. The loaded ones stay.
+     */
+    void cancel();
+
+    /**
+     * @brief Visible x range: its chunks are read next, the current find is abandoned.
+     */
+    void setViewRange(double x_min, double x_max);
+
+    /**
+     * @brief Apply the summaries when ready and up to `max_chunks` loaded chunks. Returns the changes applied.
+     */
+    std::size_t update(std::size_t max_chunks);
+
+    /**
+     * @brief Record the first paint and the complete times (call it after the replot).
+     */
+    void displayed();
+
+    /**
+     * @brief True until the reader ends (all loaded, cancelled or failed).
+     */
+    bool isLoading() const noexcept;
+
+    std::string lastError() const;
+
+    /**
+     * @brief Time from start() to the first display of the overview (and of all the chunks), -1 until then.
+     */
+    std::int64_t firstPaintNs() const noexcept;
+
+    std::int64_t completeNs() const noexcept;
+
+    /**
+     * @brief Bytes of x and y read, and finds abandoned because the view changed.
+     */
+    std::uint64_t loadedBytes() const noexcept;
+
+    std::uint64_t reprioritized() const noexcept;
+
+    /**
+     * @brief Write a series as chunk documents (replacing its previous chunks) and index {series, seq}.
+     *
+     * The x values must be non-decreasing. Throws the driver exceptions. Returns the number of chunks.
+     */
+    static std::size_t store(mongocxx::collection& collection, const std::string& series, const std::vector<double>& x,
+                             const std::vector<double>& y, std::size_t chunk_samples = kChunkSamples);
+
+private:
+
+    struct LoadedChunk
+    {
+        std::size_t index;                      // Position in the overview.
+        std::unique_ptr<LodSeriesData> data;
+    };
+
+    void run();
+
+    /**
+     * @brief Next chunks to read: unloaded, visible first, then by distance to the view.
+     */
+    std::vector<std::size_t> nextBatch(const std::vector<SeriesChunkSummary>& overview,
+                                       const std::vector<bool>& loaded, double x_min, double x_max,
+                                       bool has_view) const;
+
+    /**
+     * @brief Queue a chunk (waits while the queue is full). False if cancelled.
+     */
+    bool push(LoadedChunk chunk);
+
+    void notify();
+
+    void fail(const std::string& error);
+
+    static std::int64_t nowNs() noexcept;
+
+    SeriesLoaderConfig config_;
+    ProgressiveSeriesData* data_;
+    std::function<void()> notifier_;
+
+    // Reader -> GUI.
+    mutable std::mutex mutex_;
+    std::condition_variable space_cv_;
+    std::vector<SeriesChunkSummary> overview_;
+    bool overview_ready_;
+    std::deque<LoadedChunk> queue_;
+    std::string last_error_;
+
+    // GUI -> reader.
+    double view_min_;
+    double view_max_;
+    bool has_view_;
+    std::atomic<std::uint64_t> view_generation_;
+
+    // GUI thread state.
+    bool overview_applied_;
+    std::int64_t start_ns_;
+    std::int64_t first_paint_ns_;
+    std::int64_t complete_ns_;
+
+    std::atomic_bool stop_req_;
+    std::atomic_bool loading_;
+    std::atomic<std::uint64_t> loaded_bytes_;
+    std::atomic<std::uint64_t> reprioritized_;
+    std::thread worker_;
+};
+
+// =====================================================================================================================
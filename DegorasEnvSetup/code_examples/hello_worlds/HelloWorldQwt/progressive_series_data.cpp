@@ -0,0 +1,203 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// QWT INCLUDES
+#include <qwt/qwt_scale_map.h>
+
+// PROJECT INCLUDES
+#include "progressive_series_data.h"
+
+// =====================================================================================================================
+// ProgressiveSeriesData
+// =====================================================================================================================
+
+ProgressiveSeriesData::ProgressiveSeriesData() :
+    loaded_chunks_(0),
+    total_samples_(0),
+    loaded_samples_(0),
+    bounds_(1.0, 1.0, -2.0, -2.0)
+{}
+
+void ProgressiveSeriesData::setOverview(std::vector<SeriesChunkSummary> chunks)
+{
+    this->summaries_ = std::move(chunks);
+    this->chunks_.clear();
+    this->chunks_.resize(this->summaries_.size());
+    this->loaded_chunks_ = 0;
+    this->loaded_samples_ = 0;
+    this->total_samples_ = 0;
+    this->view_.clear();
+
+    if (this->summaries_.empty())
+    {
+        this->bounds_ = QRectF(1.0, 1.0, -2.0, -2.0);
+        return;
+    }
+
+    // The summaries give the final bounds, autoscaling does not move while the chunks arrive.
+    double y_min = std::numeric_limits<double>::max();
+    double y_max = std::numeric_limits<double>::lowest();
+    for (const SeriesChunkSummary& chunk : this->summaries_)
+    {
+        y_min = std::min(y_min, chunk.y_min);
+        y_max = std::max(y_max, chunk.y_max);
+        this->total_samples_ += chunk.count;
+    }
+    const double x_first = this->summaries_.front().x_first;
+    this->bounds_ = QRectF(x_first, y_min, this->summaries_.back().x_last - x_first, y_max - y_min);
+}
+
+void ProgressiveSeriesData::setChunk(std::size_t index, std::unique_ptr<LodSeriesData> data)
+{
+    if (!data || index >= this->chunks_.size())
+        return;
+
+    if (this->chunks_[index])
+        this->loaded_samples_ -= this->chunks_[index]->rawSize();
+    else
+        ++this->loaded_chunks_;
+    this->loaded_samples_ += data->rawSize();
+    this->chunks_[index] = std::move(data);
+}
+
+void ProgressiveSeriesData::select(double x_min, double x_max, double pixels) const
+{
+    this->view_.clear();
+    if (this->summaries_.empty())
+        return;
+    if (x_min > x_max)
+        std::swap(x_min, x_max);
+
+    // Visible chunks, plus one on each side so the line reaches the canvas edges.
+    const auto begin = this->summaries_.begin();
+    std::size_t first = static_cast<std::size_t>(
+        std::lower_bound(begin, this->summaries_.end(), x_min, [](const SeriesChunkSummary& chunk, double x)
+        {
+            return chunk.x_last < x;
+        }) - begin);
+    std::size_t last = static_cast<std::size_t>(
+        std::upper_bound(begin, this->summaries_.end(), x_max, [](double x, const SeriesChunkSummary& chunk)
+        {
+            return x < chunk.x_first;
+        }) - begin);
+    first = first > 0 ? first - 1 : 0;
+    last = std::min(last + 1, this->summaries_.size());
+
+    // Loaded chunks get the pixels of their visible width, the others show their preview.
+    const double width = std::max(x_max - x_min, std::numeric_limits<double>::min());
+    for (std::size_t c = first; c < last; ++c)
+    {
+        const SeriesChunkSummary& summary = this->summaries_[c];
+        const LodSeriesData* chunk = this->chunks_[c].get();
+        if (!chunk)
+        {
+            for (std::size_t i = 0; i < summary.preview_x.size(); ++i)
+                this->view_.emplace_back(summary.preview_x[i], summary.preview_y[i]);
+            continue;
+        }
+
+        const double visible = std::min(summary.x_last, x_max) - std::max(summary.x_first, x_min);
+        chunk->select(x_min, x_max, std::max(1.0, pixels * std::max(visible, 0.0) / width));
+        const std::size_t count = chunk->size();
+        for (std::size_t i = 0; i < count; ++i)
+            this->view_.push_back(chunk->sample(i));
+    }
+}
+
+const std::vector<SeriesChunkSummary>& ProgressiveSeriesData::overview() const noexcept
+{
+    return this->summaries_;
+}
+
+std::size_t ProgressiveSeriesData::chunkCount() const noexcept
+{
+    return this->summaries_.size();
+}
+
+std::size_t ProgressiveSeriesData::loadedChunks() const noexcept
+{
+    return this->loaded_chunks_;
+}
+
+std::size_t ProgressiveSeriesData::totalSamples() const noexcept
+{
+    return this->total_samples_;
+}
+
+std::size_t ProgressiveSeriesData::loadedSamples() const noexcept
+{
+    return this->loaded_samples_;
+}
+
+bool ProgressiveSeriesData::isComplete() const noexcept
+{
+    return !this->summaries_.empty() && this->loaded_chunks_ == this->summaries_.size();
+}
+
+bool ProgressiveSeriesData::isRangeLoaded(double x_min, double x_max) const
+{
+    if (x_min > x_max)
+        std::swap(x_min, x_max);
+
+    for (std::size_t c = 0; c < this->summaries_.size(); ++c)
+        if (!this->chunks_[c] && this->summaries_[c].x_last >= x_min && this->summaries_[c].x_first <= x_max)
+            return false;
+    return !this->summaries_.empty();
+}
+
+size_t ProgressiveSeriesData::size() const
+{
+    return this->view_.size();
+}
+
+QPointF ProgressiveSeriesData::sample(size_t i) const
+{
+    return this->view_[i];
+}
+
+QRectF ProgressiveSeriesData::boundingRect() const
+{
+    return this->bounds_;
+}
+
+// =====================================================================================================================
+// ProgressivePlotCurve
+// =====================================================================================================================
+
+ProgressivePlotCurve::ProgressivePlotCurve(const QString& title) :
+    QwtPlotCurve(title),
+    data_(nullptr)
+{}
+
+void ProgressivePlotCurve::setProgressiveData(ProgressiveSeriesData* data)
+{
+    this->data_ = data;
+    this->setData(data);
+}
+
+void ProgressivePlotCurve::drawSeries(QPainter* painter, const QwtScaleMap& x_map, const QwtScaleMap& y_map,
+                                      const QRectF& canvas_rect, int from, int to) const
+{
+    // The indices given by Qwt refer to the previous view, draw the whole refreshed one.
+    if (this->data_)
+    {
+        this->data_->select(x_map.s1(), x_map.s2(), std::abs(x_map.pDist()));
+        from = 0;
+        to = -1;
+    }
+    QwtPlotCurve::drawSeries(painter, x_map, y_map, canvas_rect, from, to);
+}
+
+// =====================================================================================================================
@@ -0,0 +1,142 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldQwt – Chunked series shown as a coarse overview and refined chunk by chunk while it loads
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// QT INCLUDES
+#include <QPointF>
+#include <QRectF>
+
+// QWT INCLUDES
+#include <qwt/qwt_series_data.h>
+#include <qwt/qwt_plot_curve.h>
+
+// PROJECT INCLUDES
+#include "lod_series_data.h"
+
+/**
+ * @brief Summary of one chunk of a stored series, known before its samples are loaded.
+ */
+struct SeriesChunkSummary
+{
+    std::int64_t seq = 0;             ///< Position of the chunk in the series.
+    std::size_t count = 0;            ///< Samples of the chunk.
+    double x_first = 0.0;
+    double x_last = 0.0;
+    double y_min = 0.0;
+    double y_max = 0.0;
+    std::vector<double> preview_x;    ///< Min and max of a few buckets of the chunk, in x order.
+    std::vector<double> preview_y;
+};
+
+/**
+ * @brief QwtSeriesData of an x-sorted series split in chunks that arrive one by one, in any order.
+ *
+ * setOverview() gives the summaries of all the chunks: the curve is drawn at once from their previews (a few min/max
+ * points per chunk, so no peak is lost) and the bounding rect is final. Each setChunk() replaces the preview of a
+ * chunk by its full samples, decimated by their own min/max pyramid (LodSeriesData).
+ *
+ * select() shares the pixels among the visible chunks by their visible x width, so a fully loaded view renders
+ * O(pixels) samples as LodSeriesData does. The view is refreshed by ProgressivePlotCurve on every draw.
+ */
+class ProgressiveSeriesData final : public QwtSeriesData<QPointF>
+{
+public:
+
+    ProgressiveSeriesData();
+
+    /**
+     * @brief Replace the chunks (none loaded). They must be sorted by x and must not overlap.
+     */
+    void setOverview(std::vector<SeriesChunkSummary> chunks);
+
+    /**
+     * @brief Full samples of the chunk at `index` (position in the overview). A null or out of range one is ignored.
+     */
+    void setChunk(std::size_t index, std::unique_ptr<LodSeriesData> data);
+
+    /**
+     * @brief Refresh the view for the visible x range and its width in pixels.
+     */
+    void select(double x_min, double x_max, double pixels) const;
+
+    const std::vector<SeriesChunkSummary>& overview() const noexcept;
+
+    std::size_t chunkCount() const noexcept;
+
+    std::size_t loadedChunks() const noexcept;
+
+    /**
+     * @brief Samples of the series (all the chunks) and of the loaded chunks.
+     */
+    std::size_t totalSamples() const noexcept;
+
+    std::size_t loadedSamples() const noexcept;
+
+    /**
+     * @brief True once every chunk of a non empty overview is loaded.
+     */
+    bool isComplete() const noexcept;
+
+    /**
+     * @brief True if every chunk with samples in [x_min, x_max] is loaded.
+     */
+    bool isRangeLoaded(double x_min, double x_max) const;
+
+    size_t size() const override;
+
+    QPointF sample(size_t i) const override;
+
+    QRectF boundingRect() const override;
+
+private:
+
+    std::vector<SeriesChunkSummary> summaries_;
+    std::vector<std::unique_ptr<LodSeriesData>> chunks_;   // Null until loaded.
+    std::size_t loaded_chunks_;
+    std::size_t total_samples_;
+    std::size_t loaded_samples_;
+    QRectF bounds_;
+    mutable std::vector<QPointF> view_;
+};
+
+/**
+ * @brief QwtPlotCurve that refreshes its ProgressiveSeriesData view for the current scale and canvas width.
+ */
+class ProgressivePlotCurve final : public QwtPlotCurve
+{
+public:
+
+    explicit ProgressivePlotCurve(const QString& title = QString());
+
+    /**
+     * @brief Attach the data (the curve takes the ownership, as with setData()).
+     */
+    void setProgressiveData(ProgressiveSeriesData* data);
+
+    void drawSeries(QPainter* painter, const QwtScaleMap& x_map, const QwtScaleMap& y_map,
+                    const QRectF& canvas_rect, int from, int to) const override;
+
+private:
+
+    ProgressiveSeriesData* data_;
+};
+
+// =====================================================================================================================
@@ -0,0 +1,194 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <limits>
+
+// PROJECT INCLUDES
+#include "ring_series_data.h"
+
+// =====================================================================================================================
+
+RingSeriesData::RingSeriesData(std::size_t capacity) :
+    buffer_(capacity > 0 ? capacity : 1),
+    head_(0),
+    size_(0),
+    next_seq_(0),
+    x_monotonic_(true),
+    last_x_(0.0),
+    min_x_(0.0),
+    max_x_(0.0),
+    x_dirty_(false)
+{
+    this->min_y_.seqs.resize(this->buffer_.size());
+    this->max_y_.seqs.resize(this->buffer_.size());
+    this->resetBounds();
+}
+
+std::size_t RingSeriesData::capacity() const noexcept
+{
+    return this->buffer_.size();
+}
+
+void RingSeriesData::clear() noexcept
+{
+    this->head_ = 0;
+    this->size_ = 0;
+    this->resetBounds();
+}
+
+void RingSeriesData::append(const QPointF& point) noexcept
+{
+    const std::size_t capacity = this->buffer_.size();
+
+    if (this->size_ < capacity)
+    {
+        std::size_t tail = this->head_ + this->size_;
+        if (tail >= capacity)
+            tail -= capacity;
+        this->buffer_[tail] = point;
+        ++this->size_;
+    }
+    else
+    {
+        // Full: the new sample takes the place of the oldest one, which leaves the y queues first.
+        const QPointF& oldest = this->buffer_[this->head_];
+        if (!this->x_monotonic_ && !this->x_dirty_ && (oldest.x() <= this->min_x_ || oldest.x() >= this->max_x_))
+            this->x_dirty_ = true;
+        this->expire(this->min_y_, this->next_seq_ - capacity + 1);
+        this->expire(this->max_y_, this->next_seq_ - capacity + 1);
+        this->buffer_[this->head_] = point;
+        if (++this->head_ == capacity)
+            this->head_ = 0;
+    }
+
+    this->track(point);
+}
+
+void RingSeriesData::append(const QPointF* points, std::size_t count) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i)
+        this->append(points[i]);
+}
+
+size_t RingSeriesData::size() const
+{
+    return this->size_;
+}
+
+QPointF RingSeriesData::sample(size_t i) const
+{
+    std::size_t idx = this->head_ + i;
+    if (idx >= this->buffer_.size())
+        idx -= this->buffer_.size();
+    return this->buffer_[idx];
+}
+
+QRectF RingSeriesData::boundingRect() const
+{
+    if (this->size_ == 0)
+        return QRectF(1.0, 1.0, -2.0, -2.0);
+
+    double min_x = this->sample(0).x();
+    double max_x = this->sample(this->size_ - 1).x();
+    if (!this->x_monotonic_)
+    {
+        // Only needed after an edge sample was scrolled out.
+        if (this->x_dirty_)
+        {
+            this->min_x_ = std::numeric_limits<double>::max();
+            this->max_x_ = std::numeric_limits<double>::lowest();
+            for (std::size_t i = 0; i < this->size_; ++i)
+                this->extendX(this->sample(i).x());
+            this->x_dirty_ = false;
+        }
+        min_x = this->min_x_;
+        max_x = this->max_x_;
+    }
+
+    const double min_y = this->extremumY(this->min_y_);
+    const double max_y = this->extremumY(this->max_y_);
+    return QRectF(min_x, min_y, max_x - min_x, max_y - min_y);
+}
+
+void RingSeriesData::resetBounds() noexcept
+{
+    this->next_seq_ = 0;
+    this->min_y_.front = 0;
+    this->min_y_.count = 0;
+    this->max_y_.front = 0;
+    this->max_y_.count = 0;
+    this->x_monotonic_ = true;
+    this->min_x_ = std::numeric_limits<double>::max();
+    this->max_x_ = std::numeric_limits<double>::lowest();
+    this->x_dirty_ = false;
+}
+
+void RingSeriesData::track(const QPointF& point) noexcept
+{
+    if (this->x_monotonic_ && this->next_seq_ > 0 && point.x() < this->last_x_)
+    {
+        // From now on the x range is maintained as the y one was before: extended, rescanned when dirty.
+        this->x_monotonic_ = false;
+        this->x_dirty_ = true;
+    }
+    if (!this->x_monotonic_ && !this->x_dirty_)
+        this->extendX(point.x());
+    this->last_x_ = point.x();
+
+    this->push(this->min_y_, true, point.y());
+    this->push(this->max_y_, false, point.y());
+    ++this->next_seq_;
+}
+
+void RingSeriesData::push(Extremum& extremum, bool minimum, double y) noexcept
+{
+    // Drop the queued samples the new one dominates: they leave the window before it.
+    const std::size_t capacity = extremum.seqs.size();
+    while (extremum.count > 0)
+    {
+        std::size_t back = extremum.front + extremum.count - 1;
+        if (back >= capacity)
+            back -= capacity;
+        const double queued = this->buffer_[extremum.seqs[back] % capacity].y();
+        if (minimum ? queued < y : queued > y)
+            break;
+        --extremum.count;
+    }
+
+    std::size_t tail = extremum.front + extremum.count;
+    if (tail >= capacity)
+        tail -= capacity;
+    extremum.seqs[tail] = this->next_seq_;
+    ++extremum.count;
+}
+
+void RingSeriesData::expire(Extremum& extremum, std::uint64_t first_seq) noexcept
+{
+    while (extremum.count > 0 && extremum.seqs[extremum.front] < first_seq)
+    {
+        if (++extremum.front == extremum.seqs.size())
+            extremum.front = 0;
+        --extremum.count;
+    }
+}
+
+double RingSeriesData::extremumY(const Extremum& extremum) const noexcept
+{
+    return this->buffer_[extremum.seqs[extremum.front] % this->buffer_.size()].y();
+}
+
+void RingSeriesData::extendX(double x) const noexcept
+{
+    if (x < this->min_x_) this->min_x_ = x;
+    if (x > this->max_x_) this->max_x_ = x;
+}
+
+// =====================================================================================================================
@@ -0,0 +1,138 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldQwt – Preallocated circular series data for live curves
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// QT INCLUDES
+#include <QPointF>
+#include <QRectF>
+
+// QWT INCLUDES
+#include <qwt/qwt_series_data.h>
+
+/**
+ * @brief QwtSeriesData backed by a fixed-capacity circular buffer.
+ *
+ * All the storage is allocated once in the constructor. The samples are rewritten in place (assign) or scrolled in
+ * (append, overwriting the oldest ones when full), so a live curve never allocates per frame and the curve does not
+ * copy the data. The bounding rect is maintained while writing in O(1) amortized per sample, also once the window
+ * scrolls: the y range comes from two monotonic queues of the samples that can still become the window minimum or
+ * maximum, and while x does not decrease (time series) the x range is the first and last sample. Only a series with
+ * decreasing x falls back to a rescan of x when a scrolled-out sample was one of its edges.
+ *
+ * Attach it with QwtPlotCurve::setData(), which takes the ownership, and keep a raw pointer to feed it.
+ */
+class RingSeriesData final : public QwtSeriesData<QPointF>
+{
+public:
+
+    /**
+     * @param capacity Maximum number of samples.
+     */
+    explicit RingSeriesData(std::size_t capacity);
+
+    /**
+     * @brief Maximum number of samples.
+     */
+    std::size_t capacity() const noexcept;
+
+    /**
+     * @brief Remove all the samples (the storage is kept).
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Append a sample, overwriting the oldest one if the buffer is full.
+     */
+    void append(const QPointF& point) noexcept;
+
+    /**
+     * @brief Append a block of samples, overwriting the oldest ones if the buffer is full.
+     */
+    void append(const QPointF* points, std::size_t count) noexcept;
+
+    /**
+     * @brief Rewrite the whole series in place with `count` samples produced by `generator(i)`.
+     *
+     * The bounding rect is computed in the same pass. `count` is clamped to the capacity.
+     */
+    template <typename Generator>
+    void assign(std::size_t count, Generator&& generator)
+    {
+        count = count < this->buffer_.size() ? count : this->buffer_.size();
+        this->head_ = 0;
+        this->size_ = count;
+        this->resetBounds();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const QPointF point = generator(i);
+            this->buffer_[i] = point;
+            this->track(point);
+        }
+    }
+
+    size_t size() const override;
+
+    QPointF sample(size_t i) const override;
+
+    QRectF boundingRect() const override;
+
+private:
+
+    /**
+     * @brief Sequence numbers of the window samples that can still become its minimum (or maximum) y, oldest first.
+     *
+     * Preallocated ring of the buffer capacity. The sample of sequence number s is at buffer_[s % capacity].
+     */
+    struct Extremum
+    {
+        std::vector<std::uint64_t> seqs;
+        std::size_t front = 0;
+        std::size_t count = 0;
+    };
+
+    void resetBounds() noexcept;
+
+    /**
+     * @brief Account the sample just written at sequence number next_seq_ (then incremented).
+     */
+    void track(const QPointF& point) noexcept;
+
+    void push(Extremum& extremum, bool minimum, double y) noexcept;
+
+    void expire(Extremum& extremum, std::uint64_t first_seq) noexcept;
+
+    double extremumY(const Extremum& extremum) const noexcept;
+
+    void extendX(double x) const noexcept;
+
+    std::vector<QPointF> buffer_;
+    std::size_t head_;
+    std::size_t size_;
+    std::uint64_t next_seq_;
+    Extremum min_y_;
+    Extremum max_y_;
+    bool x_monotonic_;               // No decreasing x since the last clear() or assign().
+    double last_x_;
+    mutable double min_x_;           // Only used when x is not monotonic.
+    mutable double max_x_;
+    mutable bool x_dirty_;
+};
+
+// =====================================================================================================================
@@ -0,0 +1,92 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <chrono>
+#include <cmath>
+
+// PROJECT INCLUDES
+#include "sample_producer.h"
+
+// =====================================================================================================================
+
+SampleProducer::SampleProducer(SpscQueue<QPointF>& queue, double rate_hz, std::size_t block_size) :
+    queue_(queue),
+    rate_hz_(rate_hz > 0.0 ? rate_hz : 1.0),
+    block_(block_size > 0 ? block_size : 1),
+    stop_req_(false),
+    produced_(0),
+    dropped_(0)
+{}
+
+SampleProducer::~SampleProducer()
+{
+    this->stop();
+}
+
+void SampleProducer::start()
+{
+    if (this->worker_.joinable())
+        return;
+    this->stop_req_.store(false);
+    this->worker_ = std::thread(&SampleProducer::run, this);
+}
+
+void SampleProducer::stop()
+{
+    this->stop_req_.store(true);
+    if (this->worker_.joinable())
+        this->worker_.join();
+}
+
+std::uint64_t SampleProducer::produced() const noexcept
+{
+    return this->produced_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t SampleProducer::dropped() const noexcept
+{
+    return this->dropped_.load(std::memory_order_relaxed);
+}
+
+void SampleProducer::run()
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr double kTwoPi = 6.283185307179586;
+    const auto start = Clock::now();
+    const auto block_period = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(this->block_.size() / this->rate_hz_));
+    std::uint64_t index = 0;
+
+    while (!this->stop_req_.load(std::memory_order_relaxed))
+    {
+        // Generate every block due by now.
+        const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        const auto due = static_cast<std::uint64_t>(elapsed * this->rate_hz_);
+        while (index + this->block_.size() <= due)
+        {
+            for (QPointF& sample : this->block_)
+            {
+                const double t = index++ / this->rate_hz_;
+                sample = QPointF(t, 0.8 * std::sin(kTwoPi * 2.0 * t) + 0.1 * std::sin(kTwoPi * 90.0 * t));
+            }
+
+            const std::size_t pushed = this->queue_.push(this->block_.data(), this->block_.size());
+            this->produced_.fetch_add(this->block_.size(), std::memory_order_relaxed);
+            if (pushed < this->block_.size())
+                this->dropped_.fetch_add(this->block_.size() - pushed, std::memory_order_relaxed);
+        }
+
+        std::this_thread::sleep_until(start + block_period * static_cast<Clock::rep>(index / this->block_.size() + 1));
+    }
+}
+
+// =====================================================================================================================
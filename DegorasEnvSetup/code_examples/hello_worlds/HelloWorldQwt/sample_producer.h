@@ -0,0 +1,79 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldQwt – Simulated acquisition thread streaming samples into an SPSC queue
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// QT INCLUDES
+#include <QPointF>
+
+// PROJECT INCLUDES
+#include "spsc_queue.h"
+
+/**
+ * @brief Producer thread that generates timestamped samples at a fixed rate and pushes them in blocks.
+ *
+ * The samples due since the start are generated in blocks of `block_size`, so a late wake-up is caught up instead of
+ * lowering the rate. When the queue is full the rest of the block is dropped and counted (the producer never waits
+ * for the GUI). x is the acquisition time in seconds.
+ */
+class SampleProducer
+{
+public:
+
+    /**
+     * @param queue Queue shared with the consumer (must outlive the producer).
+     * @param rate_hz Samples per second.
+     * @param block_size Samples per push.
+     */
+    SampleProducer(SpscQueue<QPointF>& queue, double rate_hz, std::size_t block_size = 100);
+
+    SampleProducer(const SampleProducer&) = delete;
+    SampleProducer& operator=(const SampleProducer&) = delete;
+
+    ~SampleProducer();
+
+    void start();
+
+    void stop();
+
+    /**
+     * @brief Samples generated so far.
+     */
+    std::uint64_t produced() const noexcept;
+
+    /**
+     * @brief Samples discarded because the queue was full.
+     */
+    std::uint64_t dropped() const noexcept;
+
+private:
+
+    void run();
+
+    SpscQueue<QPointF>& queue_;
+    double rate_hz_;
+    std::vector<QPointF> block_;
+    std::atomic_bool stop_req_;
+    std::atomic<std::uint64_t> produced_;
+    std::atomic<std::uint64_t> dropped_;
+    std::thread worker_;
+};
+
+// =====================================================================================================================
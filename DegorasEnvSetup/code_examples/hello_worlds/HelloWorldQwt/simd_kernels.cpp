@@ -0,0 +1,543 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+// PROJECT INCLUDES
+#include "simd_kernels.h"
+
+// The vector paths are only built for x86 with GCC-compatible compilers (per-function target selection).
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    #define DP_SIMD_X86 1
+    #include <immintrin.h>
+#else
+    #define DP_SIMD_X86 0
+#endif
+
+namespace
+{
+
+// Three-part pi, 27 + 27 + 53 bits: k * kPiA and k * kPiB are exact for |k| < 2^26.
+constexpr double kPiA = 0x1.921fb54p+1;
+constexpr double kPiB = 0x1.10b461p-29;
+constexpr double kPiC = 0x1.a62633145c06ep-57;
+constexpr double kInvPi = 0.318309886183790671538;
+
+// Adding and subtracting 1.5 * 2^52 rounds to the nearest integer, which is left in the low mantissa bits.
+constexpr double kRoundMagic = 0x1.8p52;
+
+// Taylor coefficients of sin(r), odd terms 3 to 19 (truncation error below 3e-16 on [-pi/2, pi/2]).
+constexpr double kS3 = -1.0 / 6.0;
+constexpr double kS5 = 1.0 / 120.0;
+constexpr double kS7 = -1.0 / 5040.0;
+constexpr double kS9 = 1.0 / 362880.0;
+constexpr double kS11 = -1.0 / 39916800.0;
+constexpr double kS13 = 1.0 / 6227020800.0;
+constexpr double kS15 = -1.0 / 1307674368000.0;
+constexpr double kS17 = 1.0 / 355687428096000.0;
+constexpr double kS19 = -1.0 / 121645100408832000.0;
+
+// =====================================================================================================================
+// Scalar kernels (reference algorithm, also used for the tails of the vector loops)
+// =====================================================================================================================
+
+/**
+ * @brief sin(x) for x already reduced to [-pi/2, pi/2].
+ */
+inline double sinReduced(double r) noexcept
+{
+    const double r2 = r * r;
+    double p = kS19;
+    p = p * r2 + kS17;
+    p = p * r2 + kS15;
+    p = p * r2 + kS13;
+    p = p * r2 + kS11;
+    p = p * r2 + kS9;
+    p = p * r2 + kS7;
+    p = p * r2 + kS5;
+    p = p * r2 + kS3;
+    return r + r * r2 * p;
+}
+
+/**
+ * @brief Shared sin/cos core: x = r + (k + half) * pi with k integer, returns (-1)^(k + flip) * sin(r).
+ */
+inline double trigScalar(double x, double half, std::uint64_t flip) noexcept
+{
+    const double k = (x * kInvPi - half + kRoundMagic) - kRoundMagic;
+    const double h = k + half;
+    const double r = ((x - h * kPiA) - h * kPiB) - h * kPiC;
+
+    double s = sinReduced(r);
+    std::uint64_t bits;
+    std::memcpy(&bits, &s, sizeof(bits));
+    bits ^= ((static_cast<std::uint64_t>(static_cast<std::int64_t>(k)) + flip) & 1u) << 63;
+    std::memcpy(&s, &bits, sizeof(bits));
+    return s;
+}
+
+void sinScalar(const double* x, double* out, std::size_t n) noexcept
+{
+    // sin(r + k*pi) = (-1)^k sin(r)
+    for (std::size_t i = 0; i < n; ++i)
+        out[i] = trigScalar(x[i], 0.0, 0);
+}
+
+void cosScalar(const double* x, double* out, std::size_t n) noexcept
+{
+    // cos(r + (k + 1/2)*pi) = (-1)^(k+1) sin(r)
+    for (std::size_t i = 0; i < n; ++i)
+        out[i] = trigScalar(x[i], 0.5, 1);
+}
+
+void affineScalar(const double* x, double* out, std::size_t n, double scale, double offset) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i)
+        out[i] = scale * x[i] + offset;
+}
+
+void multiplyScalar(const double* a, const double* b, double* out, std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i)
+        out[i] = a[i] * b[i];
+}
+
+MinMax minMaxScalar(const double* x, std::size_t n) noexcept
+{
+    MinMax result{std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()};
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (x[i] < result.min) result.min = x[i];
+        if (x[i] > result.max) result.max = x[i];
+    }
+    return result;
+}
+
+/**
+ * @brief Kernels of one level.
+ */
+struct KernelTable
+{
+    void (*sin)(const double*, double*, std::size_t) noexcept;
+    void (*cos)(const double*, double*, std::size_t) noexcept;
+    void (*affine)(const double*, double*, std::size_t, double, double) noexcept;
+    void (*multiply)(const double*, const double*, double*, std::size_t) noexcept;
+    MinMax (*min_max)(const double*, std::size_t) noexcept;
+};
+
+constexpr KernelTable kScalarTable{sinScalar, cosScalar, affineScalar, multiplyScalar, minMaxScalar};
+
+#if DP_SIMD_X86
+
+// =====================================================================================================================
+// SSE2 kernels
+// =====================================================================================================================
+
+#pragma GCC push_options
+#pragma GCC target("sse2")
+
+inline __m128d trigSse2(__m128d x, double half, std::uint64_t flip) noexcept
+{
+    const __m128d magic = _mm_set1_pd(kRoundMagic);
+    const __m128d t = _mm_add_pd(_mm_sub_pd(_mm_mul_pd(x, _mm_set1_pd(kInvPi)), _mm_set1_pd(half)), magic);
+    const __m128i k_bits = _mm_castpd_si128(t);
+    const __m128d k = _mm_sub_pd(t, magic);
+    const __m128d h = _mm_add_pd(k, _mm_set1_pd(half));
+
+    __m128d r = _mm_sub_pd(x, _mm_mul_pd(h, _mm_set1_pd(kPiA)));
+    r = _mm_sub_pd(r, _mm_mul_pd(h, _mm_set1_pd(kPiB)));
+    r = _mm_sub_pd(r, _mm_mul_pd(h, _mm_set1_pd(kPiC)));
+
+    const __m128d r2 = _mm_mul_pd(r, r);
+    __m128d p = _mm_set1_pd(kS19);
+    p = _mm_add_pd(_mm_mul_pd(p, r2), _mm_set1_pd(kS17));
+    p = _mm_add_pd(_mm_mul_pd(p, r2), _mm_set1_pd(kS15));
+    p = _mm_add_pd(_mm_mul_pd(p, r2), _mm_set1_pd(kS13));
+    p = _mm_add_pd(_mm_mul_pd(p, r2), _mm_set1_pd(kS11));
+    p = _mm_add_pd(_mm_mul_pd(p, r2), _mm_set1_pd(kS9));
+    p = _mm_add_pd(_mm_mul_pd(p, r2), _mm_set1_pd(kS7));
+    p = _mm_add_pd(_mm_mul_pd(p, r2), _mm_set1_pd(kS5));
+    p = _mm_add_pd(_mm_mul_pd(p, r2), _mm_set1_pd(kS3));
+    const __m128d s = _mm_add_pd(r, _mm_mul_pd(_mm_mul_pd(r, r2), p));
+
+    const __m128i parity = _mm_and_si128(_mm_add_epi64(k_bits, _mm_set1_epi64x(static_cast<long long>(flip))),
+                                         _mm_set1_epi64x(1));
+    return _mm_xor_pd(s, _mm_castsi128_pd(_mm_slli_epi64(parity, 63)));
+}
+
+void sinSse2(const double* x, double* out, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+        _mm_storeu_pd(out + i, trigSse2(_mm_loadu_pd(x + i), 0.0, 0));
+    sinScalar(x + i, out + i, n - i);
+}
+
+void cosSse2(const double* x, double* out, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+        _mm_storeu_pd(out + i, trigSse2(_mm_loadu_pd(x + i), 0.5, 1));
+    cosScalar(x + i, out + i, n - i);
+}
+
+void affineSse2(const double* x, double* out, std::size_t n, double scale, double offset) noexcept
+{
+    const __m128d s = _mm_set1_pd(scale);
+    const __m128d o = _mm_set1_pd(offset);
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+        _mm_storeu_pd(out + i, _mm_add_pd(_mm_mul_pd(s, _mm_loadu_pd(x + i)), o));
+    affineScalar(x + i, out + i, n - i, scale, offset);
+}
+
+void multiplySse2(const double* a, const double* b, double* out, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+        _mm_storeu_pd(out + i, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+    multiplyScalar(a + i, b + i, out + i, n - i);
+}
+
+MinMax minMaxSse2(const double* x, std::size_t n) noexcept
+{
+    // min/max return the second operand when the first one is NaN, so NaNs in x are skipped.
+    __m128d mn = _mm_set1_pd(std::numeric_limits<double>::infinity());
+    __m128d mx = _mm_set1_pd(-std::numeric_limits<double>::infinity());
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+    {
+        const __m128d v = _mm_loadu_pd(x + i);
+        mn = _mm_min_pd(v, mn);
+        mx = _mm_max_pd(v, mx);
+    }
+
+    alignas(16) double lo[2], hi[2];
+    _mm_store_pd(lo, mn);
+    _mm_store_pd(hi, mx);
+    MinMax result = minMaxScalar(x + i, n - i);
+    for (int j = 0; j < 2; ++j)
+    {
+        if (lo[j] < result.min) result.min = lo[j];
+        if (hi[j] > result.max) result.max = hi[j];
+    }
+    return result;
+}
+
+#pragma GCC pop_options
+
+constexpr KernelTable kSse2Table{sinSse2, cosSse2, affineSse2, multiplySse2, minMaxSse2};
+
+// =====================================================================================================================
+// AVX2 + FMA kernels
+// =====================================================================================================================
+
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+
+inline __m256d trigAvx2(__m256d x, double half, std::uint64_t flip) noexcept
+{
+    const __m256d magic = _mm256_set1_pd(kRoundMagic);
+    const __m256d t = _mm256_add_pd(_mm256_fmsub_pd(x, _mm256_set1_pd(kInvPi), _mm256_set1_pd(half)), magic);
+    const __m256i k_bits = _mm256_castpd_si256(t);
+    const __m256d k = _mm256_sub_pd(t, magic);
+    const __m256d h = _mm256_add_pd(k, _mm256_set1_pd(half));
+
+    __m256d r = _mm256_fnmadd_pd(h, _mm256_set1_pd(kPiA), x);
+    r = _mm256_fnmadd_pd(h, _mm256_set1_pd(kPiB), r);
+    r = _mm256_fnmadd_pd(h, _mm256_set1_pd(kPiC), r);
+
+    const __m256d r2 = _mm256_mul_pd(r, r);
+    __m256d p = _mm256_set1_pd(kS19);
+    p = _mm256_fmadd_pd(p, r2, _mm256_set1_pd(kS17));
+    p = _mm256_fmadd_pd(p, r2, _mm256_set1_pd(kS15));
+    p = _mm256_fmadd_pd(p, r2, _mm256_set1_pd(kS13));
+    p = _mm256_fmadd_pd(p, r2, _mm256_set1_pd(kS11));
+    p = _mm256_fmadd_pd(p, r2, _mm256_set1_pd(kS9));
+    p = _mm256_fmadd_pd(p, r2, _mm256_set1_pd(kS7));
+    p = _mm256_fmadd_pd(p, r2, _mm256_set1_pd(kS5));
+    p = _mm256_fmadd_pd(p, r2, _mm256_set1_pd(kS3));
+    const __m256d s = _mm256_fmadd_pd(_mm256_mul_pd(r, r2), p, r);
+
+    const __m256i parity = _mm256_and_si256(
+        _mm256_add_epi64(k_bits, _mm256_set1_epi64x(static_cast<long long>(flip))), _mm256_set1_epi64x(1));
+    return _mm256_xor_pd(s, _mm256_castsi256_pd(_mm256_slli_epi64(parity, 63)));
+}
+
+void sinAvx2(const double* x, double* out, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm256_storeu_pd(out + i, trigAvx2(_mm256_loadu_pd(x + i), 0.0, 0));
+    sinScalar(x + i, out + i, n - i);
+}
+
+void cosAvx2(const double* x, double* out, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm256_storeu_pd(out + i, trigAvx2(_mm256_loadu_pd(x + i), 0.5, 1));
+    cosScalar(x + i, out + i, n - i);
+}
+
+void affineAvx2(const double* x, double* out, std::size_t n, double scale, double offset) noexcept
+{
+    const __m256d s = _mm256_set1_pd(scale);
+    const __m256d o = _mm256_set1_pd(offset);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm256_storeu_pd(out + i, _mm256_fmadd_pd(s, _mm256_loadu_pd(x + i), o));
+    affineScalar(x + i, out + i, n - i, scale, offset);
+}
+
+void multiplyAvx2(const double* a, const double* b, double* out, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+    multiplyScalar(a + i, b + i, out + i, n - i);
+}
+
+MinMax minMaxAvx2(const double* x, std::size_t n) noexcept
+{
+    __m256d mn = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+    __m256d mx = _mm256_set1_pd(-std::numeric_limits<double>::infinity());
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m256d v = _mm256_loadu_pd(x + i);
+        mn = _mm256_min_pd(v, mn);
+        mx = _mm256_max_pd(v, mx);
+    }
+
+    alignas(32) double lo[4], hi[4];
+    _mm256_store_pd(lo, mn);
+    _mm256_store_pd(hi, mx);
+    MinMax result = minMaxScalar(x + i, n - i);
+    for (int j = 0; j < 4; ++j)
+    {
+        if (lo[j] < result.min) result.min = lo[j];
+        if (hi[j] > result.max) result.max = hi[j];
+    }
+    return result;
+}
+
+#pragma GCC pop_options
+
+constexpr KernelTable kAvx2Table{sinAvx2, cosAvx2, affineAvx2, multiplyAvx2, minMaxAvx2};
+
+// =====================================================================================================================
+// AVX-512F kernels
+// =====================================================================================================================
+
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#pragma GCC diagnostic push
+// GCC 12 avx512fintrin.h self-initializes its undefined vectors when the ISA is enabled per function.
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+inline __m512d trigAvx512(__m512d x, double half, std::uint64_t flip) noexcept
+{
+    const __m512d magic = _mm512_set1_pd(kRoundMagic);
+    const __m512d t = _mm512_add_pd(_mm512_fmsub_pd(x, _mm512_set1_pd(kInvPi), _mm512_set1_pd(half)), magic);
+    const __m512i k_bits = _mm512_castpd_si512(t);
+    const __m512d k = _mm512_sub_pd(t, magic);
+    const __m512d h = _mm512_add_pd(k, _mm512_set1_pd(half));
+
+    __m512d r = _mm512_fnmadd_pd(h, _mm512_set1_pd(kPiA), x);
+    r = _mm512_fnmadd_pd(h, _mm512_set1_pd(kPiB), r);
+    r = _mm512_fnmadd_pd(h, _mm512_set1_pd(kPiC), r);
+
+    const __m512d r2 = _mm512_mul_pd(r, r);
+    __m512d p = _mm512_set1_pd(kS19);
+    p = _mm512_fmadd_pd(p, r2, _mm512_set1_pd(kS17));
+    p = _mm512_fmadd_pd(p, r2, _mm512_set1_pd(kS15));
+    p = _mm512_fmadd_pd(p, r2, _mm512_set1_pd(kS13));
+    p = _mm512_fmadd_pd(p, r2, _mm512_set1_pd(kS11));
+    p = _mm512_fmadd_pd(p, r2, _mm512_set1_pd(kS9));
+    p = _mm512_fmadd_pd(p, r2, _mm512_set1_pd(kS7));
+    p = _mm512_fmadd_pd(p, r2, _mm512_set1_pd(kS5));
+    p = _mm512_fmadd_pd(p, r2, _mm512_set1_pd(kS3));
+    const __m512d s = _mm512_fmadd_pd(_mm512_mul_pd(r, r2), p, r);
+
+    // AVX-512F has no double xor, flip the sign in the integer domain.
+    const __m512i parity = _mm512_and_si512(
+        _mm512_add_epi64(k_bits, _mm512_set1_epi64(static_cast<long long>(flip))), _mm512_set1_epi64(1));
+    return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(s), _mm512_slli_epi64(parity, 63)));
+}
+
+void sinAvx512(const double* x, double* out, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm512_storeu_pd(out + i, trigAvx512(_mm512_loadu_pd(x + i), 0.0, 0));
+    sinScalar(x + i, out + i, n - i);
+}
+
+void cosAvx512(const double* x, double* out, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm512_storeu_pd(out + i, trigAvx512(_mm512_loadu_pd(x + i), 0.5, 1));
+    cosScalar(x + i, out + i, n - i);
+}
+
+void affineAvx512(const double* x, double* out, std::size_t n, double scale, double offset) noexcept
+{
+    const __m512d s = _mm512_set1_pd(scale);
+    const __m512d o = _mm512_set1_pd(offset);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm512_storeu_pd(out + i, _mm512_fmadd_pd(s, _mm512_loadu_pd(x + i), o));
+    affineScalar(x + i, out + i, n - i, scale, offset);
+}
+
+void multiplyAvx512(const double* a, const double* b, double* out, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm512_storeu_pd(out + i, _mm512_mul_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+    multiplyScalar(a + i, b + i, out + i, n - i);
+}
+
+MinMax minMaxAvx512(const double* x, std::size_t n) noexcept
+{
+    __m512d mn = _mm512_set1_pd(std::numeric_limits<double>::infinity());
+    __m512d mx = _mm512_set1_pd(-std::numeric_limits<double>::infinity());
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m512d v = _mm512_loadu_pd(x + i);
+        mn = _mm512_min_pd(v, mn);
+        mx = _mm512_max_pd(v, mx);
+    }
+
+    alignas(64) double lo[8], hi[8];
+    _mm512_store_pd(lo, mn);
+    _mm512_store_pd(hi, mx);
+    MinMax result = minMaxScalar(x + i, n - i);
+    for (int j = 0; j < 8; ++j)
+    {
+        if (lo[j] < result.min) result.min = lo[j];
+        if (hi[j] > result.max) result.max = hi[j];
+    }
+    return result;
+}
+
+#pragma GCC diagnostic pop
+#pragma GCC pop_options
+
+constexpr KernelTable kAvx512Table{sinAvx512, cosAvx512, affineAvx512, multiplyAvx512, minMaxAvx512};
+
+#endif // DP_SIMD_X86
+
+// =====================================================================================================================
+// Dispatch
+// =====================================================================================================================
+
+const KernelTable* tableFor(SimdLevel level) noexcept
+{
+    switch (level)
+    {
+#if DP_SIMD_X86
+        case SimdLevel::AVX512: return &kAvx512Table;
+        case SimdLevel::AVX2: return &kAvx2Table;
+        case SimdLevel::SSE2: return &kSse2Table;
+#endif
+        default: return &kScalarTable;
+    }
+}
+
+std::atomic<SimdLevel>& activeLevel() noexcept
+{
+    static std::atomic<SimdLevel> level{detectSimdLevel()};
+    return level;
+}
+
+const KernelTable& kernels() noexcept
+{
+    return *tableFor(activeLevel().load(std::memory_order_relaxed));
+}
+
+} // namespace
+
+// =====================================================================================================================
+
+SimdLevel detectSimdLevel() noexcept
+{
+#if DP_SIMD_X86
+    // The builtins also check that the OS saves the wide registers.
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return SimdLevel::AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse2"))
+        return SimdLevel::SSE2;
+#endif
+    return SimdLevel::Scalar;
+}
+
+SimdLevel activeSimdLevel() noexcept
+{
+    return activeLevel().load(std::memory_order_relaxed);
+}
+
+SimdLevel setSimdLevel(SimdLevel level) noexcept
+{
+    const SimdLevel supported = detectSimdLevel();
+    if (static_cast<int>(level) > static_cast<int>(supported))
+        level = supported;
+    activeLevel().store(level, std::memory_order_relaxed);
+    return level;
+}
+
+const char* simdLevelName(SimdLevel level) noexcept
+{
+    switch (level)
+    {
+        case SimdLevel::AVX512: return "AVX-512";
+        case SimdLevel::AVX2: return "AVX2";
+        case SimdLevel::SSE2: return "SSE2";
+        default: return "Scalar";
+    }
+}
+
+void simdSin(const double* x, double* out, std::size_t n) noexcept
+{
+    kernels().sin(x, out, n);
+}
+
+void simdCos(const double* x, double* out, std::size_t n) noexcept
+{
+    kernels().cos(x, out, n);
+}
+
+void simdAffine(const double* x, double* out, std::size_t n, double scale, double offset) noexcept
+{
+    kernels().affine(x, out, n, scale, offset);
+}
+
+void simdMultiply(const double* a, const double* b, double* out, std::size_t n) noexcept
+{
+    kernels().multiply(a, b, out, n);
+}
+
+MinMax simdMinMax(const double* x, std::size_t n) noexcept
+{
+    return kernels().min_max(x, n);
+}
+
+// =====================================================================================================================
@@ -0,0 +1,97 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldQwt – Vectorized kernels over contiguous double arrays, with runtime SIMD dispatch
+ *
+ *   The best instruction set supported by the CPU (and the OS) is picked on first use: AVX-512F, AVX2+FMA, SSE2 or
+ *   plain scalar code. All the levels compute the same algorithm, so the results only differ by rounding.
+ *
+ *   Accuracy of simdSin() / simdCos(): absolute error below kSimdTrigMaxError for |x| <= kSimdTrigMaxInput. The
+ *   argument is reduced to [-pi/2, pi/2] with a three-part pi (exact for |x/pi| < 2^26) and evaluated with a degree
+ *   19 odd polynomial. Larger inputs are still finite but lose accuracy.
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <cstddef>
+
+// Documented accuracy of the trigonometric kernels.
+constexpr double kSimdTrigMaxError = 1e-15;
+constexpr double kSimdTrigMaxInput = 1e6;
+
+/**
+ * @brief Instruction set used by the kernels.
+ */
+enum class SimdLevel
+{
+    Scalar,     ///< Portable C++ loop.
+    SSE2,       ///< 2 doubles per instruction (baseline on x86-64).
+    AVX2,       ///< 4 doubles per instruction, with FMA.
+    AVX512      ///< 8 doubles per instruction (AVX-512F).
+};
+
+/**
+ * @brief Result of simdMinMax(). For an empty input min > max.
+ */
+struct MinMax
+{
+    double min;
+    double max;
+};
+
+/**
+ * @brief Best level supported by this CPU.
+ */
+SimdLevel detectSimdLevel() noexcept;
+
+/**
+ * @brief Level currently used by the kernels.
+ */
+SimdLevel activeSimdLevel() noexcept;
+
+/**
+ * @brief Select the level used by the kernels (clamped to the supported one). Not thread-safe with running kernels.
+ * @return The level actually selected.
+ */
+SimdLevel setSimdLevel(SimdLevel level) noexcept;
+
+/**
+ * @brief Printable name of a level.
+ */
+const char* simdLevelName(SimdLevel level) noexcept;
+
+/**
+ * @brief out[i] = sin(x[i]). `out` may alias `x`.
+ */
+void simdSin(const double* x, double* out, std::size_t n) noexcept;
+
+/**
+ * @brief out[i] = cos(x[i]). `out` may alias `x`.
+ */
+void simdCos(const double* x, double* out, std::size_t n) noexcept;
+
+/**
+ * @brief out[i] = scale * x[i] + offset (scaling, offsets, unit conversions). `out` may alias `x`.
+ */
+void simdAffine(const double* x, double* out, std::size_t n, double scale, double offset) noexcept;
+
+/**
+ * @brief out[i] = a[i] * b[i] (envelopes, gains). `out` may alias `a` or `b`.
+ */
+void simdMultiply(const double* a, const double* b, double* out, std::size_t n) noexcept;
+
+/**
+ * @brief Minimum and maximum of x. NaNs are ignored (an all-NaN input gives the empty result).
+ */
+MinMax simdMinMax(const double* x, std::size_t n) noexcept;
+
+// =====================================================================================================================
@@ -0,0 +1,133 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldQwt – Lock-free single-producer / single-consumer ring queue
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Bounded lock-free queue for exactly one producer thread and one consumer thread.
+ *
+ * The capacity is rounded up to a power of two and allocated once. Each side only writes its own index and keeps a
+ * cached copy of the other one, so the shared cache lines are touched once per block, not once per item. push()
+ * never blocks: it accepts what fits and returns the count, the caller decides what to do with the rest.
+ */
+template <typename T>
+class SpscQueue
+{
+    static_assert(std::is_trivially_copyable<T>::value, "SpscQueue items must be trivially copyable.");
+
+public:
+
+    explicit SpscQueue(std::size_t capacity) :
+        buffer_(roundUpPow2(capacity)),
+        mask_(buffer_.size() - 1),
+        head_(0),
+        tail_cache_(0),
+        tail_(0),
+        head_cache_(0)
+    {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    std::size_t capacity() const noexcept
+    {
+        return this->buffer_.size();
+    }
+
+    /**
+     * @brief Producer side. Copy up to `count` items and return how many were accepted.
+     */
+    std::size_t push(const T* items, std::size_t count) noexcept
+    {
+        const std::size_t tail = this->tail_.load(std::memory_order_relaxed);
+        std::size_t free = this->buffer_.size() - (tail - this->head_cache_);
+        if (free < count)
+        {
+            this->head_cache_ = this->head_.load(std::memory_order_acquire);
+            free = this->buffer_.size() - (tail - this->head_cache_);
+        }
+
+        const std::size_t n = count < free ? count : free;
+        for (std::size_t i = 0; i < n; ++i)
+            this->buffer_[(tail + i) & this->mask_] = items[i];
+
+        this->tail_.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    /**
+     * @brief Consumer side. Hand everything available to `fn(const T* block, std::size_t count)` and return the count.
+     *
+     * The items are passed in place, in at most two contiguous blocks (before and after the wrap).
+     */
+    template <typename F>
+    std::size_t consume(F&& fn)
+    {
+        const std::size_t head = this->head_.load(std::memory_order_relaxed);
+        this->tail_cache_ = this->tail_.load(std::memory_order_acquire);
+        const std::size_t available = this->tail_cache_ - head;
+        if (available == 0)
+            return 0;
+
+        const std::size_t first = head & this->mask_;
+        const std::size_t until_wrap = this->buffer_.size() - first;
+        if (available <= until_wrap)
+            fn(&this->buffer_[first], available);
+        else
+        {
+            fn(&this->buffer_[first], until_wrap);
+            fn(&this->buffer_[0], available - until_wrap);
+        }
+
+        this->head_.store(head + available, std::memory_order_release);
+        return available;
+    }
+
+    /**
+     * @brief Approximate number of queued items (exact only when both sides are idle).
+     */
+    std::size_t sizeApprox() const noexcept
+    {
+        return this->tail_.load(std::memory_order_acquire) - this->head_.load(std::memory_order_acquire);
+    }
+
+private:
+
+    static std::size_t roundUpPow2(std::size_t value) noexcept
+    {
+        std::size_t pow2 = 1;
+        while (pow2 < value)
+            pow2 <<= 1;
+        return pow2;
+    }
+
+    std::vector<T> buffer_;
+    std::size_t mask_;
+
+    // Consumer side.
+    alignas(64) std::atomic<std::size_t> head_;
+    std::size_t tail_cache_;
+
+    // Producer side.
+    alignas(64) std::atomic<std::size_t> tail_;
+    std::size_t head_cache_;
+};
+
+// =====================================================================================================================
@@ -23,22 +23,28 @@
 #include <vector>
 #include <thread>
 #include <filesystem>
+#include <algorithm>
+#include <stdexcept>
+#include <string_view>
 
 // JSON INCLUDES
 #include <nlohmann/json.hpp>
 
 // SPDLOG INCLUDES
 #include <spdlog/spdlog.h>
-#include <spdlog/async.h>
-#include <spdlog/sinks/daily_file_sink.h>
-#include <spdlog/sinks/stdout_color_sinks.h>
-#include <spdlog/sinks/basic_file_sink.h>
 
-// PLATFORM-SPECIFIC
-#if defined(_WIN32)
-    #include <windows.h>
-#elif defined(__linux__)
-    #include <unistd.h>     
+// PROJECT INCLUDES
+#include "fmt_output.h"
+#include "spdlog_config.h"
+#include "log_levels.h"
+#include "thread_placement.h"
+
+// Compile-time log level floors of the components (overridable from CMake).
+#ifndef DP_LOG_LEVEL_MAIN
+    #define DP_LOG_LEVEL_MAIN DP_LOG_ACTIVE_LEVEL
+#endif
+#ifndef DP_LOG_LEVEL_WORKER
+    #define DP_LOG_LEVEL_WORKER DP_LOG_ACTIVE_LEVEL
 #endif
 
 // Constant expresions.
@@ -47,155 +53,17 @@ constexpr std::string_view kLogger2 = "ExampleAuxLogger";
 constexpr int kNumThreads = 4;
 
 /**
- * @brief Global configuration for spdlog asynchronous logging.
- *
- * This structure holds settings that affect the shared async thread pool
- * and the periodic flushing policy.
- */
-struct SpdlogGlobalConfig
-{
-    /**
-     * @brief Default constructor initializing recommended values.
-     */
-    SpdlogGlobalConfig() noexcept :
-        queue_size(8192),
-        thread_count(1),
-        flush_interval(std::chrono::seconds{3}),
-        use_flush_every(true)
-    {}
-
-    std::size_t queue_size;              ///< Global async thread pool queue size.
-    std::size_t thread_count;            ///< Global async thread pool worker thread count.
-    std::chrono::seconds flush_interval; ///< Interval used for spdlog::flush_every().
-    bool use_flush_every;                ///< Enable periodic flushing with flush_every().
-};
-
-/**
- * @brief Per-logger configuration for spdlog asynchronous loggers.
- *
- * This structure holds settings for each individual logger: sinks, levels
- * and overflow policy.
- */
-struct SpdlogLogConfig
-{
-    /**
-     * @brief Default constructor initializing recommended values.
-     */
-    SpdlogLogConfig() noexcept :
-        logger_name(std::string()),
-        file_path(std::string()),
-        log_pattern("[%Y-%m-%dT%H:%M:%S.%f][%P][%t][%^%L%$] %v"),
-        enable_console(true),
-        enable_file(false),
-        set_default(false),
-        console_level(spdlog::level::info),
-        file_level(spdlog::level::debug),
-        logger_level(spdlog::level::trace),
-        flush_on(spdlog::level::warn),
-        overflow_pol(spdlog::async_overflow_policy::overrun_oldest),
-        use_daily_file(true)
-    {}
-
-    std::string logger_name;                     ///< Logger name (used in spdlog registry).
-    std::string file_path;                       ///< Path to the log file (daily or basic sink).
-    std::string log_pattern;                     ///< Pattern for the logs.
-    bool enable_console;                         ///< Enable console sink.
-    bool enable_file;                            ///< Enable file sink.
-    bool set_default;                            ///< Set this logger as the global default logger.
-    spdlog::level::level_enum console_level;     ///< Minimum log level for console sink.
-    spdlog::level::level_enum file_level;        ///< Minimum log level for file sink.
-    spdlog::level::level_enum logger_level;      ///< Minimum log level accepted by the logger.
-    spdlog::level::level_enum flush_on;          ///< Force flush when log >= this level.
-    spdlog::async_overflow_policy overflow_pol;  ///< Overflow handling when queue is full.
-    bool use_daily_file;                         ///< Use daily_file_sink_mt (true) or basic_file_sink_mt (false).
-};
-
-/**
- * @brief Initialize global spdlog async thread pool and time behavior.
- *
- * @param cfg Global configuration for async logging.
- */
-inline void initSpdlog(const SpdlogGlobalConfig& cfg)
-{
-    // Initialize global async thread pool.
-    spdlog::init_thread_pool(cfg.queue_size, cfg.thread_count);
-    
-    // Optionally enable periodic flushing for all registered loggers.
-    if (cfg.use_flush_every)
-        spdlog::flush_every(cfg.flush_interval);
-}
-
-/**
- * @brief Create and register an asynchronous spdlog logger using SpdlogLogConfig.
- *
- * Uses the global async thread pool initialized by initSpdlog().
+ * @brief Example worker function for logs with threads.
  *
- * @param cfg Per-logger configuration structure.
- * @return std::shared_ptr<spdlog::logger> The created logger, or nullptr if no sinks are enabled.
+ * @param id Worker number.
+ * @param placement Cores and scheduling of the worker, named worker-<id>.
  */
-inline std::shared_ptr<spdlog::logger> registerSpdlogLogger(const SpdlogLogConfig& cfg)
+void workerThreadFunc(int id, ThreadPlacement placement)
 {
-    // Container.
-    std::vector<spdlog::sink_ptr> sinks;
-    sinks.reserve(2);
-
-    // Console sink.
-    if (cfg.enable_console)
-    {
-        auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
-        console_sink->set_pattern(cfg.log_pattern);
-        console_sink->set_level(cfg.console_level);
-        sinks.push_back(console_sink);
-    }
-
-    // File sink.
-    if (cfg.enable_file)
-    {
-        spdlog::sink_ptr file_sink;
-
-        if (cfg.use_daily_file)
-            file_sink = std::make_shared<spdlog::sinks::daily_file_sink_mt>(cfg.file_path, 0, 0);
-        else
-            file_sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(cfg.file_path, false);
-        
-        // Configure the sink.
-        file_sink->set_pattern(cfg.log_pattern);
-        file_sink->set_level(cfg.file_level);
-        sinks.push_back(file_sink);
-    }
-
-    // If no sinks at all do NOT create logger.
-    if (sinks.empty())
-        return nullptr;
-
-    // Create async logger using the global thread pool.
-    auto logger = std::make_shared<spdlog::async_logger>(
-        cfg.logger_name,
-        sinks.begin(),
-        sinks.end(),
-        spdlog::thread_pool(),             
-        cfg.overflow_pol);
-
-    // Set the level and the flush on.
-    logger->set_level(cfg.logger_level);
-    logger->flush_on(cfg.flush_on);
-
-    // Register logger in spdlog registry.
-    spdlog::register_logger(logger);
-
-    // Optionally set as default logger.
-    if (cfg.set_default)
-        spdlog::set_default_logger(logger);
-
-    // Return the logger.
-    return logger;
-}
+    // Place the thread before its first record.
+    placement.name = "worker-" + std::to_string(id);
+    applyThreadPlacement(placement);
 
-/**
- * @brief Example worker function for logs with threads.
- */
-void workerThreadFunc(int id)
-{
     // Retrieve the auxiliar logger by constexpr name.
     auto aux_logger    = spdlog::get(kLogger2.data());
 
@@ -206,50 +74,107 @@ void workerThreadFunc(int id)
         {"timestamp",  std::chrono::system_clock::now().time_since_epoch().count()},
     };
 
-    // Log using global/default logger (if any).
-    spdlog::debug("Worker {} payload (global): {}", id, payload.dump());
-    spdlog::info("Worker {} payload (global): {}", id, payload.dump());
-    spdlog::warn("Worker {} payload (global): {}", id, payload.dump());
-    spdlog::error("Worker {} payload (global): {}", id, payload.dump());
+    // Log using global/default logger (if any). Calls below DP_LOG_LEVEL_WORKER are compiled out.
+    DP_DEBUG(WORKER, "Worker {} payload (global): {}", id, payload.dump());
+    DP_INFO(WORKER, "Worker {} payload (global): {}", id, payload.dump());
+    DP_WARN(WORKER, "Worker {} payload (global): {}", id, payload.dump());
+    DP_ERROR(WORKER, "Worker {} payload (global): {}", id, payload.dump());
 
     // Log using auxiliary logger, if available.
     if (aux_logger)
     {
-        aux_logger->debug("Worker {} payload (aux): {}", id, payload.dump());
-        aux_logger->info("Worker {} payload (aux): {}", id, payload.dump());
-        aux_logger->warn("Worker {} payload (aux): {}", id, payload.dump());
-        aux_logger->error("Worker {} payload (aux): {}", id, payload.dump());
+        DP_LOGGER_DEBUG(WORKER, aux_logger, "Worker {} payload (aux): {}", id, payload.dump());
+        DP_LOGGER_INFO(WORKER, aux_logger, "Worker {} payload (aux): {}", id, payload.dump());
+        DP_LOGGER_WARN(WORKER, aux_logger, "Worker {} payload (aux): {}", id, payload.dump());
+        DP_LOGGER_ERROR(WORKER, aux_logger, "Worker {} payload (aux): {}", id, payload.dump());
     }
 }
 
-inline std::filesystem::path getExecutableDir()
+/**
+ * @brief Search all the logs (plain and compressed) of a directory without decompressing them to disk.
+ *
+ * @param logs_dir Directory containing the logs.
+ * @param needle Substring to search for.
+ * @return Number of matching lines.
+ */
+inline std::size_t grepLogsDir(const std::filesystem::path& logs_dir, std::string_view needle)
 {
-#if defined(_WIN32)
-    char buffer[MAX_PATH];
-    DWORD size = GetModuleFileNameA(nullptr, buffer, MAX_PATH);
-    if (size == 0 || size == MAX_PATH)
-        return std::filesystem::current_path();
-    return std::filesystem::path(buffer).parent_path();
-#elif defined(__linux__)
-    char buffer[4096];
-    ssize_t size = readlink("/proc/self/exe", buffer, sizeof(buffer)-1);
-    if (size <= 0)
-        return std::filesystem::current_path();
-    buffer[size] = '\0';
-    return std::filesystem::path(buffer).parent_path();
-#else
-    // Fallback for unknown platforms
-    return std::filesystem::current_path();
-#endif
+    std::vector<std::filesystem::path> files;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(logs_dir, ec))
+        if (entry.is_regular_file(ec))
+            files.push_back(entry.path());
+    std::sort(files.begin(), files.end());
+
+    // Matching lines written in large blocks (a grep can print millions).
+    FmtOutput& out = stdoutBuffer();
+    std::size_t matches = 0;
+    for (const auto& file : files)
+    {
+        const std::string name = file.filename().string();
+        matches += grepLogArchive(file, needle, [&out, &name](const std::string& line)
+        {
+            out.print(FMT_COMPILE("{}: {}\n"), name, line);
+        });
+    }
+    out.flush();
+    return matches;
 }
 
 /**
  * @brief Main entry point of the App_HelloWorldSpdlog application.
+ *
+ * Usage: App_HelloWorldSpdlog [--grep <text>] [--pool-cores <list>] [--worker-cores <list>] [--zmq <push|pub>]
+ *                             [--zmq-endpoint <endpoint>]
+ *
+ * Core lists like "2" or "0-3,6" keep the logger pool and the workers away from the cores of latency-critical
+ * threads. With --zmq the records are shipped to App_HelloWorldSpdlogCollector (started with the same endpoint and
+ * pattern) instead of being written to the local files.
  */
-int main()
+int main(int argc, char** argv)
 {
     // Get the executable dir.
     std::string logs_dir = getExecutableDir().string() + "/logs";
+
+    // Grep mode over the existing logs.
+    if (argc == 3 && std::string_view(argv[1]) == "--grep")
+    {
+        const std::size_t matches = grepLogsDir(logs_dir, argv[2]);
+        std::cout << "[INFO] " << matches << " matching lines." << std::endl;
+        return 0;
+    }
+
+    // Logger pool in the background: long slices, lower priority than the producers.
+    ThreadPlacement pool_placement;
+    pool_placement.name = "spdlog-pool";
+    pool_placement.policy = ThreadPolicy::Batch;
+    pool_placement.priority = 5;
+    ThreadPlacement worker_placement;
+    bool enable_zmq = false;
+    ZmqLogSinkConfig zmq_cfg;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string_view arg(argv[i]);
+        try
+        {
+            if (arg == "--pool-cores")
+                pool_placement.cores = parseCoreList(argv[i + 1]);
+            else if (arg == "--worker-cores")
+                worker_placement.cores = parseCoreList(argv[i + 1]);
+            else if (arg == "--zmq")
+            {
+                zmq_cfg.pattern = parseZmqLogPattern(argv[i + 1]);
+                enable_zmq = true;
+            }
+            else if (arg == "--zmq-endpoint")
+                zmq_cfg.endpoint = argv[i + 1];
+        }
+        catch (const std::invalid_argument& e)
+        {
+            std::cout << "[ERROR] " << e.what() << std::endl;
+            return 1;
+        }
+    }
      
     // Global log config.
     SpdlogGlobalConfig gcfg;
@@ -257,6 +182,10 @@ int main()
     gcfg.thread_count   = 1;
     gcfg.flush_interval = std::chrono::seconds{5};
     gcfg.use_flush_every = true;
+    gcfg.enable_metrics = true;
+    gcfg.metrics_interval = std::chrono::seconds{1};
+    gcfg.metrics_path = logs_dir + "/log_metrics.log";
+    gcfg.pool_placement = pool_placement;
     
     // Default logger (kLogger1).
     SpdlogLogConfig cfg1;
@@ -270,6 +199,9 @@ int main()
     cfg1.logger_level   = spdlog::level::trace;
     cfg1.flush_on       = spdlog::level::warn;
     cfg1.use_daily_file = true;
+    cfg1.compress_rotated = true;
+    cfg1.archive_policy.max_files = 30;
+    cfg1.archive_policy.max_total_bytes = 256ull * 1024ull * 1024ull;
     
     // Auxiliar logger (kLogger1).
     SpdlogLogConfig cfg2;
@@ -283,6 +215,30 @@ int main()
     cfg2.logger_level   = spdlog::level::debug;
     cfg2.flush_on       = spdlog::level::warn;
     cfg2.use_daily_file = true;
+    cfg2.compress_rotated = true;
+    cfg2.archive_policy.max_files = 7;
+    cfg2.archive_policy.max_total_bytes = 64ull * 1024ull * 1024ull;
+    cfg2.enable_mongo   = true;
+    cfg2.mongo_level    = spdlog::level::info;
+    cfg2.mongo_cfg.uri = "mongodb://localhost:27017";
+    cfg2.mongo_cfg.database = "my_db";
+    cfg2.mongo_cfg.collection = "logs";
+    cfg2.mongo_cfg.collection_type = MongoLogCollection::TimeSeries;
+    cfg2.mongo_cfg.fallback_path = logs_dir + "/" + std::string(kLogger2) + "_mongo_fallback.log";
+
+    // Shipping to the collector: the local files are written by the collector process (one context for both sinks).
+    if (enable_zmq)
+    {
+        zmq_cfg.context = std::make_shared<zmq::context_t>(1);
+        for (SpdlogLogConfig* cfg : {&cfg1, &cfg2})
+        {
+            cfg->enable_file = false;
+            cfg->enable_zmq = true;
+            cfg->zmq_level = cfg->file_level;
+            cfg->zmq_cfg = zmq_cfg;
+        }
+        std::cout << "[INFO] Shipping the logs to " << zmq_cfg.endpoint << "." << std::endl;
+    }
     
     // Init spdlog.
     initSpdlog(gcfg);
@@ -294,7 +250,7 @@ int main()
         std::cout << "[ERROR] Failed to create global logger!" << std::endl;
         return 1;
     }
-    spdlog::info("Global logger [{}] initialized.", kLogger1);
+    DP_INFO(MAIN, "Global logger [{}] initialized.", kLogger1);
 
     // Register auxiliar logger.
     auto aux_logger = registerSpdlogLogger(cfg2);
@@ -303,20 +259,22 @@ int main()
         std::cout << "[ERROR] Failed to create auxiliar logger!" << std::endl;
         return 1;
     }
-    aux_logger->info("Auxiliary logger [{}] initialized.", kLogger2);
+    DP_LOGGER_INFO(MAIN, aux_logger, "Auxiliary logger [{}] initialized.", kLogger2);
 
     // 4) Worker threads
     std::vector<std::thread> threads;
     for (int i = 0; i < kNumThreads; ++i)
     {
-        threads.emplace_back(workerThreadFunc, i);
+        threads.emplace_back(workerThreadFunc, i, worker_placement);
         std::this_thread::sleep_for(std::chrono::milliseconds(200));
     }
     for (auto &th : threads)
         th.join();
         
     // Finalize all logs.
-    spdlog::shutdown();
+    global_logger.reset();
+    aux_logger.reset();
+    shutdownSpdlog();
     
 	// All ok.
     return 0;
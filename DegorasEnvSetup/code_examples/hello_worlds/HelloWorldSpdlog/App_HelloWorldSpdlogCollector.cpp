@@ -0,0 +1,116 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldSpdlogCollector – Log collector process for the ZeroMQ log sink
+ **********************************************************************************************************************/
+
+// STD INCLUDES
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+// SPDLOG INCLUDES
+#include <spdlog/spdlog.h>
+
+// PROJECT INCLUDES
+#include "log_file_sink.h"
+#include "zmq_log_sink.h"
+
+// Stop flag, set from the signal handler.
+static std::atomic_bool g_stop_req{false};
+
+/**
+ * @brief SIGINT/SIGTERM handler.
+ */
+extern "C" void onStopSignal(int)
+{
+    g_stop_req.store(true);
+}
+
+/**
+ * @brief Main entry point of the App_HelloWorldSpdlogCollector application.
+ *
+ * Usage: App_HelloWorldSpdlogCollector [endpoint] [push|pub]
+ *
+ * Binds the endpoint (ipc://degoras-logs.ipc by default) and writes the records of every producer logger to its own
+ * compressed daily file in the `logs` directory, until Ctrl+C. The pattern (push by default) must match the one of
+ * the producers (App_HelloWorldSpdlog --zmq <push|pub>).
+ */
+int main(int argc, char** argv)
+{
+    // Get the executable dir, the endpoint and the pattern.
+    const std::string logs_dir = getExecutableDir().string() + "/logs";
+    const std::string endpoint = argc > 1 ? argv[1] : ZmqLogSinkConfig().endpoint;
+    ZmqLogPattern pattern = ZmqLogPattern::Push;
+    try
+    {
+        if (argc > 2)
+            pattern = parseZmqLogPattern(argv[2]);
+    }
+    catch (const std::invalid_argument& e)
+    {
+        std::cerr << "[Collector] " << e.what() << std::endl;
+        return 1;
+    }
+
+    std::signal(SIGINT, onStopSignal);
+    std::signal(SIGTERM, onStopSignal);
+
+    // One daily file per producer logger, with the usual archive policy.
+    auto factory = [&logs_dir](const std::string& logger_name) -> spdlog::sink_ptr
+    {
+        LogFileSinkConfig cfg;
+        cfg.file_path = logs_dir + "/" + logger_name + ".log";
+        cfg.file_level = spdlog::level::trace;
+        cfg.use_daily_file = true;
+        cfg.compress_rotated = true;
+
+        try
+        {
+            return createFileSink(cfg);
+        }
+        catch (const spdlog::spdlog_ex& ex)
+        {
+            std::cerr << "[Collector] Cannot open log file for " << logger_name << ": " << ex.what() << std::endl;
+            return nullptr;
+        }
+    };
+
+    ZmqLogCollector collector(endpoint, pattern, factory);
+    try
+    {
+        collector.start();
+    }
+    catch (const zmq::error_t& ex)
+    {
+        std::cerr << "[Collector] Cannot bind " << endpoint << ": " << ex.what() << std::endl;
+        return 1;
+    }
+
+    std::cout << "[INFO] Collecting logs from " << endpoint << " into " << logs_dir << " (Ctrl+C to stop)." << std::endl;
+
+    while (!g_stop_req.load())
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    // Write the queued records, close the files and wait for the archives.
+    collector.stop();
+    std::cout << "[INFO] " << collector.received() << " records collected." << std::endl;
+    LogCompressor::instance().stop();
+
+	// All ok.
+    return 0;
+}
+
+// =====================================================================================================================
@@ -0,0 +1,504 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   BenchHelloWorldSpdlog – Hot-path cost of the logging calls
+ **********************************************************************************************************************/
+
+// STD INCLUDES
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <filesystem>
+#include <fstream>
+#include <utility>
+#include <thread>
+#include <vector>
+
+// JSON INCLUDES
+#include <nlohmann/json.hpp>
+
+// SPDLOG INCLUDES
+#include <spdlog/spdlog.h>
+#include <spdlog/async.h>
+#include <spdlog/sinks/null_sink.h>
+#include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/sinks/daily_file_sink.h>
+
+// PROJECT INCLUDES
+#include "bench_report.h"
+#include "fmt_output.h"
+#include "latency_histogram.h"
+#include "log_levels.h"
+#include "log_metrics.h"
+#include "mongo_log_sink.h"
+#include "thread_placement.h"
+#include "zmq_log_sink.h"
+
+// Benchmark components with fixed floors, independent of the build configuration.
+#define DP_LOG_LEVEL_BENCH_KEPT SPDLOG_LEVEL_TRACE
+#define DP_LOG_LEVEL_BENCH_STRIPPED SPDLOG_LEVEL_INFO
+
+// Constant expresions.
+constexpr std::size_t kIterations = 1'000'000;
+
+/**
+ * @brief Run `fn` `iterations` times and return the mean cost per call in nanoseconds.
+ */
+template <typename F>
+double measureNs(std::size_t iterations, F&& fn)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+        fn(i);
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(iterations);
+}
+
+/**
+ * @brief Print one benchmark result line.
+ */
+void printResult(std::string_view name, double value, std::string_view unit)
+{
+    BenchReport::instance().add(std::string(name), value, std::string(unit));
+    std::cout << "  " << std::left << std::setw(52) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(2) << value
+              << " " << unit << '\n';
+}
+
+/**
+ * @brief Example payload, built on every call like in workerThreadFunc().
+ */
+std::string makePayload(std::size_t i)
+{
+    nlohmann::json payload = {
+        {"worker_id",  i},
+        {"status",     "running"},
+        {"timestamp",  std::chrono::system_clock::now().time_since_epoch().count()},
+    };
+    return payload.dump();
+}
+
+/**
+ * @brief Compare runtime-filtered, compile-time stripped and emitted debug calls.
+ */
+void benchLevelStripping()
+{
+    auto logger = std::make_shared<spdlog::logger>("bench", std::make_shared<spdlog::sinks::null_sink_mt>());
+    logger->set_level(spdlog::level::info);
+
+    BenchReport::instance().beginSection("Compile-time level stripping");
+    std::cout << "[Compile-time level stripping] " << kIterations << " debug calls, logger level = info" << std::endl;
+
+    const double runtime_ns = measureNs(kIterations, [&](std::size_t i)
+    {
+        DP_LOGGER_DEBUG(BENCH_KEPT, logger, "Worker {} payload: {}", i, makePayload(i));
+    });
+
+    const double stripped_ns = measureNs(kIterations, [&](std::size_t i)
+    {
+        DP_LOGGER_DEBUG(BENCH_STRIPPED, logger, "Worker {} payload: {}", i, makePayload(i));
+    });
+
+    logger->set_level(spdlog::level::debug);
+    const double emitted_ns = measureNs(kIterations, [&](std::size_t i)
+    {
+        DP_LOGGER_DEBUG(BENCH_KEPT, logger, "Worker {} payload: {}", i, makePayload(i));
+    });
+
+    printResult("runtime filtered (below logger level)", runtime_ns, "ns/call");
+    printResult("compile-time stripped (below component floor)", stripped_ns, "ns/call");
+    printResult("emitted to null sink", emitted_ns, "ns/call");
+}
+
+/**
+ * @brief Log `count` records through an async logger and return {producer ns/record, total ms until drained}.
+ */
+std::pair<double, double> runAsyncLoad(const spdlog::sink_ptr& sink, std::size_t count)
+{
+    const auto start = std::chrono::steady_clock::now();
+    double producer_ns = 0.0;
+    {
+        auto pool = std::make_shared<spdlog::details::thread_pool>(8192, 1);
+        auto logger = std::make_shared<spdlog::async_logger>(
+            "bench_async", sink, pool, spdlog::async_overflow_policy::block);
+
+        producer_ns = measureNs(count, [&](std::size_t i)
+        {
+            logger->info("Record {} from the benchmark producer", i);
+        });
+
+        // Destroying the pool drains the queue.
+        logger->flush();
+        logger.reset();
+        pool.reset();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return {producer_ns, std::chrono::duration<double, std::milli>(stop - start).count()};
+}
+
+/**
+ * @brief Compare per-record inserts against batched bulk inserts in the MongoDB sink.
+ *
+ * Uses a local server at mongodb://localhost:27017. If it is unreachable, the results show the fallback file path.
+ */
+void benchMongoSink()
+{
+    constexpr std::size_t kRecords = 100'000;
+    const std::filesystem::path fallback = std::filesystem::temp_directory_path() / "bench_mongo_fallback.log";
+    std::error_code ec;
+    std::filesystem::remove(fallback, ec);
+
+    BenchReport::instance().beginSection("MongoDB sink");
+    std::cout << "[MongoDB sink] " << kRecords << " records, capped collection degoras_bench.bench_logs" << std::endl;
+
+    for (std::size_t batch_size : {std::size_t{1}, std::size_t{64}, std::size_t{512}, std::size_t{4096}})
+    {
+        MongoLogSinkConfig cfg;
+        cfg.database = "degoras_bench";
+        cfg.collection = "bench_logs";
+        cfg.collection_type = MongoLogCollection::Capped;
+        cfg.batch_size = batch_size;
+        cfg.fallback_path = fallback.string();
+
+        const auto [producer_ns, total_ms] = runAsyncLoad(std::make_shared<MongoLogSink>(cfg), kRecords);
+        printResult("batch " + std::to_string(batch_size) + " producer", producer_ns, "ns/record");
+        printResult("batch " + std::to_string(batch_size) + " throughput",
+                    static_cast<double>(kRecords) / (total_ms / 1000.0), "records/s");
+    }
+
+    if (std::filesystem::exists(fallback, ec))
+        std::cout << "  [WARN] Server unreachable for some runs, records went to " << fallback << std::endl;
+}
+
+/**
+ * @brief Log `count` records through a synchronous logger and return the producer cost in ns/record.
+ */
+double runSyncLoad(const spdlog::sink_ptr& sink, std::size_t count)
+{
+    spdlog::logger logger("bench_sync", sink);
+    const double producer_ns = measureNs(count, [&](std::size_t i)
+    {
+        logger.info("Record {} from the benchmark producer", i);
+    });
+    logger.flush();
+    return producer_ns;
+}
+
+/**
+ * @brief Compare the producer cost of writing the daily file locally against shipping the records with ZeroMQ.
+ *
+ * The collectors run in this same process (own receive thread), so the numbers isolate the producer side.
+ */
+void benchZmqSink()
+{
+    constexpr std::size_t kRecords = 200'000;
+    const std::filesystem::path dir = std::filesystem::temp_directory_path() / "bench_zmq_logs";
+    std::error_code ec;
+    std::filesystem::remove_all(dir, ec);
+    std::filesystem::create_directories(dir, ec);
+
+    BenchReport::instance().beginSection("ZeroMQ sink");
+    std::cout << "[ZeroMQ sink] " << kRecords << " records, synchronous logger" << std::endl;
+
+    // Local daily file, the baseline.
+    const double file_ns = runSyncLoad(
+        std::make_shared<spdlog::sinks::daily_file_sink_mt>((dir / "local.log").string(), 0, 0), kRecords);
+    printResult("daily_file_sink_mt producer", file_ns, "ns/record");
+
+    // Shipping over inproc:// and ipc://, the collector writes the daily file.
+    auto context = std::make_shared<zmq::context_t>(1);
+    const std::vector<std::string> endpoints = {"inproc://bench-logs", "ipc://" + (dir / "bench.ipc").string()};
+    for (const std::string& endpoint : endpoints)
+    {
+        ZmqLogCollector collector(endpoint, ZmqLogPattern::Push, [&dir](const std::string& name) -> spdlog::sink_ptr
+        {
+            return std::make_shared<spdlog::sinks::daily_file_sink_mt>((dir / (name + ".log")).string(), 0, 0);
+        }, context);
+        collector.start();
+
+        ZmqLogSinkConfig cfg;
+        cfg.endpoint = endpoint;
+        cfg.context = context;
+        auto sink = std::make_shared<ZmqLogSink>(cfg);
+
+        const auto start = std::chrono::steady_clock::now();
+        const double zmq_ns = runSyncLoad(sink, kRecords);
+        while (collector.received() + sink->dropped() < kRecords &&
+               std::chrono::steady_clock::now() - start < std::chrono::seconds{30})
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        const double total_ms =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        const std::string scheme = endpoint.substr(0, endpoint.find(':'));
+        printResult("ZmqLogSink " + scheme + " producer", zmq_ns, "ns/record");
+        printResult("ZmqLogSink " + scheme + " throughput (collected)",
+                    static_cast<double>(collector.received()) / (total_ms / 1000.0), "records/s");
+        printResult("ZmqLogSink " + scheme + " dropped", static_cast<double>(sink->dropped()), "records");
+        printResult("ZmqLogSink " + scheme + " record buffers allocated",
+                    static_cast<double>(sink->allocatedBuffers()), "buffers");
+        collector.stop();
+    }
+
+    std::filesystem::remove_all(dir, ec);
+}
+
+/**
+ * @brief Measure the overhead of the sink metering and the cost of a metrics snapshot.
+ */
+void benchMetrics()
+{
+    BenchReport::instance().beginSection("Logging metrics");
+    std::cout << "[Logging metrics] " << kIterations << " records, synchronous logger, null sink" << std::endl;
+
+    LogMetrics& metrics = LogMetrics::instance();
+    metrics.setEnabled(true);
+
+    auto null_sink = std::make_shared<spdlog::sinks::null_sink_mt>();
+    const double plain_ns = runSyncLoad(null_sink, kIterations);
+    const double metered_ns = runSyncLoad(metrics.attach("bench_sync", "null", null_sink), kIterations);
+
+    const double snapshot_ns = measureNs(10'000, [&](std::size_t)
+    {
+        const LogMetricsSnapshot snap = metrics.snapshot();
+        (void)snap;
+    });
+
+    metrics.setEnabled(false);
+
+    printResult("plain null sink", plain_ns, "ns/record");
+    printResult("metered null sink", metered_ns, "ns/record");
+    printResult("metering overhead", metered_ns - plain_ns, "ns/record");
+    printResult("snapshot()", snapshot_ns, "ns/call");
+}
+
+/**
+ * @brief Lines per second written to a file: iostream with std::endl and '\n', temporary fmt strings and FmtOutput.
+ */
+void benchFormattedOutput()
+{
+    constexpr std::size_t kLines = 1'000'000;
+    const std::string path = (std::filesystem::temp_directory_path() / "degoras_bench_output.txt").string();
+
+    BenchReport::instance().beginSection("Formatted output");
+    std::cout << "[Formatted output] " << kLines << " lines \"[OK] Inserted document <i> (<value> ms)\" to a file"
+              << std::endl;
+
+    // Lines per second of a run, including the final flush and close.
+    auto linesPerSecond = [](auto&& run)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        const auto stop = std::chrono::steady_clock::now();
+        return static_cast<double>(kLines) / std::chrono::duration<double>(stop - start).count();
+    };
+
+    const double endl_rate = linesPerSecond([&path]()
+    {
+        std::ofstream file(path, std::ios::trunc);
+        file << std::fixed << std::setprecision(3);
+        for (std::size_t i = 0; i < kLines; ++i)
+            file << "[OK] Inserted document " << i << " (" << i * 0.001 << " ms)" << std::endl;
+    });
+    const double newline_rate = linesPerSecond([&path]()
+    {
+        std::ofstream file(path, std::ios::trunc);
+        file << std::fixed << std::setprecision(3);
+        for (std::size_t i = 0; i < kLines; ++i)
+            file << "[OK] Inserted document " << i << " (" << i * 0.001 << " ms)" << '\n';
+    });
+    const double string_rate = linesPerSecond([&path]()
+    {
+        std::ofstream file(path, std::ios::trunc);
+        for (std::size_t i = 0; i < kLines; ++i)
+            file << fmt::format("[OK] Inserted document {} ({:.3f} ms)\n", i, i * 0.001);
+    });
+    const double buffer_rate = linesPerSecond([&path]()
+    {
+        FmtOutput out(path);
+        for (std::size_t i = 0; i < kLines; ++i)
+            out.print(FMT_COMPILE("[OK] Inserted document {} ({:.3f} ms)\n"), i, i * 0.001);
+    });
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+
+    printResult("iostream + std::endl", endl_rate, "lines/s");
+    printResult("iostream + '\\n'", newline_rate, "lines/s");
+    printResult("fmt::format temporary string + iostream", string_rate, "lines/s");
+    printResult("FmtOutput (FMT_COMPILE, buffered)", buffer_rate, "lines/s");
+    printResult("FmtOutput vs iostream + std::endl", buffer_rate / endl_rate, "x");
+    printResult("FmtOutput vs iostream + '\\n'", buffer_rate / newline_rate, "x");
+}
+
+/**
+ * @brief Run a periodic critical thread (1 ms period) and record how late it wakes up.
+ *
+ * With `loaded`, producers flood an async file logger meanwhile. With `placed`, the critical thread gets a real time
+ * policy and a core of its own, and the producers and the logger pool a batch policy on the other cores.
+ *
+ * @return False if some placement was refused (see the warnings).
+ */
+bool runCriticalThread(bool loaded, bool placed, LatencyHistogram& lateness)
+{
+    constexpr int kSamples = 2'000;
+    constexpr std::chrono::microseconds kPeriod{1'000};
+    const unsigned producers = loaded ? std::max(2u, std::thread::hardware_concurrency()) : 0u;
+    const std::string path = (std::filesystem::temp_directory_path() / "degoras_bench_placement.log").string();
+
+    ThreadPlacement critical;
+    ThreadPlacement background;
+    if (placed)
+    {
+        const std::vector<int> cores = currentThreadCores();
+        critical.name = "bench-critical";
+        critical.policy = ThreadPolicy::Fifo;
+        critical.priority = 50;
+        background.policy = ThreadPolicy::Batch;
+        background.priority = 10;
+        if (cores.size() >= 2)
+        {
+            critical.cores = {cores.back()};
+            background.cores.assign(cores.begin(), cores.end() - 1);
+        }
+    }
+
+    std::atomic_bool applied{true};
+    auto place = [placed, &applied](const ThreadPlacement& placement)
+    {
+        if (placed && !applyThreadPlacement(placement))
+            applied.store(false);
+    };
+
+    {
+        ThreadPlacement pool_placement = background;
+        pool_placement.name = "bench-pool";
+        auto pool = std::make_shared<spdlog::details::thread_pool>(8192, 1, [&place, pool_placement]()
+        {
+            place(pool_placement);
+        });
+        auto logger = std::make_shared<spdlog::async_logger>(
+            "bench_placement", std::make_shared<spdlog::sinks::basic_file_sink_mt>(path, true), pool,
+            spdlog::async_overflow_policy::overrun_oldest);
+
+        std::atomic_bool stop{false};
+        std::vector<std::thread> threads;
+        for (unsigned p = 0; p < producers; ++p)
+        {
+            threads.emplace_back([&, p]()
+            {
+                ThreadPlacement placement = background;
+                placement.name = "bench-load-" + std::to_string(p);
+                place(placement);
+                for (std::size_t i = 0; !stop.load(std::memory_order_relaxed); ++i)
+                    logger->info("Record {} from producer {}: {}", i, p, makePayload(i));
+            });
+        }
+
+        std::thread critical_thread([&]()
+        {
+            place(critical);
+            auto next = std::chrono::steady_clock::now();
+            for (int i = 0; i < kSamples; ++i)
+            {
+                next += kPeriod;
+                std::this_thread::sleep_until(next);
+                lateness.record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::steady_clock::now() - next).count());
+            }
+        });
+        critical_thread.join();
+
+        stop.store(true);
+        for (std::thread& thread : threads)
+            thread.join();
+        logger.reset();
+        pool.reset();
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    return applied.load();
+}
+
+/**
+ * @brief Tail wake-up latency of a critical thread, idle, with the logger under load, and placed away from it.
+ */
+void benchThreadPlacement()
+{
+    BenchReport::instance().beginSection("Thread placement");
+    std::cout << "[Thread placement] 1 ms periodic thread, " << std::max(2u, std::thread::hardware_concurrency())
+              << " producers flooding an async file logger, " << currentThreadCores().size() << " cores" << std::endl;
+
+    auto printLateness = [](const std::string& label, const LatencyHistogram& lateness)
+    {
+        printResult(label + " p50", static_cast<double>(lateness.percentileNs(0.5)) / 1000.0, "us");
+        printResult(label + " p99", static_cast<double>(lateness.percentileNs(0.99)) / 1000.0, "us");
+        printResult(label + " p99.9", static_cast<double>(lateness.percentileNs(0.999)) / 1000.0, "us");
+        printResult(label + " max", static_cast<double>(lateness.maxNs()) / 1000.0, "us");
+    };
+
+    LatencyHistogram idle;
+    LatencyHistogram loaded;
+    LatencyHistogram placed;
+    runCriticalThread(false, false, idle);
+    runCriticalThread(true, false, loaded);
+    const bool applied = runCriticalThread(true, true, placed);
+
+    printLateness("wake-up lateness, idle", idle);
+    printLateness("wake-up lateness, logger loaded", loaded);
+    printLateness("wake-up lateness, logger loaded, placed", placed);
+    printResult("placed vs default p99", static_cast<double>(loaded.percentileNs(0.99))
+                                         / static_cast<double>(std::max<std::int64_t>(placed.percentileNs(0.99), 1)),
+                "x");
+    if (!applied)
+        std::cout << "  [WARN] Placement partly refused (real time needs CAP_SYS_NICE or an rtprio limit)" << std::endl;
+    if (currentThreadCores().size() < 2)
+        std::cout << "  [WARN] Single core: the placed run only changes the scheduling, not the cores" << std::endl;
+}
+
+/**
+ * @brief Main entry point of the Bench_HelloWorldSpdlog application.
+ */
+int main(int argc, char** argv)
+{
+    std::cout << "==================================" << std::endl;
+    std::cout << "= HELLO WORLD SPDLOG BENCHMARKS  =" << std::endl;
+    std::cout << "==================================" << std::endl;
+
+    std::string json_path;
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        if (std::string_view(argv[i]) == "--json")
+            json_path = argv[++i];
+    }
+    BenchReport::instance().setSuite("HelloWorldSpdlog");
+
+    benchLevelStripping();
+    benchMetrics();
+    benchFormattedOutput();
+    benchThreadPlacement();
+    benchMongoSink();
+    benchZmqSink();
+
+    if (!json_path.empty() && !BenchReport::instance().writeJson(json_path))
+        return 1;
+
+    // All ok.
+    return 0;
+}
+
+// =====================================================================================================================
@@ -0,0 +1,491 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// STD INCLUDES
+#include <algorithm>
+#include <iostream>
+#include <system_error>
+
+// ZSTD INCLUDES
+#include <zstd.h>
+
+// PLATFORM-SPECIFIC
+#if defined(_WIN32)
+    #include <windows.h>
+#elif defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+// PROJECT INCLUDES
+#include "log_compressor.h"
+
+namespace
+{
+
+// Length of the "_YYYY-MM-DD" suffix appended by spdlog's daily filename calculator.
+constexpr std::size_t kDailySuffixLen = 11;
+
+constexpr std::string_view kArchiveExt = ".zst";
+
+/**
+ * @brief Lower the CPU (and on Windows also I/O) priority of the calling thread.
+ */
+void setBackgroundPriority()
+{
+#if defined(_WIN32)
+    SetThreadPriority(GetCurrentThread(), THREAD_MODE_BACKGROUND_BEGIN);
+#elif defined(__linux__)
+    sched_param param{};
+    param.sched_priority = 0;
+    pthread_setschedparam(pthread_self(), SCHED_IDLE, &param);
+#endif
+}
+
+bool startsWith(std::string_view s, std::string_view prefix)
+{
+    return s.size() >= prefix.size() && s.compare(0, prefix.size(), prefix) == 0;
+}
+
+bool endsWith(std::string_view s, std::string_view suffix)
+{
+    return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+} // namespace
+
+// =====================================================================================================================
+// LogCompressor
+// =====================================================================================================================
+
+LogCompressor& LogCompressor::instance()
+{
+    static LogCompressor compressor;
+    return compressor;
+}
+
+LogCompressor::LogCompressor() :
+    stop_req_(false)
+{
+    this->worker_ = std::thread(&LogCompressor::run, this);
+}
+
+LogCompressor::~LogCompressor()
+{
+    this->stop();
+}
+
+void LogCompressor::enqueue(const std::filesystem::path& file, const LogArchivePolicy& policy)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mtx_);
+        if (this->stop_req_)
+            return;
+        this->jobs_.push_back(Job{file, policy});
+    }
+    this->cv_.notify_one();
+}
+
+void LogCompressor::enqueueStale(const std::filesystem::path& base_file,
+                                 const std::filesystem::path& current_file,
+                                 const LogArchivePolicy& policy)
+{
+    const std::filesystem::path dir = base_file.has_parent_path() ? base_file.parent_path() : ".";
+    const std::string prefix = base_file.stem().string() + "_";
+    const std::string ext = base_file.extension().string();
+    const std::string current = current_file.filename().string();
+
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec))
+    {
+        if (!entry.is_regular_file(ec))
+            continue;
+
+        const std::string name = entry.path().filename().string();
+        if (name == current || name.size() != prefix.size() + kDailySuffixLen - 1 + ext.size())
+            continue;
+        if (startsWith(name, prefix) && endsWith(name, ext))
+            this->enqueue(entry.path(), policy);
+    }
+}
+
+void LogCompressor::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mtx_);
+        this->stop_req_ = true;
+    }
+    this->cv_.notify_one();
+
+    if (this->worker_.joinable())
+        this->worker_.join();
+}
+
+std::size_t LogCompressor::pending() const
+{
+    std::lock_guard<std::mutex> lock(this->mtx_);
+    return this->jobs_.size();
+}
+
+void LogCompressor::run()
+{
+    setBackgroundPriority();
+
+    for (;;)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(this->mtx_);
+            this->cv_.wait(lock, [this]{ return this->stop_req_ || !this->jobs_.empty(); });
+
+            // Drain everything queued before the stop request.
+            if (this->jobs_.empty())
+                return;
+
+            job = std::move(this->jobs_.front());
+            this->jobs_.pop_front();
+        }
+
+        compressFile(job);
+    }
+}
+
+void LogCompressor::compressFile(const Job& job)
+{
+    std::error_code ec;
+    const std::filesystem::path archive = job.file.string() + std::string(kArchiveExt);
+    const std::filesystem::path part = archive.string() + ".part";
+
+    if (!std::filesystem::is_regular_file(job.file, ec))
+        return;
+
+    // Nothing worth archiving.
+    if (std::filesystem::file_size(job.file, ec) == 0)
+    {
+        std::filesystem::remove(job.file, ec);
+        return;
+    }
+
+    std::ifstream src(job.file, std::ios::binary);
+    std::ofstream dst(part, std::ios::binary | std::ios::trunc);
+    if (!src || !dst)
+    {
+        std::cerr << "[LogCompressor] Cannot open " << job.file << " for compression." << std::endl;
+        return;
+    }
+
+    ZSTD_CCtx* cctx = ZSTD_createCCtx();
+    ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, job.policy.compression_level);
+    ZSTD_CCtx_setParameter(cctx, ZSTD_c_checksumFlag, 1);
+
+    std::vector<char> in_buf(ZSTD_CStreamInSize());
+    std::vector<char> out_buf(ZSTD_CStreamOutSize());
+    bool ok = true;
+
+    // Stream the file through the compressor in fixed-size blocks.
+    for (bool last = false; ok && !last;)
+    {
+        src.read(in_buf.data(), static_cast<std::streamsize>(in_buf.size()));
+        const std::size_t read = static_cast<std::size_t>(src.gcount());
+        last = read < in_buf.size();
+
+        const ZSTD_EndDirective mode = last ? ZSTD_e_end : ZSTD_e_continue;
+        ZSTD_inBuffer input{in_buf.data(), read, 0};
+        bool finished = false;
+        while (!finished)
+        {
+            ZSTD_outBuffer output{out_buf.data(), out_buf.size(), 0};
+            const std::size_t remaining = ZSTD_compressStream2(cctx, &output, &input, mode);
+            if (ZSTD_isError(remaining))
+            {
+                std::cerr << "[LogCompressor] " << ZSTD_getErrorName(remaining) << std::endl;
+                ok = false;
+                break;
+            }
+            dst.write(out_buf.data(), static_cast<std::streamsize>(output.pos));
+            finished = last ? (remaining == 0) : (input.pos == input.size);
+        }
+    }
+
+    ZSTD_freeCCtx(cctx);
+    src.close();
+    dst.close();
+
+    if (!ok || !dst)
+    {
+        std::filesystem::remove(part, ec);
+        return;
+    }
+
+    // Publish the frame: rename if it is the first one, otherwise append it to the existing archive.
+    if (!std::filesystem::exists(archive, ec))
+    {
+        std::filesystem::rename(part, archive, ec);
+    }
+    else
+    {
+        const std::uintmax_t archive_size = std::filesystem::file_size(archive, ec);
+        std::ifstream frame(part, std::ios::binary);
+        std::ofstream out(archive, std::ios::binary | std::ios::app);
+        bool appended = !ec && frame && out && (out << frame.rdbuf()) && out.flush();
+        frame.close();
+        out.close();
+        appended = appended && !out.fail();
+
+        // Short write (disk full...): cut the partial frame, keep the plain log and the part file.
+        if (!appended)
+        {
+            std::error_code resize_ec;
+            if (!ec)
+                std::filesystem::resize_file(archive, archive_size, resize_ec);
+            std::cerr << "[LogCompressor] Cannot append " << part << " to " << archive << "." << std::endl;
+            return;
+        }
+        std::filesystem::remove(part, ec);
+        ec.clear();
+    }
+
+    if (ec)
+    {
+        std::cerr << "[LogCompressor] Cannot publish " << archive << ": " << ec.message() << std::endl;
+        return;
+    }
+
+    std::filesystem::remove(job.file, ec);
+    applyRetention(archive, job.policy);
+}
+
+void LogCompressor::applyRetention(const std::filesystem::path& archive, const LogArchivePolicy& policy)
+{
+    if (policy.max_files == 0 && policy.max_total_bytes == 0)
+        return;
+
+    // Archive names follow "<stem>_YYYY-MM-DD<ext>.zst".
+    const std::filesystem::path plain = archive.stem();
+    const std::string plain_stem = plain.stem().string();
+    if (plain_stem.size() <= kDailySuffixLen)
+        return;
+
+    const std::string prefix = plain_stem.substr(0, plain_stem.size() - kDailySuffixLen + 1);
+    const std::string suffix = plain.extension().string() + std::string(kArchiveExt);
+    const std::size_t name_len = archive.filename().string().size();
+
+    struct Entry
+    {
+        std::filesystem::path path;
+        std::uintmax_t size;
+    };
+
+    std::error_code ec;
+    std::vector<Entry> entries;
+    std::uintmax_t total = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(archive.parent_path(), ec))
+    {
+        const std::string name = entry.path().filename().string();
+        if (name.size() != name_len || !startsWith(name, prefix) || !endsWith(name, suffix))
+            continue;
+
+        const std::uintmax_t size = entry.file_size(ec);
+        entries.push_back(Entry{entry.path(), size});
+        total += size;
+    }
+
+    // The date in the name sorts chronologically.
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry& a, const Entry& b){ return a.path.filename() < b.path.filename(); });
+
+    std::size_t count = entries.size();
+    for (const Entry& entry : entries)
+    {
+        const bool over_count = policy.max_files != 0 && count > policy.max_files;
+        const bool over_size = policy.max_total_bytes != 0 && total > policy.max_total_bytes;
+        if (!over_count && !over_size)
+            break;
+
+        // Always keep the archive just written.
+        if (entry.path.filename() == archive.filename())
+            continue;
+
+        if (std::filesystem::remove(entry.path, ec))
+        {
+            --count;
+            total -= entry.size;
+        }
+    }
+}
+
+// =====================================================================================================================
+// LogArchiveReader
+// =====================================================================================================================
+
+LogArchiveReader::LogArchiveReader(const std::filesystem::path& path) :
+    in_(path, std::ios::binary),
+    dctx_(nullptr),
+    in_pos_(0),
+    in_size_(0),
+    pending_pos_(0),
+    frame_rem_(0)
+{
+    if (!this->in_)
+    {
+        this->error_ = "Cannot open " + path.string();
+        return;
+    }
+
+    if (path.extension() == kArchiveExt)
+    {
+        this->dctx_ = ZSTD_createDCtx();
+        this->in_buf_.resize(ZSTD_DStreamInSize());
+        this->out_buf_.resize(ZSTD_DStreamOutSize());
+    }
+    else
+    {
+        this->out_buf_.resize(64 * 1024);
+    }
+}
+
+LogArchiveReader::~LogArchiveReader()
+{
+    if (this->dctx_)
+        ZSTD_freeDCtx(this->dctx_);
+}
+
+bool LogArchiveReader::getLine(std::string& line)
+{
+    for (;;)
+    {
+        const std::size_t nl = this->pending_.find('\n', this->pending_pos_);
+        if (nl != std::string::npos)
+        {
+            line.assign(this->pending_, this->pending_pos_, nl - this->pending_pos_);
+            this->pending_pos_ = nl + 1;
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+            return true;
+        }
+
+        // Keep only the unfinished tail before decompressing the next block.
+        this->pending_.erase(0, this->pending_pos_);
+        this->pending_pos_ = 0;
+
+        if (!this->fill())
+        {
+            if (this->pending_.empty())
+                return false;
+            line.swap(this->pending_);
+            this->pending_.clear();
+            return true;
+        }
+    }
+}
+
+const std::string& LogArchiveReader::error() const noexcept
+{
+    return this->error_;
+}
+
+bool LogArchiveReader::fill()
+{
+    if (!this->error_.empty())
+        return false;
+
+    // Plain file.
+    if (!this->dctx_)
+    {
+        this->in_.read(this->out_buf_.data(), static_cast<std::streamsize>(this->out_buf_.size()));
+        const std::size_t read = static_cast<std::size_t>(this->in_.gcount());
+        this->pending_.append(this->out_buf_.data(), read);
+        return read > 0;
+    }
+
+    // Archive, possibly made of several concatenated frames.
+    for (;;)
+    {
+        if (this->in_pos_ == this->in_size_)
+        {
+            this->in_.read(this->in_buf_.data(), static_cast<std::streamsize>(this->in_buf_.size()));
+            this->in_size_ = static_cast<std::size_t>(this->in_.gcount());
+            this->in_pos_ = 0;
+            if (this->in_size_ == 0)
+                return this->drain();
+        }
+
+        ZSTD_inBuffer input{this->in_buf_.data(), this->in_size_, this->in_pos_};
+        ZSTD_outBuffer output{this->out_buf_.data(), this->out_buf_.size(), 0};
+        const std::size_t ret = ZSTD_decompressStream(this->dctx_, &output, &input);
+        if (ZSTD_isError(ret))
+        {
+            this->error_ = ZSTD_getErrorName(ret);
+            return false;
+        }
+
+        this->in_pos_ = input.pos;
+        this->frame_rem_ = ret;
+        if (output.pos > 0)
+        {
+            this->pending_.append(this->out_buf_.data(), output.pos);
+            return true;
+        }
+    }
+}
+
+bool LogArchiveReader::drain()
+{
+    // A full output buffer in the last call may leave decoded bytes inside zstd with no input left to push them.
+    if (this->frame_rem_ == 0)
+        return false;
+
+    ZSTD_inBuffer input{this->in_buf_.data(), 0, 0};
+    ZSTD_outBuffer output{this->out_buf_.data(), this->out_buf_.size(), 0};
+    const std::size_t ret = ZSTD_decompressStream(this->dctx_, &output, &input);
+    if (ZSTD_isError(ret))
+    {
+        this->error_ = ZSTD_getErrorName(ret);
+        return false;
+    }
+
+    this->frame_rem_ = ret;
+    if (output.pos > 0)
+    {
+        this->pending_.append(this->out_buf_.data(), output.pos);
+        return true;
+    }
+    if (ret != 0)
+        this->error_ = "Truncated zstd frame";
+    return false;
+}
+
+// =====================================================================================================================
+
+std::size_t grepLogArchive(const std::filesystem::path& path,
+                           std::string_view needle,
+                           const std::function<void(const std::string&)>& on_match)
+{
+    LogArchiveReader reader(path);
+    std::string line;
+    std::size_t matches = 0;
+
+    while (reader.getLine(line))
+    {
+        if (line.find(needle) != std::string::npos)
+        {
+            ++matches;
+            if (on_match)
+                on_match(line);
+        }
+    }
+
+    if (!reader.error().empty())
+        std::cerr << "[LogArchiveReader] " << path << ": " << reader.error() << std::endl;
+
+    return matches;
+}
+
+// =====================================================================================================================
@@ -0,0 +1,187 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldSpdlog – Background zstd compression and retention of closed daily log files
+ **********************************************************************************************************************/
+
+#pragma once
+
+// STD INCLUDES
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// ZSTD FORWARD DECLARATIONS
+typedef struct ZSTD_DCtx_s ZSTD_DCtx;
+
+/**
+ * @brief Compression and retention policy applied to the archives of one logger.
+ */
+struct LogArchivePolicy
+{
+    /**
+     * @brief Default constructor initializing recommended values.
+     */
+    LogArchivePolicy() noexcept :
+        compression_level(9),
+        max_files(30),
+        max_total_bytes(512ull * 1024ull * 1024ull)
+    {}
+
+    int compression_level;          ///< zstd compression level (1 fastest ... 19 smallest).
+    std::size_t max_files;          ///< Maximum number of archives kept per logger (0 = unlimited).
+    std::uintmax_t max_total_bytes; ///< Maximum total size of the archives per logger (0 = unlimited).
+};
+
+/**
+ * @brief Low-priority background worker that compresses closed log files into `<file>.zst` archives.
+ *
+ * The spdlog file sinks call enqueue() from their `after_close` event handler, so the only work done on the
+ * logging side is pushing a path into a queue. Compression, archive appending and retention run on a dedicated
+ * idle-priority thread. If an archive already exists (the same daily file closed several times in one day), the
+ * new data is appended as an extra zstd frame, which the format decodes transparently as a single stream.
+ */
+class LogCompressor
+{
+public:
+
+    /**
+     * @brief Get the process-wide compressor. The worker thread is started on first use.
+     */
+    static LogCompressor& instance();
+
+    LogCompressor(const LogCompressor&) = delete;
+    LogCompressor& operator=(const LogCompressor&) = delete;
+
+    ~LogCompressor();
+
+    /**
+     * @brief Queue a closed log file for compression. Never blocks on I/O.
+     * @param file Path of the closed plain-text log file.
+     * @param policy Compression and retention policy for the owning logger.
+     */
+    void enqueue(const std::filesystem::path& file, const LogArchivePolicy& policy);
+
+    /**
+     * @brief Queue the files left uncompressed by previous runs of a daily logger.
+     *
+     * Matches `<stem>_*<ext>` next to `base_file`, skipping the file currently opened by the sink.
+     *
+     * @param base_file Base filename given to the daily sink.
+     * @param current_file File currently opened by the daily sink.
+     * @param policy Compression and retention policy for the owning logger.
+     */
+    void enqueueStale(const std::filesystem::path& base_file,
+                      const std::filesystem::path& current_file,
+                      const LogArchivePolicy& policy);
+
+    /**
+     * @brief Finish the queued jobs and stop the worker. Later enqueues are ignored.
+     */
+    void stop();
+
+    /**
+     * @brief Number of files waiting for compression.
+     */
+    std::size_t pending() const;
+
+private:
+
+    struct Job
+    {
+        std::filesystem::path file;
+        LogArchivePolicy policy;
+    };
+
+    LogCompressor();
+
+    void run();
+
+    static void compressFile(const Job& job);
+
+    static void applyRetention(const std::filesystem::path& archive, const LogArchivePolicy& policy);
+
+    mutable std::mutex mtx_;
+    std::condition_variable cv_;
+    std::deque<Job> jobs_;
+    bool stop_req_;
+    std::thread worker_;
+};
+
+/**
+ * @brief Streaming line reader over a `.zst` log archive (or a plain log file).
+ *
+ * Data is decompressed in fixed-size blocks as lines are consumed, so archives of any size can be scanned with
+ * constant memory and without writing anything to disk.
+ */
+class LogArchiveReader
+{
+public:
+
+    explicit LogArchiveReader(const std::filesystem::path& path);
+
+    LogArchiveReader(const LogArchiveReader&) = delete;
+    LogArchiveReader& operator=(const LogArchiveReader&) = delete;
+
+    ~LogArchiveReader();
+
+    /**
+     * @brief Read the next line (without the trailing newline).
+     * @return False at the end of the data or on error (see error()).
+     */
+    bool getLine(std::string& line);
+
+    /**
+     * @brief Last error message, empty if none.
+     */
+    const std::string& error() const noexcept;
+
+private:
+
+    bool fill();
+
+    /**
+     * @brief At the end of the input, flush the bytes still held by the decoder. False when there are none left.
+     */
+    bool drain();
+
+    std::ifstream in_;
+    ZSTD_DCtx* dctx_;
+    std::vector<char> in_buf_;
+    std::size_t in_pos_;
+    std::size_t in_size_;
+    std::vector<char> out_buf_;
+    std::string pending_;
+    std::size_t pending_pos_;
+    std::size_t frame_rem_;
+    std::string error_;
+};
+
+/**
+ * @brief Scan a log archive or plain log file and report the lines containing a substring.
+ * @param path Archive (`.zst`) or plain log file.
+ * @param needle Substring to search for.
+ * @param on_match Callback invoked for each matching line.
+ * @return Number of matching lines.
+ */
+std::size_t grepLogArchive(const std::filesystem::path& path,
+                           std::string_view needle,
+                           const std::function<void(const std::string&)>& on_match);
+
+// =====================================================================================================================
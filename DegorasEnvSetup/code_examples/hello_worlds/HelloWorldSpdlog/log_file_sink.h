@@ -0,0 +1,128 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldSpdlog – Local log files (daily or basic file sinks with archiving) and their location
+ *
+ *   Kept apart from spdlog_config.h so the collector only pulls the file sinks, not the MongoDB and metrics ones.
+ **********************************************************************************************************************/
+
+#pragma once
+
+// STD INCLUDES
+#include <filesystem>
+#include <memory>
+#include <string>
+
+// SPDLOG INCLUDES
+#include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/sinks/daily_file_sink.h>
+
+// PLATFORM-SPECIFIC
+#if defined(_WIN32)
+    #include <windows.h>
+#elif defined(__linux__)
+    #include <unistd.h>
+#endif
+
+// PROJECT INCLUDES
+#include "log_compressor.h"
+
+/**
+ * @brief Configuration of a local log file sink.
+ */
+struct LogFileSinkConfig
+{
+    /**
+     * @brief Default constructor initializing recommended values.
+     */
+    LogFileSinkConfig() noexcept :
+        file_path(std::string()),
+        log_pattern("[%Y-%m-%dT%H:%M:%S.%f][%P][%t][%^%L%$] %v"),
+        file_level(spdlog::level::debug),
+        use_daily_file(true),
+        compress_rotated(false),
+        archive_policy()
+    {}
+
+    std::string file_path;                       ///< Path to the log file (daily or basic sink).
+    std::string log_pattern;                     ///< Pattern for the logs.
+    spdlog::level::level_enum file_level;        ///< Minimum log level for the file sink.
+    bool use_daily_file;                         ///< Use daily_file_sink_mt (true) or basic_file_sink_mt (false).
+    bool compress_rotated;                       ///< Compress closed daily files in background (daily sink only).
+    LogArchivePolicy archive_policy;             ///< Compression level and retention for the daily archives.
+};
+
+/**
+ * @brief Create the file sink described by LogFileSinkConfig (daily or basic, with optional compression).
+ *
+ * @param cfg File sink configuration.
+ * @return spdlog::sink_ptr The configured file sink.
+ */
+inline spdlog::sink_ptr createFileSink(const LogFileSinkConfig& cfg)
+{
+    spdlog::sink_ptr file_sink;
+
+    if (cfg.use_daily_file)
+    {
+        // Hand every closed daily file to the background compressor.
+        spdlog::file_event_handlers handlers;
+        if (cfg.compress_rotated)
+        {
+            const LogArchivePolicy policy = cfg.archive_policy;
+            handlers.after_close = [policy](const spdlog::filename_t& filename)
+            {
+                LogCompressor::instance().enqueue(filename, policy);
+            };
+        }
+
+        auto daily_sink = std::make_shared<spdlog::sinks::daily_file_sink_mt>(
+            cfg.file_path, 0, 0, false, 0, handlers);
+
+        // Also archive the files left behind by previous runs.
+        if (cfg.compress_rotated)
+            LogCompressor::instance().enqueueStale(cfg.file_path, daily_sink->filename(), cfg.archive_policy);
+
+        file_sink = daily_sink;
+    }
+    else
+        file_sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(cfg.file_path, false);
+
+    // Configure the sink.
+    file_sink->set_pattern(cfg.log_pattern);
+    file_sink->set_level(cfg.file_level);
+    return file_sink;
+}
+
+/**
+ * @brief Get the directory of the running executable (the logs live in its `logs` subdirectory).
+ */
+inline std::filesystem::path getExecutableDir()
+{
+#if defined(_WIN32)
+    char buffer[MAX_PATH];
+    DWORD size = GetModuleFileNameA(nullptr, buffer, MAX_PATH);
+    if (size == 0 || size == MAX_PATH)
+        return std::filesystem::current_path();
+    return std::filesystem::path(buffer).parent_path();
+#elif defined(__linux__)
+    char buffer[4096];
+    ssize_t size = readlink("/proc/self/exe", buffer, sizeof(buffer)-1);
+    if (size <= 0)
+        return std::filesystem::current_path();
+    buffer[size] = '\0';
+    return std::filesystem::path(buffer).parent_path();
+#else
+    // Fallback for unknown platforms
+    return std::filesystem::current_path();
+#endif
+}
+
+// =====================================================================================================================
@@ -0,0 +1,67 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldSpdlog – Compile-time log level floors per component
+ *
+ *   The build defines the floors (see DP_LOG_ACTIVE_LEVEL and DP_LOG_COMPONENT_LEVELS in CMakeLists.txt):
+ *
+ *      SPDLOG_ACTIVE_LEVEL        Floor for spdlog's own SPDLOG_* macros.
+ *      DP_LOG_ACTIVE_LEVEL        Floor for the components without an explicit one (trace if undefined).
+ *      DP_LOG_LEVEL_<COMPONENT>   Floor for one component.
+ *
+ *   Calls below the floor of their component are discarded with `if constexpr`, so neither the arguments nor the
+ *   runtime level check are compiled in. Calls above the floor go through the normal runtime filtering of the
+ *   logger and its sinks (SpdlogLogConfig levels).
+ *
+ *   Each component must declare its default floor once, before use:
+ *
+ *      #ifndef DP_LOG_LEVEL_WORKER
+ *          #define DP_LOG_LEVEL_WORKER DP_LOG_ACTIVE_LEVEL
+ *      #endif
+ **********************************************************************************************************************/
+
+#pragma once
+
+// SPDLOG INCLUDES
+#include <spdlog/spdlog.h>
+
+#ifndef DP_LOG_ACTIVE_LEVEL
+    #define DP_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_TRACE
+#endif
+
+/**
+ * @brief Log through `logger` if `lvl` is not below the compile-time floor of `component`.
+ */
+#define DP_LOGGER_CALL(component, logger, lvl, ...)                                                                    \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if constexpr ((lvl) >= (DP_LOG_LEVEL_##component))                                                             \
+            (logger)->log(spdlog::source_loc{__FILE__, __LINE__, SPDLOG_FUNCTION},                                     \
+                          static_cast<spdlog::level::level_enum>(lvl), __VA_ARGS__);                                   \
+    } while (0)
+
+// Explicit logger.
+#define DP_LOGGER_TRACE(component, logger, ...) DP_LOGGER_CALL(component, logger, SPDLOG_LEVEL_TRACE, __VA_ARGS__)
+#define DP_LOGGER_DEBUG(component, logger, ...) DP_LOGGER_CALL(component, logger, SPDLOG_LEVEL_DEBUG, __VA_ARGS__)
+#define DP_LOGGER_INFO(component, logger, ...) DP_LOGGER_CALL(component, logger, SPDLOG_LEVEL_INFO, __VA_ARGS__)
+#define DP_LOGGER_WARN(component, logger, ...) DP_LOGGER_CALL(component, logger, SPDLOG_LEVEL_WARN, __VA_ARGS__)
+#define DP_LOGGER_ERROR(component, logger, ...) DP_LOGGER_CALL(component, logger, SPDLOG_LEVEL_ERROR, __VA_ARGS__)
+#define DP_LOGGER_CRITICAL(component, logger, ...) DP_LOGGER_CALL(component, logger, SPDLOG_LEVEL_CRITICAL, __VA_ARGS__)
+
+// Default logger.
+#define DP_TRACE(component, ...) DP_LOGGER_TRACE(component, spdlog::default_logger_raw(), __VA_ARGS__)
+#define DP_DEBUG(component, ...) DP_LOGGER_DEBUG(component, spdlog::default_logger_raw(), __VA_ARGS__)
+#define DP_INFO(component, ...) DP_LOGGER_INFO(component, spdlog::default_logger_raw(), __VA_ARGS__)
+#define DP_WARN(component, ...) DP_LOGGER_WARN(component, spdlog::default_logger_raw(), __VA_ARGS__)
+#define DP_ERROR(component, ...) DP_LOGGER_ERROR(component, spdlog::default_logger_raw(), __VA_ARGS__)
+#define DP_CRITICAL(component, ...) DP_LOGGER_CRITICAL(component, spdlog::default_logger_raw(), __VA_ARGS__)
+
+// =====================================================================================================================
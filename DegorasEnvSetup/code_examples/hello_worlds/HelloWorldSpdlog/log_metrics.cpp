@@ -0,0 +1,270 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// STD INCLUDES
+#include <algorithm>
+
+// SPDLOG INCLUDES
+#include <spdlog/spdlog.h>
+#include <spdlog/async.h>
+#include <spdlog/fmt/fmt.h>
+
+// PROJECT INCLUDES
+#include "log_metrics.h"
+
+namespace
+{
+
+/**
+ * @brief Nanoseconds elapsed since `start`.
+ */
+std::uint64_t elapsedNs(std::chrono::steady_clock::time_point start) noexcept
+{
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+/**
+ * @brief Mean of an accumulated value, zero if there are no samples.
+ */
+double mean(std::uint64_t total, std::uint64_t count) noexcept
+{
+    return count ? static_cast<double>(total) / static_cast<double>(count) : 0.0;
+}
+
+} // namespace
+
+// =====================================================================================================================
+// MeteredSink
+// =====================================================================================================================
+
+MeteredSink::MeteredSink(std::string logger_name, std::string sink_name, spdlog::sink_ptr inner) :
+    logger_name_(std::move(logger_name)),
+    sink_name_(std::move(sink_name)),
+    inner_(std::move(inner)),
+    records_(0),
+    write_ns_total_(0),
+    write_ns_max_(0),
+    flushes_(0),
+    flush_ns_total_(0),
+    flush_ns_max_(0)
+{
+    this->set_level(this->inner_->level());
+}
+
+void MeteredSink::log(const spdlog::details::log_msg& msg)
+{
+    const auto start = std::chrono::steady_clock::now();
+    this->inner_->log(msg);
+    const std::uint64_t ns = elapsedNs(start);
+
+    this->records_.fetch_add(1, std::memory_order_relaxed);
+    this->write_ns_total_.fetch_add(ns, std::memory_order_relaxed);
+    updateMax(this->write_ns_max_, ns);
+}
+
+void MeteredSink::flush()
+{
+    const auto start = std::chrono::steady_clock::now();
+    this->inner_->flush();
+    const std::uint64_t ns = elapsedNs(start);
+
+    this->flushes_.fetch_add(1, std::memory_order_relaxed);
+    this->flush_ns_total_.fetch_add(ns, std::memory_order_relaxed);
+    updateMax(this->flush_ns_max_, ns);
+}
+
+void MeteredSink::set_pattern(const std::string& pattern)
+{
+    this->inner_->set_pattern(pattern);
+}
+
+void MeteredSink::set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter)
+{
+    this->inner_->set_formatter(std::move(sink_formatter));
+}
+
+SinkMetricsSnapshot MeteredSink::snapshot() const
+{
+    SinkMetricsSnapshot snap;
+    snap.logger_name = this->logger_name_;
+    snap.sink_name = this->sink_name_;
+    snap.records = this->records_.load(std::memory_order_relaxed);
+    snap.write_ns_total = this->write_ns_total_.load(std::memory_order_relaxed);
+    snap.write_ns_max = this->write_ns_max_.load(std::memory_order_relaxed);
+    snap.flushes = this->flushes_.load(std::memory_order_relaxed);
+    snap.flush_ns_total = this->flush_ns_total_.load(std::memory_order_relaxed);
+    snap.flush_ns_max = this->flush_ns_max_.load(std::memory_order_relaxed);
+    return snap;
+}
+
+const spdlog::sink_ptr& MeteredSink::inner() const noexcept
+{
+    return this->inner_;
+}
+
+void MeteredSink::updateMax(std::atomic<std::uint64_t>& max, std::uint64_t value) noexcept
+{
+    // Almost always a single relaxed load: a new maximum is rare once warmed up.
+    std::uint64_t current = max.load(std::memory_order_relaxed);
+    while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {}
+}
+
+// =====================================================================================================================
+// LogMetrics
+// =====================================================================================================================
+
+LogMetrics& LogMetrics::instance()
+{
+    static LogMetrics metrics;
+    return metrics;
+}
+
+LogMetrics::LogMetrics() :
+    enabled_(false),
+    queue_capacity_(0),
+    report_stop_(false)
+{}
+
+LogMetrics::~LogMetrics()
+{
+    this->stopReport();
+}
+
+void LogMetrics::setEnabled(bool enabled) noexcept
+{
+    this->enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+bool LogMetrics::enabled() const noexcept
+{
+    return this->enabled_.load(std::memory_order_relaxed);
+}
+
+void LogMetrics::setQueueCapacity(std::size_t capacity) noexcept
+{
+    this->queue_capacity_.store(capacity, std::memory_order_relaxed);
+}
+
+spdlog::sink_ptr LogMetrics::attach(const std::string& logger_name, const std::string& sink_name,
+                                    spdlog::sink_ptr sink)
+{
+    if (!this->enabled() || !sink)
+        return sink;
+
+    auto metered = std::make_shared<MeteredSink>(logger_name, sink_name, std::move(sink));
+
+    std::lock_guard<std::mutex> lock(this->sinks_mtx_);
+    this->sinks_.erase(std::remove_if(this->sinks_.begin(), this->sinks_.end(),
+                                      [](const auto& weak) { return weak.expired(); }), this->sinks_.end());
+    this->sinks_.push_back(metered);
+    return metered;
+}
+
+LogMetricsSnapshot LogMetrics::snapshot()
+{
+    LogMetricsSnapshot snap;
+    snap.time = std::chrono::system_clock::now();
+    snap.queue_depth = 0;
+    snap.queue_capacity = this->queue_capacity_.load(std::memory_order_relaxed);
+    snap.overruns = 0;
+    snap.discards = 0;
+
+    if (auto pool = spdlog::thread_pool())
+    {
+        snap.queue_depth = pool->queue_size();
+        snap.overruns = pool->overrun_counter();
+#if SPDLOG_VERSION >= 11200
+        snap.discards = pool->discard_counter();
+#endif
+    }
+
+    std::lock_guard<std::mutex> lock(this->sinks_mtx_);
+    snap.sinks.reserve(this->sinks_.size());
+    for (const auto& weak : this->sinks_)
+    {
+        if (auto sink = weak.lock())
+            snap.sinks.push_back(sink->snapshot());
+    }
+    return snap;
+}
+
+std::vector<std::string> LogMetrics::format(const LogMetricsSnapshot& snap)
+{
+    std::vector<std::string> lines;
+    lines.reserve(snap.sinks.size() + 1);
+
+    lines.push_back(fmt::format("queue {}/{} overruns {} discards {}",
+                                snap.queue_depth, snap.queue_capacity, snap.overruns, snap.discards));
+
+    for (const auto& sink : snap.sinks)
+    {
+        lines.push_back(fmt::format(
+            "{}/{} records {} write avg {:.0f} ns max {} ns | flushes {} avg {:.0f} ns max {} ns",
+            sink.logger_name, sink.sink_name, sink.records, mean(sink.write_ns_total, sink.records), sink.write_ns_max,
+            sink.flushes, mean(sink.flush_ns_total, sink.flushes), sink.flush_ns_max));
+    }
+    return lines;
+}
+
+void LogMetrics::startReport(std::chrono::milliseconds interval, spdlog::sink_ptr report_sink)
+{
+    this->stopReport();
+    if (!report_sink || interval.count() <= 0)
+        return;
+
+    // Synchronous and not registered: spdlog::get() and the async queue never see it.
+    this->reporter_ = std::make_shared<spdlog::logger>("log_metrics", std::move(report_sink));
+    this->reporter_->set_pattern("[%Y-%m-%dT%H:%M:%S.%f][%P][metrics] %v");
+
+    {
+        std::lock_guard<std::mutex> lock(this->report_mtx_);
+        this->report_stop_ = false;
+    }
+    this->report_thread_ = std::thread(&LogMetrics::reportLoop, this, interval);
+}
+
+void LogMetrics::stopReport()
+{
+    if (!this->report_thread_.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(this->report_mtx_);
+        this->report_stop_ = true;
+    }
+    this->report_cv_.notify_all();
+    this->report_thread_.join();
+
+    this->report();
+    this->reporter_->flush();
+    this->reporter_.reset();
+}
+
+void LogMetrics::report()
+{
+    for (const auto& line : format(this->snapshot()))
+        this->reporter_->info(line);
+}
+
+void LogMetrics::reportLoop(std::chrono::milliseconds interval)
+{
+    std::unique_lock<std::mutex> lock(this->report_mtx_);
+    while (!this->report_cv_.wait_for(lock, interval, [this] { return this->report_stop_; }))
+    {
+        lock.unlock();
+        this->report();
+        this->reporter_->flush();
+        lock.lock();
+    }
+}
+
+// =====================================================================================================================
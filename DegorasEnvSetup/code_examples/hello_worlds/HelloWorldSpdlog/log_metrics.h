@@ -0,0 +1,187 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldSpdlog – Runtime metrics of the logging pipeline (queue, overruns, sink write and flush latency)
+ **********************************************************************************************************************/
+
+#pragma once
+
+// STD INCLUDES
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// SPDLOG INCLUDES
+#include <spdlog/logger.h>
+#include <spdlog/sinks/sink.h>
+
+/**
+ * @brief Point-in-time counters of one metered sink.
+ */
+struct SinkMetricsSnapshot
+{
+    std::string logger_name;        ///< Owning logger.
+    std::string sink_name;          ///< Sink name inside the logger (console, file, mongo, zmq...).
+    std::uint64_t records;          ///< Records written.
+    std::uint64_t write_ns_total;   ///< Accumulated write time, in nanoseconds.
+    std::uint64_t write_ns_max;     ///< Slowest write, in nanoseconds.
+    std::uint64_t flushes;          ///< Flushes done.
+    std::uint64_t flush_ns_total;   ///< Accumulated flush time, in nanoseconds.
+    std::uint64_t flush_ns_max;     ///< Slowest flush, in nanoseconds.
+};
+
+/**
+ * @brief Point-in-time state of the whole logging pipeline.
+ */
+struct LogMetricsSnapshot
+{
+    std::chrono::system_clock::time_point time;   ///< Snapshot time.
+    std::size_t queue_depth;                      ///< Records waiting in the global async queue.
+    std::size_t queue_capacity;                   ///< Capacity of the global async queue.
+    std::uint64_t overruns;                       ///< Records overwritten because the queue was full (overrun_oldest).
+    std::uint64_t discards;                       ///< Records discarded because the queue was full (discard_new).
+    std::vector<SinkMetricsSnapshot> sinks;       ///< Per logger, per sink counters.
+};
+
+/**
+ * @brief Sink decorator that times the writes and flushes of the wrapped sink.
+ *
+ * The cost is two steady clock reads and a few relaxed atomic updates per record. The level of the decorator is
+ * taken from the wrapped sink when constructed, so the wrapped sink must be configured first.
+ */
+class MeteredSink final : public spdlog::sinks::sink
+{
+public:
+
+    MeteredSink(std::string logger_name, std::string sink_name, spdlog::sink_ptr inner);
+
+    void log(const spdlog::details::log_msg& msg) override;
+
+    void flush() override;
+
+    void set_pattern(const std::string& pattern) override;
+
+    void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override;
+
+    /**
+     * @brief Read the counters (lock-free, can be called from any thread).
+     */
+    SinkMetricsSnapshot snapshot() const;
+
+    /**
+     * @brief Get the wrapped sink.
+     */
+    const spdlog::sink_ptr& inner() const noexcept;
+
+private:
+
+    static void updateMax(std::atomic<std::uint64_t>& max, std::uint64_t value) noexcept;
+
+    std::string logger_name_;
+    std::string sink_name_;
+    spdlog::sink_ptr inner_;
+    std::atomic<std::uint64_t> records_;
+    std::atomic<std::uint64_t> write_ns_total_;
+    std::atomic<std::uint64_t> write_ns_max_;
+    std::atomic<std::uint64_t> flushes_;
+    std::atomic<std::uint64_t> flush_ns_total_;
+    std::atomic<std::uint64_t> flush_ns_max_;
+};
+
+/**
+ * @brief Process-wide registry of the metered sinks, with an optional periodic self-report.
+ *
+ * The registry only keeps weak references, so it never extends the life of a sink (closing a daily file still
+ * triggers its compression). The self-report writes to its own private sink through an unregistered synchronous
+ * logger: it never goes through the async queue nor through any monitored logger, so it cannot recurse.
+ */
+class LogMetrics
+{
+public:
+
+    /**
+     * @brief Get the process-wide registry.
+     */
+    static LogMetrics& instance();
+
+    LogMetrics(const LogMetrics&) = delete;
+    LogMetrics& operator=(const LogMetrics&) = delete;
+
+    ~LogMetrics();
+
+    /**
+     * @brief Enable or disable the metering of the sinks created from now on.
+     */
+    void setEnabled(bool enabled) noexcept;
+
+    /**
+     * @brief Check if the new sinks must be metered.
+     */
+    bool enabled() const noexcept;
+
+    /**
+     * @brief Set the capacity of the global async queue, reported in the snapshots.
+     */
+    void setQueueCapacity(std::size_t capacity) noexcept;
+
+    /**
+     * @brief Wrap a sink into a MeteredSink and register it. Returns the sink unchanged if metering is disabled.
+     */
+    spdlog::sink_ptr attach(const std::string& logger_name, const std::string& sink_name, spdlog::sink_ptr sink);
+
+    /**
+     * @brief Take a snapshot of the global queue and of all the live metered sinks.
+     */
+    LogMetricsSnapshot snapshot();
+
+    /**
+     * @brief Format a snapshot as report lines (one for the queue, one per sink).
+     */
+    static std::vector<std::string> format(const LogMetricsSnapshot& snap);
+
+    /**
+     * @brief Start the periodic self-report.
+     * @param interval Time between reports.
+     * @param report_sink Private sink for the reports. It must not be used by any other logger.
+     */
+    void startReport(std::chrono::milliseconds interval, spdlog::sink_ptr report_sink);
+
+    /**
+     * @brief Write a last report and stop the periodic self-report.
+     */
+    void stopReport();
+
+private:
+
+    LogMetrics();
+
+    void report();
+
+    void reportLoop(std::chrono::milliseconds interval);
+
+    std::atomic_bool enabled_;
+    std::atomic<std::size_t> queue_capacity_;
+    std::mutex sinks_mtx_;
+    std::vector<std::weak_ptr<MeteredSink>> sinks_;
+    std::shared_ptr<spdlog::logger> reporter_;
+    std::mutex report_mtx_;
+    std::condition_variable report_cv_;
+    bool report_stop_;
+    std::thread report_thread_;
+};
+
+// =====================================================================================================================
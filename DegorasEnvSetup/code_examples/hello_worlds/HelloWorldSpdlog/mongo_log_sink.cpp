@@ -0,0 +1,271 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// STD INCLUDES
+#include <iostream>
+
+// SPDLOG INCLUDES
+#include <spdlog/sinks/basic_file_sink.h>
+
+// BSON INCLUDES
+#include <bson/bson.h>
+
+// MONGOC INCLUDES
+#include <mongoc/mongoc.h>
+
+// PROJECT INCLUDES
+#include "mongo_log_sink.h"
+
+namespace
+{
+
+// Server error code returned when the collection already exists.
+constexpr std::uint32_t kNamespaceExists = 48;
+
+/**
+ * @brief Append a string_view-like value as a UTF-8 field.
+ */
+template <typename S>
+void appendUtf8(bson_t* doc, const char* key, const S& value)
+{
+    bson_append_utf8(doc, key, -1, value.data(), static_cast<int>(value.size()));
+}
+
+/**
+ * @brief Convert a log record to its BSON document.
+ */
+void appendRecord(bson_t* doc, const spdlog::details::log_msg& msg)
+{
+    const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(msg.time.time_since_epoch()).count();
+    BSON_APPEND_DATE_TIME(doc, "ts", ms);
+
+    bson_t meta;
+    BSON_APPEND_DOCUMENT_BEGIN(doc, "meta", &meta);
+    appendUtf8(&meta, "logger", msg.logger_name);
+    appendUtf8(&meta, "level", spdlog::level::to_string_view(msg.level));
+    bson_append_document_end(doc, &meta);
+
+    BSON_APPEND_INT64(doc, "thread", static_cast<std::int64_t>(msg.thread_id));
+    appendUtf8(doc, "msg", msg.payload);
+
+    if (!msg.source.empty())
+    {
+        bson_t src;
+        BSON_APPEND_DOCUMENT_BEGIN(doc, "src", &src);
+        BSON_APPEND_UTF8(&src, "file", msg.source.filename);
+        BSON_APPEND_INT32(&src, "line", msg.source.line);
+        BSON_APPEND_UTF8(&src, "func", msg.source.funcname ? msg.source.funcname : "");
+        bson_append_document_end(doc, &src);
+    }
+}
+
+/**
+ * @brief Check if an error means that the server could not be reached.
+ */
+bool isConnectionError(const bson_error_t& error)
+{
+    return error.domain == MONGOC_ERROR_STREAM || error.domain == MONGOC_ERROR_SERVER_SELECTION;
+}
+
+} // namespace
+
+// =====================================================================================================================
+
+MongoLogSink::MongoLogSink(const MongoLogSinkConfig& cfg) :
+    cfg_(cfg),
+    client_(nullptr),
+    collection_(nullptr),
+    retry_at_()
+{
+    mongoc_init();
+    this->batch_.reserve(this->cfg_.batch_size);
+}
+
+MongoLogSink::~MongoLogSink()
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    this->writeBatch();
+    this->disconnect();
+}
+
+void MongoLogSink::sink_it_(const spdlog::details::log_msg& msg)
+{
+    // While the server is known to be down, skip the batch and go straight to the fallback.
+    if (!this->collection_ && std::chrono::steady_clock::now() < this->retry_at_)
+    {
+        this->writeFallback(msg);
+        return;
+    }
+
+    this->batch_.emplace_back(msg);
+    if (this->batch_.size() >= this->cfg_.batch_size)
+        this->writeBatch();
+}
+
+void MongoLogSink::flush_()
+{
+    this->writeBatch();
+    if (this->fallback_)
+        this->fallback_->flush();
+}
+
+bool MongoLogSink::connect()
+{
+    if (this->collection_)
+        return true;
+    if (std::chrono::steady_clock::now() < this->retry_at_)
+        return false;
+
+    bson_error_t error{};
+    mongoc_uri_t* uri = mongoc_uri_new_with_error(this->cfg_.uri.c_str(), &error);
+    if (!uri)
+    {
+        std::cerr << "[MongoLogSink] Invalid URI: " << error.message << std::endl;
+        this->retry_at_ = std::chrono::steady_clock::now() + this->cfg_.retry_interval;
+        return false;
+    }
+
+    mongoc_uri_set_option_as_int32(uri, MONGOC_URI_SERVERSELECTIONTIMEOUTMS,
+                                   static_cast<std::int32_t>(this->cfg_.server_timeout.count()));
+    this->client_ = mongoc_client_new_from_uri(uri);
+    mongoc_uri_destroy(uri);
+    mongoc_client_set_appname(this->client_, "degoras-spdlog-sink");
+
+    // Check that the server is reachable.
+    bson_t ping;
+    bson_init(&ping);
+    BSON_APPEND_INT32(&ping, "ping", 1);
+    const bool reachable = mongoc_client_command_simple(this->client_, "admin", &ping, nullptr, nullptr, &error);
+    bson_destroy(&ping);
+    if (!reachable)
+    {
+        std::cerr << "[MongoLogSink] Server unreachable, using fallback: " << error.message << std::endl;
+        this->disconnect();
+        this->retry_at_ = std::chrono::steady_clock::now() + this->cfg_.retry_interval;
+        return false;
+    }
+
+    // Create the collection with the requested kind (no-op if it already exists).
+    bson_t opts;
+    bson_init(&opts);
+    if (this->cfg_.collection_type == MongoLogCollection::Capped)
+    {
+        BSON_APPEND_BOOL(&opts, "capped", true);
+        BSON_APPEND_INT64(&opts, "size", this->cfg_.capped_size_bytes);
+    }
+    else
+    {
+        bson_t timeseries;
+        BSON_APPEND_DOCUMENT_BEGIN(&opts, "timeseries", &timeseries);
+        BSON_APPEND_UTF8(&timeseries, "timeField", "ts");
+        BSON_APPEND_UTF8(&timeseries, "metaField", "meta");
+        BSON_APPEND_UTF8(&timeseries, "granularity", "seconds");
+        bson_append_document_end(&opts, &timeseries);
+        BSON_APPEND_INT64(&opts, "expireAfterSeconds", this->cfg_.expire_after.count());
+    }
+
+    mongoc_database_t* db = mongoc_client_get_database(this->client_, this->cfg_.database.c_str());
+    mongoc_collection_t* created =
+        mongoc_database_create_collection(db, this->cfg_.collection.c_str(), &opts, &error);
+    if (created)
+        mongoc_collection_destroy(created);
+    else if (error.code != kNamespaceExists)
+        std::cerr << "[MongoLogSink] Cannot create collection: " << error.message << std::endl;
+    mongoc_database_destroy(db);
+    bson_destroy(&opts);
+
+    this->collection_ = mongoc_client_get_collection(
+        this->client_, this->cfg_.database.c_str(), this->cfg_.collection.c_str());
+    return true;
+}
+
+void MongoLogSink::disconnect()
+{
+    if (this->collection_)
+        mongoc_collection_destroy(this->collection_);
+    if (this->client_)
+        mongoc_client_destroy(this->client_);
+    this->collection_ = nullptr;
+    this->client_ = nullptr;
+}
+
+void MongoLogSink::writeBatch()
+{
+    if (this->batch_.empty())
+        return;
+
+    bool inserted = false;
+    if (this->connect())
+    {
+        // Build all the documents and write them with a single unordered bulk insert.
+        std::vector<bson_t*> docs;
+        docs.reserve(this->batch_.size());
+        for (const auto& msg : this->batch_)
+        {
+            bson_t* doc = bson_new();
+            appendRecord(doc, msg);
+            docs.push_back(doc);
+        }
+
+        bson_t opts;
+        bson_init(&opts);
+        BSON_APPEND_BOOL(&opts, "ordered", false);
+
+        bson_error_t error{};
+        inserted = mongoc_collection_insert_many(this->collection_, const_cast<const bson_t**>(docs.data()),
+                                                 docs.size(), &opts, nullptr, &error);
+        bson_destroy(&opts);
+        for (bson_t* doc : docs)
+            bson_destroy(doc);
+
+        if (!inserted)
+        {
+            std::cerr << "[MongoLogSink] Bulk insert failed: " << error.message << std::endl;
+            if (isConnectionError(error))
+            {
+                this->disconnect();
+                this->retry_at_ = std::chrono::steady_clock::now() + this->cfg_.retry_interval;
+            }
+        }
+    }
+
+    // Keep the records on disk if they did not reach the server.
+    if (!inserted)
+    {
+        for (const auto& msg : this->batch_)
+            this->writeFallback(msg);
+    }
+
+    this->batch_.clear();
+}
+
+void MongoLogSink::writeFallback(const spdlog::details::log_msg& msg)
+{
+    if (!this->fallback_)
+    {
+        if (this->cfg_.fallback_path.empty())
+            return;
+        try
+        {
+            this->fallback_ = std::make_unique<spdlog::sinks::basic_file_sink_st>(this->cfg_.fallback_path);
+            this->fallback_->set_formatter(this->formatter_->clone());
+        }
+        catch (const spdlog::spdlog_ex& ex)
+        {
+            std::cerr << "[MongoLogSink] Cannot open fallback file: " << ex.what() << std::endl;
+            this->cfg_.fallback_path.clear();
+            return;
+        }
+    }
+
+    this->fallback_->log(msg);
+}
+
+// =====================================================================================================================
@@ -0,0 +1,123 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldSpdlog – Batched MongoDB sink for spdlog
+ **********************************************************************************************************************/
+
+#pragma once
+
+// STD INCLUDES
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// SPDLOG INCLUDES
+#include <spdlog/sinks/base_sink.h>
+#include <spdlog/details/log_msg_buffer.h>
+
+// MONGOC FORWARD DECLARATIONS
+typedef struct _mongoc_client_t mongoc_client_t;
+typedef struct _mongoc_collection_t mongoc_collection_t;
+
+/**
+ * @brief Kind of collection created for the log documents when it does not exist yet.
+ */
+enum class MongoLogCollection
+{
+    Capped,     ///< Capped collection, oldest documents overwritten when the size limit is reached.
+    TimeSeries  ///< Time-series collection on `ts` with `meta` as metaField, expired by age.
+};
+
+/**
+ * @brief Configuration of the MongoDB log sink.
+ */
+struct MongoLogSinkConfig
+{
+    /**
+     * @brief Default constructor initializing recommended values.
+     */
+    MongoLogSinkConfig() noexcept :
+        uri("mongodb://localhost:27017"),
+        database("degoras_logs"),
+        collection("logs"),
+        collection_type(MongoLogCollection::TimeSeries),
+        capped_size_bytes(256ll * 1024ll * 1024ll),
+        expire_after(std::chrono::hours{24 * 30}),
+        batch_size(512),
+        server_timeout(std::chrono::milliseconds{1000}),
+        retry_interval(std::chrono::seconds{30}),
+        fallback_path(std::string())
+    {}
+
+    std::string uri;                            ///< MongoDB connection URI.
+    std::string database;                       ///< Database that holds the log collection.
+    std::string collection;                     ///< Log collection name.
+    MongoLogCollection collection_type;         ///< Collection kind created if it does not exist.
+    std::int64_t capped_size_bytes;             ///< Size limit of a capped collection.
+    std::chrono::seconds expire_after;          ///< Document lifetime in a time-series collection.
+    std::size_t batch_size;                     ///< Records buffered before a bulk insert (also on flush).
+    std::chrono::milliseconds server_timeout;   ///< Server selection timeout for each connection attempt.
+    std::chrono::seconds retry_interval;        ///< Time spent on the fallback before retrying the server.
+    std::string fallback_path;                  ///< Local file used while the server is unreachable (empty = drop).
+};
+
+/**
+ * @brief spdlog sink that stores the records as BSON documents in MongoDB using bulk inserts.
+ *
+ * Records are copied into a buffer and converted to BSON only when the batch is written, which happens when
+ * `batch_size` records are buffered or when the logger flushes (`flush_on` level or `flush_every`). With an async
+ * logger all of this runs on the spdlog worker thread.
+ *
+ * Each document has the form `{ts: Date, meta: {logger, level}, thread, msg[, src: {file, line, func}]}`.
+ *
+ * If the server cannot be reached the batch is written with the sink formatter to `fallback_path`, and the sink
+ * stays on the fallback for `retry_interval` before trying again, so an offline server costs one connection timeout
+ * per interval instead of one per batch.
+ *
+ * @note mongoc_init() is called by the constructor. The application may call mongoc_cleanup() once all the loggers
+ *       using this sink have been destroyed.
+ */
+class MongoLogSink final : public spdlog::sinks::base_sink<std::mutex>
+{
+public:
+
+    explicit MongoLogSink(const MongoLogSinkConfig& cfg);
+
+    ~MongoLogSink() override;
+
+protected:
+
+    void sink_it_(const spdlog::details::log_msg& msg) override;
+
+    void flush_() override;
+
+private:
+
+    bool connect();
+
+    void disconnect();
+
+    void writeBatch();
+
+    void writeFallback(const spdlog::details::log_msg& msg);
+
+    MongoLogSinkConfig cfg_;
+    mongoc_client_t* client_;
+    mongoc_collection_t* collection_;
+    std::chrono::steady_clock::time_point retry_at_;
+    std::vector<spdlog::details::log_msg_buffer> batch_;
+    std::unique_ptr<spdlog::sinks::sink> fallback_;
+};
+
+// =====================================================================================================================
@@ -0,0 +1,272 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldSpdlog – Logger configuration and setup shared by the example executables
+ **********************************************************************************************************************/
+
+#pragma once
+
+// STD INCLUDES
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+// SPDLOG INCLUDES
+#include <spdlog/spdlog.h>
+#include <spdlog/async.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+#include <spdlog/sinks/basic_file_sink.h>
+
+// PROJECT INCLUDES
+#include "log_compressor.h"
+#include "log_file_sink.h"
+#include "log_metrics.h"
+#include "mongo_log_sink.h"
+#include "thread_placement.h"
+#include "zmq_log_sink.h"
+
+/**
+ * @brief Global configuration for spdlog asynchronous logging.
+ *
+ * This structure holds settings that affect the shared async thread pool
+ * and the periodic flushing policy.
+ */
+struct SpdlogGlobalConfig
+{
+    /**
+     * @brief Default constructor initializing recommended values.
+     */
+    SpdlogGlobalConfig() noexcept :
+        queue_size(8192),
+        thread_count(1),
+        flush_interval(std::chrono::seconds{3}),
+        use_flush_every(true),
+        enable_metrics(false),
+        metrics_interval(std::chrono::seconds{60}),
+        metrics_path(std::string()),
+        pool_placement()
+    {}
+
+    std::size_t queue_size;                 ///< Global async thread pool queue size.
+    std::size_t thread_count;               ///< Global async thread pool worker thread count.
+    std::chrono::seconds flush_interval;    ///< Interval used for spdlog::flush_every().
+    bool use_flush_every;                   ///< Enable periodic flushing with flush_every().
+    bool enable_metrics;                    ///< Meter the sinks of the loggers registered from now on.
+    std::chrono::seconds metrics_interval;  ///< Interval of the metrics self-report (0 = no report).
+    std::string metrics_path;               ///< File of the metrics self-report (empty = stderr).
+    ThreadPlacement pool_placement;         ///< Name, cores and scheduling of the pool threads (name-N if several).
+};
+
+/**
+ * @brief Per-logger configuration for spdlog asynchronous loggers.
+ *
+ * This structure holds settings for each individual logger: sinks, levels
+ * and overflow policy.
+ */
+struct SpdlogLogConfig
+{
+    /**
+     * @brief Default constructor initializing recommended values.
+     */
+    SpdlogLogConfig() noexcept :
+        logger_name(std::string()),
+        file_path(std::string()),
+        log_pattern("[%Y-%m-%dT%H:%M:%S.%f][%P][%t][%^%L%$] %v"),
+        enable_console(true),
+        enable_file(false),
+        set_default(false),
+        console_level(spdlog::level::info),
+        file_level(spdlog::level::debug),
+        logger_level(spdlog::level::trace),
+        flush_on(spdlog::level::warn),
+        overflow_pol(spdlog::async_overflow_policy::overrun_oldest),
+        use_daily_file(true),
+        compress_rotated(false),
+        archive_policy(),
+        enable_mongo(false),
+        mongo_level(spdlog::level::info),
+        mongo_cfg(),
+        enable_zmq(false),
+        zmq_level(spdlog::level::trace),
+        zmq_cfg()
+    {}
+
+    std::string logger_name;                     ///< Logger name (used in spdlog registry).
+    std::string file_path;                       ///< Path to the log file (daily or basic sink).
+    std::string log_pattern;                     ///< Pattern for the logs.
+    bool enable_console;                         ///< Enable console sink.
+    bool enable_file;                            ///< Enable file sink.
+    bool set_default;                            ///< Set this logger as the global default logger.
+    spdlog::level::level_enum console_level;     ///< Minimum log level for console sink.
+    spdlog::level::level_enum file_level;        ///< Minimum log level for file sink.
+    spdlog::level::level_enum logger_level;      ///< Minimum log level accepted by the logger.
+    spdlog::level::level_enum flush_on;          ///< Force flush when log >= this level.
+    spdlog::async_overflow_policy overflow_pol;  ///< Overflow handling when queue is full.
+    bool use_daily_file;                         ///< Use daily_file_sink_mt (true) or basic_file_sink_mt (false).
+    bool compress_rotated;                       ///< Compress closed daily files in background (daily sink only).
+    LogArchivePolicy archive_policy;             ///< Compression level and retention for the daily archives.
+    bool enable_mongo;                           ///< Enable batched MongoDB sink.
+    spdlog::level::level_enum mongo_level;       ///< Minimum log level for MongoDB sink.
+    MongoLogSinkConfig mongo_cfg;                ///< MongoDB sink connection, collection and batching.
+    bool enable_zmq;                             ///< Enable ZeroMQ shipping sink (writes done by a collector).
+    spdlog::level::level_enum zmq_level;         ///< Minimum log level for ZeroMQ sink.
+    ZmqLogSinkConfig zmq_cfg;                    ///< ZeroMQ sink endpoint and socket options.
+};
+
+/**
+ * @brief Initialize global spdlog async thread pool and time behavior.
+ *
+ * @param cfg Global configuration for async logging.
+ */
+inline void initSpdlog(const SpdlogGlobalConfig& cfg)
+{
+    // Initialize global async thread pool, each worker placed from its start hook (before the first record).
+    if (cfg.pool_placement.isEmpty())
+        spdlog::init_thread_pool(cfg.queue_size, cfg.thread_count);
+    else
+    {
+        const ThreadPlacement placement = cfg.pool_placement;
+        const bool numbered = cfg.thread_count > 1 && !placement.name.empty();
+        auto started = std::make_shared<std::atomic<int>>(0);
+        spdlog::init_thread_pool(cfg.queue_size, cfg.thread_count, [placement, numbered, started]()
+        {
+            ThreadPlacement worker = placement;
+            if (numbered)
+                worker.name += "-" + std::to_string(started->fetch_add(1));
+            applyThreadPlacement(worker);
+        });
+    }
+    
+    // Optionally enable periodic flushing for all registered loggers.
+    if (cfg.use_flush_every)
+        spdlog::flush_every(cfg.flush_interval);
+
+    // Optionally meter the sinks and report the metrics through a private sink (never a monitored logger).
+    LogMetrics& metrics = LogMetrics::instance();
+    metrics.setEnabled(cfg.enable_metrics);
+    metrics.setQueueCapacity(cfg.queue_size);
+    if (cfg.enable_metrics && cfg.metrics_interval.count() > 0)
+    {
+        spdlog::sink_ptr report_sink;
+        if (cfg.metrics_path.empty())
+            report_sink = std::make_shared<spdlog::sinks::stderr_color_sink_st>();
+        else
+            report_sink = std::make_shared<spdlog::sinks::basic_file_sink_st>(cfg.metrics_path, false);
+        metrics.startReport(cfg.metrics_interval, report_sink);
+    }
+}
+
+/**
+ * @brief Create the file sink described by the file fields of SpdlogLogConfig.
+ *
+ * @param cfg Per-logger configuration structure.
+ * @return spdlog::sink_ptr The configured file sink.
+ */
+inline spdlog::sink_ptr createFileSink(const SpdlogLogConfig& cfg)
+{
+    LogFileSinkConfig file_cfg;
+    file_cfg.file_path = cfg.file_path;
+    file_cfg.log_pattern = cfg.log_pattern;
+    file_cfg.file_level = cfg.file_level;
+    file_cfg.use_daily_file = cfg.use_daily_file;
+    file_cfg.compress_rotated = cfg.compress_rotated;
+    file_cfg.archive_policy = cfg.archive_policy;
+    return createFileSink(file_cfg);
+}
+
+/**
+ * @brief Create and register an asynchronous spdlog logger using SpdlogLogConfig.
+ *
+ * Uses the global async thread pool initialized by initSpdlog().
+ *
+ * @param cfg Per-logger configuration structure.
+ * @return std::shared_ptr<spdlog::logger> The created logger, or nullptr if no sinks are enabled.
+ */
+inline std::shared_ptr<spdlog::logger> registerSpdlogLogger(const SpdlogLogConfig& cfg)
+{
+    // Container.
+    std::vector<spdlog::sink_ptr> sinks;
+    sinks.reserve(4);
+
+    // Console sink.
+    if (cfg.enable_console)
+    {
+        auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+        console_sink->set_pattern(cfg.log_pattern);
+        console_sink->set_level(cfg.console_level);
+        sinks.push_back(LogMetrics::instance().attach(cfg.logger_name, "console", console_sink));
+    }
+
+    // File sink.
+    if (cfg.enable_file)
+        sinks.push_back(LogMetrics::instance().attach(cfg.logger_name, "file", createFileSink(cfg)));
+
+    // MongoDB sink (the pattern is only used by its fallback file).
+    if (cfg.enable_mongo)
+    {
+        auto mongo_sink = std::make_shared<MongoLogSink>(cfg.mongo_cfg);
+        mongo_sink->set_pattern(cfg.log_pattern);
+        mongo_sink->set_level(cfg.mongo_level);
+        sinks.push_back(LogMetrics::instance().attach(cfg.logger_name, "mongo", mongo_sink));
+    }
+
+    // ZeroMQ sink (disk I/O moved to the collector process).
+    if (cfg.enable_zmq)
+    {
+        auto zmq_sink = std::make_shared<ZmqLogSink>(cfg.zmq_cfg);
+        zmq_sink->set_level(cfg.zmq_level);
+        sinks.push_back(LogMetrics::instance().attach(cfg.logger_name, "zmq", zmq_sink));
+    }
+
+    // If no sinks at all do NOT create logger.
+    if (sinks.empty())
+        return nullptr;
+
+    // Create async logger using the global thread pool.
+    auto logger = std::make_shared<spdlog::async_logger>(
+        cfg.logger_name,
+        sinks.begin(),
+        sinks.end(),
+        spdlog::thread_pool(),             
+        cfg.overflow_pol);
+
+    // Set the level and the flush on.
+    logger->set_level(cfg.logger_level);
+    logger->flush_on(cfg.flush_on);
+
+    // Register logger in spdlog registry.
+    spdlog::register_logger(logger);
+
+    // Optionally set as default logger.
+    if (cfg.set_default)
+        spdlog::set_default_logger(logger);
+
+    // Return the logger.
+    return logger;
+}
+
+/**
+ * @brief Write the last metrics report, flush and drop all the loggers, then wait for the pending log archives.
+ *
+ * Any logger handle kept outside the registry must be released before calling this function, otherwise its files
+ * are closed later and left uncompressed until the next run.
+ */
+inline void shutdownSpdlog()
+{
+    LogMetrics::instance().stopReport();
+    spdlog::shutdown();
+    LogCompressor::instance().stop();
+}
+
+// =====================================================================================================================
@@ -0,0 +1,279 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// STD INCLUDES
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+// SPDLOG INCLUDES
+#include <spdlog/details/os.h>
+
+// PROJECT INCLUDES
+#include "zmq_log_sink.h"
+
+namespace
+{
+
+// Poll period of the collector, bounds the time needed to stop it.
+constexpr std::chrono::milliseconds kCollectorPollPeriod{100};
+
+// Idle record buffers kept by a sink (the records in flight beyond it are allocated and deleted).
+constexpr std::size_t kMaxIdleBuffers = 4096;
+
+} // namespace
+
+ZmqLogPattern parseZmqLogPattern(std::string_view text)
+{
+    if (text == "push")
+        return ZmqLogPattern::Push;
+    if (text == "pub")
+        return ZmqLogPattern::Pub;
+    throw std::invalid_argument("Unknown ZeroMQ log pattern (push or pub): " + std::string(text));
+}
+
+// =====================================================================================================================
+// ZmqLogBufferPool
+// =====================================================================================================================
+
+ZmqLogBufferPool::ZmqLogBufferPool(std::size_t max_idle) :
+    max_idle_(max_idle),
+    allocated_(0)
+{
+    this->idle_.reserve(max_idle);
+}
+
+ZmqLogBufferPool::~ZmqLogBufferPool()
+{
+    for (Buffer* buffer : this->idle_)
+        delete buffer;
+}
+
+ZmqLogBufferPool::Buffer* ZmqLogBufferPool::acquire()
+{
+    Buffer* buffer = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        if (!this->idle_.empty())
+        {
+            buffer = this->idle_.back();
+            this->idle_.pop_back();
+        }
+    }
+    if (!buffer)
+    {
+        buffer = new Buffer();
+        this->allocated_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    buffer->data.clear();
+    buffer->pool = this->shared_from_this();
+    return buffer;
+}
+
+void ZmqLogBufferPool::release(void*, void* hint)
+{
+    auto* buffer = static_cast<Buffer*>(hint);
+
+    // The local reference keeps the pool alive until the buffer is stored (or deleted), even for the last record.
+    const std::shared_ptr<ZmqLogBufferPool> pool = std::move(buffer->pool);
+    pool->recycle(buffer);
+}
+
+std::uint64_t ZmqLogBufferPool::allocated() const noexcept
+{
+    return this->allocated_.load(std::memory_order_relaxed);
+}
+
+void ZmqLogBufferPool::recycle(Buffer* buffer)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        if (this->idle_.size() < this->max_idle_)
+        {
+            this->idle_.push_back(buffer);
+            return;
+        }
+    }
+    delete buffer;
+}
+
+// =====================================================================================================================
+// ZmqLogSink
+// =====================================================================================================================
+
+ZmqLogSink::ZmqLogSink(const ZmqLogSinkConfig& cfg) :
+    context_(cfg.context ? cfg.context : std::make_shared<zmq::context_t>(1)),
+    socket_(*this->context_, cfg.pattern == ZmqLogPattern::Push ? zmq::socket_type::push : zmq::socket_type::pub),
+    pool_(std::make_shared<ZmqLogBufferPool>(kMaxIdleBuffers)),
+    dropped_(0)
+{
+    this->socket_.set(zmq::sockopt::sndhwm, cfg.send_hwm);
+    if (cfg.pattern == ZmqLogPattern::Pub)
+        this->socket_.set(zmq::sockopt::xpub_nodrop, true);   // Full subscriber queue: EAGAIN, counted in dropped_.
+    this->socket_.set(zmq::sockopt::linger, static_cast<int>(cfg.linger.count()));
+    this->socket_.connect(cfg.endpoint);
+}
+
+std::uint64_t ZmqLogSink::dropped() const noexcept
+{
+    return this->dropped_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t ZmqLogSink::allocatedBuffers() const noexcept
+{
+    return this->pool_->allocated();
+}
+
+void ZmqLogSink::sink_it_(const spdlog::details::log_msg& msg)
+{
+    ZmqLogRecordHeader header{};
+    header.magic = kZmqLogMagic;
+    header.level = static_cast<std::int32_t>(msg.level);
+    header.time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(msg.time.time_since_epoch()).count();
+    header.thread_id = static_cast<std::uint64_t>(msg.thread_id);
+    header.pid = static_cast<std::uint32_t>(spdlog::details::os::pid());
+
+    // Serialize once into a pooled buffer, owned by ZeroMQ until it gives it back to the pool.
+    ZmqLogBufferPool::Buffer* buffer = this->pool_->acquire();
+    spdlog::memory_buf_t& data = buffer->data;
+    data.append(reinterpret_cast<const char*>(&header), reinterpret_cast<const char*>(&header) + sizeof(header));
+    data.append(msg.payload.data(), msg.payload.data() + msg.payload.size());
+
+    zmq::message_t name(msg.logger_name.data(), msg.logger_name.size());
+    zmq::message_t record(data.data(), data.size(), &ZmqLogBufferPool::release, buffer);
+
+    // Never block the logging thread. A multipart message is atomic: if the first frame is accepted, so is the rest.
+    if (!this->socket_.send(name, zmq::send_flags::sndmore | zmq::send_flags::dontwait))
+    {
+        this->dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    this->socket_.send(record, zmq::send_flags::dontwait);
+}
+
+void ZmqLogSink::flush_()
+{
+    // Records are handed to the ZeroMQ I/O thread as they arrive, the collector owns the flushing.
+}
+
+// =====================================================================================================================
+// ZmqLogCollector
+// =====================================================================================================================
+
+ZmqLogCollector::ZmqLogCollector(std::string endpoint, ZmqLogPattern pattern, SinkFactory factory,
+                                 std::shared_ptr<zmq::context_t> context) :
+    endpoint_(std::move(endpoint)),
+    pattern_(pattern),
+    factory_(std::move(factory)),
+    context_(context ? std::move(context) : std::make_shared<zmq::context_t>(1)),
+    socket_(*this->context_, pattern == ZmqLogPattern::Push ? zmq::socket_type::pull : zmq::socket_type::sub),
+    stop_req_(false),
+    received_(0)
+{}
+
+ZmqLogCollector::~ZmqLogCollector()
+{
+    this->stop();
+}
+
+void ZmqLogCollector::start()
+{
+    if (this->pattern_ == ZmqLogPattern::Pub)
+        this->socket_.set(zmq::sockopt::subscribe, "");
+    this->socket_.set(zmq::sockopt::rcvhwm, 0);
+    this->socket_.bind(this->endpoint_);
+
+    this->stop_req_.store(false);
+    this->worker_ = std::thread(&ZmqLogCollector::run, this);
+}
+
+void ZmqLogCollector::stop()
+{
+    this->stop_req_.store(true);
+    if (this->worker_.joinable())
+        this->worker_.join();
+
+    for (auto& [name, sink] : this->sinks_)
+        sink->flush();
+    this->sinks_.clear();
+}
+
+std::uint64_t ZmqLogCollector::received() const noexcept
+{
+    return this->received_.load(std::memory_order_relaxed);
+}
+
+void ZmqLogCollector::run()
+{
+    std::vector<zmq::pollitem_t> items{{this->socket_.handle(), 0, ZMQ_POLLIN, 0}};
+    zmq::message_t name;
+    zmq::message_t record;
+
+    while (!this->stop_req_.load(std::memory_order_relaxed))
+    {
+        zmq::poll(items, kCollectorPollPeriod);
+        if (!(items[0].revents & ZMQ_POLLIN))
+            continue;
+
+        // Drain everything available before polling again.
+        while (this->socket_.recv(name, zmq::recv_flags::dontwait))
+        {
+            if (!name.more() || !this->socket_.recv(record, zmq::recv_flags::none))
+                continue;
+            this->dispatch(name, record);
+        }
+    }
+
+    // Write what is still queued after the stop request.
+    while (this->socket_.recv(name, zmq::recv_flags::dontwait))
+    {
+        if (name.more() && this->socket_.recv(record, zmq::recv_flags::none))
+            this->dispatch(name, record);
+    }
+}
+
+void ZmqLogCollector::dispatch(const zmq::message_t& name, const zmq::message_t& record)
+{
+    if (record.size() < sizeof(ZmqLogRecordHeader))
+        return;
+
+    ZmqLogRecordHeader header;
+    std::memcpy(&header, record.data(), sizeof(header));
+    if (header.magic != kZmqLogMagic)
+        return;
+
+    const std::string_view logger_name(name.data<char>(), name.size());
+    auto it = this->sinks_.find(logger_name);
+    if (it == this->sinks_.end())
+    {
+        spdlog::sink_ptr sink = this->factory_ ? this->factory_(std::string(logger_name)) : nullptr;
+        if (!sink)
+            return;
+        it = this->sinks_.emplace(std::string(logger_name), std::move(sink)).first;
+    }
+
+    const auto level = static_cast<spdlog::level::level_enum>(header.level);
+    if (!it->second->should_log(level))
+        return;
+
+    const spdlog::log_clock::time_point time{
+        std::chrono::duration_cast<spdlog::log_clock::duration>(std::chrono::nanoseconds{header.time_ns})};
+    const spdlog::string_view_t payload(record.data<char>() + sizeof(header), record.size() - sizeof(header));
+
+    spdlog::details::log_msg msg(time, spdlog::source_loc{}, logger_name, level, payload);
+    msg.thread_id = static_cast<std::size_t>(header.thread_id);
+    it->second->log(msg);
+
+    this->received_.fetch_add(1, std::memory_order_relaxed);
+}
+
+// =====================================================================================================================
@@ -0,0 +1,249 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorldSpdlog – ZeroMQ log shipping (sink + collector)
+ *
+ *   Wire format, one multipart message per record:
+ *
+ *      Frame 0: logger name (also the topic for PUB/SUB prefix filtering).
+ *      Frame 1: ZmqLogRecordHeader followed by the raw message payload.
+ *
+ *   The format uses the native byte order, it is meant for local transports (ipc://, inproc://).
+ **********************************************************************************************************************/
+
+#pragma once
+
+// STD INCLUDES
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// SPDLOG INCLUDES
+#include <spdlog/sinks/base_sink.h>
+
+// ZMQ INCLUDES
+#include <zmq.hpp>
+
+/**
+ * @brief ZeroMQ socket pattern used to ship the records.
+ */
+enum class ZmqLogPattern
+{
+    Push,   ///< PUSH/PULL: one collector, the sink drops records when the send high-water mark is reached.
+    Pub     ///< PUB/SUB: any number of collectors, records are discarded uncounted when no one is listening.
+};
+
+/**
+ * @brief Fixed-size header of a shipped record.
+ */
+struct ZmqLogRecordHeader
+{
+    std::uint32_t magic;        ///< Always kZmqLogMagic.
+    std::int32_t level;         ///< spdlog::level::level_enum value.
+    std::int64_t time_ns;       ///< Record time, nanoseconds since the system clock epoch.
+    std::uint64_t thread_id;    ///< Producer thread id.
+    std::uint32_t pid;          ///< Producer process id.
+    std::uint32_t reserved;     ///< Padding, always zero.
+};
+
+constexpr std::uint32_t kZmqLogMagic = 0x474C5044; // "DPLG"
+
+/**
+ * @brief Parse a pattern name: push or pub. Throws std::invalid_argument if unknown.
+ */
+ZmqLogPattern parseZmqLogPattern(std::string_view text);
+
+/**
+ * @brief Serialized records handed to ZeroMQ, recycled once ZeroMQ releases them.
+ *
+ * ZeroMQ sends the buffers without copying them and gives them back from its I/O thread, so after the warm-up a record
+ * costs no heap allocation (a buffer only grows for a payload larger than any previous one). The pool is shared by
+ * the buffers in flight, it outlives the sink while the context still holds unsent records.
+ */
+class ZmqLogBufferPool : public std::enable_shared_from_this<ZmqLogBufferPool>
+{
+public:
+
+    /**
+     * @brief Serialized record and the pool it goes back to.
+     */
+    struct Buffer
+    {
+        spdlog::memory_buf_t data;
+        std::shared_ptr<ZmqLogBufferPool> pool;
+    };
+
+    /**
+     * @param max_idle Released buffers kept for reuse at most, the rest are deleted.
+     */
+    explicit ZmqLogBufferPool(std::size_t max_idle);
+
+    ZmqLogBufferPool(const ZmqLogBufferPool&) = delete;
+    ZmqLogBufferPool& operator=(const ZmqLogBufferPool&) = delete;
+
+    ~ZmqLogBufferPool();
+
+    /**
+     * @brief Empty buffer, reused if one is idle.
+     */
+    Buffer* acquire();
+
+    /**
+     * @brief ZeroMQ release callback of the record frames (the hint is the Buffer).
+     */
+    static void release(void* data, void* hint);
+
+    /**
+     * @brief Number of buffers allocated so far (stays flat once the pool is warm).
+     */
+    std::uint64_t allocated() const noexcept;
+
+private:
+
+    void recycle(Buffer* buffer);
+
+    std::mutex mutex_;
+    std::vector<Buffer*> idle_;
+    std::size_t max_idle_;
+    std::atomic<std::uint64_t> allocated_;
+};
+
+/**
+ * @brief Configuration of the ZeroMQ log sink.
+ */
+struct ZmqLogSinkConfig
+{
+    /**
+     * @brief Default constructor initializing recommended values.
+     */
+    ZmqLogSinkConfig() noexcept :
+        endpoint("ipc://degoras-logs.ipc"),
+        pattern(ZmqLogPattern::Push),
+        send_hwm(100000),
+        linger(std::chrono::milliseconds{1000}),
+        context(nullptr)
+    {}
+
+    std::string endpoint;                       ///< Collector endpoint (ipc://, inproc:// or tcp://).
+    ZmqLogPattern pattern;                      ///< Socket pattern (PUSH or PUB).
+    int send_hwm;                               ///< Send high-water mark, in records.
+    std::chrono::milliseconds linger;           ///< Time given to pending records when the sink is destroyed.
+    std::shared_ptr<zmq::context_t> context;    ///< Shared context (required for inproc://, created if null).
+};
+
+/**
+ * @brief spdlog sink that ships the records to a ZeroMQ collector instead of writing them locally.
+ *
+ * The header and the payload are copied once into a pooled buffer that ZeroMQ sends without copying (the logger name
+ * frame is copied, names up to 33 bytes are stored inline by ZeroMQ, without allocation), and sends never block:
+ * records that do not fit under the high-water mark are counted in dropped() and discarded (in PUB mode the socket
+ * uses ZMQ_XPUB_NODROP, so a full subscriber queue is reported instead of silently dropped). PUB records sent while no
+ * collector is subscribed are accepted and discarded by ZeroMQ, they are not counted.
+ */
+class ZmqLogSink final : public spdlog::sinks::base_sink<std::mutex>
+{
+public:
+
+    explicit ZmqLogSink(const ZmqLogSinkConfig& cfg);
+
+    ~ZmqLogSink() override = default;
+
+    /**
+     * @brief Number of records discarded because the socket was full (not the PUB records nobody subscribed to).
+     */
+    std::uint64_t dropped() const noexcept;
+
+    /**
+     * @brief Record buffers allocated so far (see ZmqLogBufferPool).
+     */
+    std::uint64_t allocatedBuffers() const noexcept;
+
+protected:
+
+    void sink_it_(const spdlog::details::log_msg& msg) override;
+
+    void flush_() override;
+
+private:
+
+    std::shared_ptr<zmq::context_t> context_;
+    zmq::socket_t socket_;
+    std::shared_ptr<ZmqLogBufferPool> pool_;
+    std::atomic<std::uint64_t> dropped_;
+};
+
+/**
+ * @brief Receives records shipped by ZmqLogSink and writes them to local sinks.
+ *
+ * The collector binds the endpoint (producers connect to it) and runs its own receive thread. Each logger name gets
+ * its own sink, created on first use by the sink factory, so the usual daily file sinks can be plugged in.
+ */
+class ZmqLogCollector
+{
+public:
+
+    using SinkFactory = std::function<spdlog::sink_ptr(const std::string& logger_name)>;
+
+    /**
+     * @param endpoint Endpoint to bind (ipc://, inproc:// or tcp://).
+     * @param pattern Socket pattern, must match the producers.
+     * @param factory Creates the sink for a new logger name.
+     * @param context Shared context (required for inproc://, created if null).
+     */
+    ZmqLogCollector(std::string endpoint, ZmqLogPattern pattern, SinkFactory factory,
+                    std::shared_ptr<zmq::context_t> context = nullptr);
+
+    ZmqLogCollector(const ZmqLogCollector&) = delete;
+    ZmqLogCollector& operator=(const ZmqLogCollector&) = delete;
+
+    ~ZmqLogCollector();
+
+    /**
+     * @brief Bind the socket and start the receive thread.
+     */
+    void start();
+
+    /**
+     * @brief Stop the receive thread, flush and release the sinks.
+     */
+    void stop();
+
+    /**
+     * @brief Number of records written so far.
+     */
+    std::uint64_t received() const noexcept;
+
+private:
+
+    void run();
+
+    void dispatch(const zmq::message_t& name, const zmq::message_t& record);
+
+    std::string endpoint_;
+    ZmqLogPattern pattern_;
+    SinkFactory factory_;
+    std::shared_ptr<zmq::context_t> context_;
+    zmq::socket_t socket_;
+    std::map<std::string, spdlog::sink_ptr, std::less<>> sinks_;
+    std::atomic_bool stop_req_;
+    std::atomic<std::uint64_t> received_;
+    std::thread worker_;
+};
+
+// =====================================================================================================================
@@ -0,0 +1,104 @@
+# ======================================================================================================================
+#  Copyright (C) 2025 Degoras Project Team
+#
+#  Authors:
+#
+#      Ángel Vera Herrera       <avera@roa.es> | <angelvh.engr@gmail.com>
+#      Jesús Relinque Madroñal
+#
+#  Licensed under the MIT License.
+# ======================================================================================================================
+
+# ======================================================================================================================
+#   HELLO WORLDS COMMON - LINK-TIME AND PROFILE-GUIDED OPTIMIZATION
+#
+#   Included by the examples right after project(). Applies to all the targets defined afterwards in the including
+#   directory and its subdirectories. The body runs once per configure (include_guard(GLOBAL)): in the Benchmarks tree
+#   it runs from the top-level project, before the examples are added, and their own includes do nothing (they inherit
+#   the settings as subdirectories).
+#
+#   DP_LTO              Link-time optimization of the non Debug builds (the release presets enable it).
+#   DP_PGO              OFF, GENERATE (instrumented binaries write profiles when they exit) or USE.
+#   DP_PGO_PROFILE_DIR  Profiles written by GENERATE and read by USE.
+#
+#   GCC names the profiles after the object files, so GENERATE and USE must share the build directory (the
+#   *-pgo-gen and *-pgo-use presets of the Benchmarks project do).
+# ======================================================================================================================
+
+include_guard(GLOBAL)
+
+# ----------------------------------------------------------------------------------------------------------------------
+# OPTIONS
+
+option(DP_LTO "Link-time optimization of the non Debug builds." OFF)
+
+set(DP_PGO "OFF" CACHE STRING "Profile-guided optimization step: OFF, GENERATE or USE.")
+set_property(CACHE DP_PGO PROPERTY STRINGS OFF GENERATE USE)
+
+set(DP_PGO_PROFILE_DIR "${CMAKE_BINARY_DIR}/pgo_profiles" CACHE PATH "Profiles of the profile-guided optimization.")
+
+if (NOT DP_PGO MATCHES "^(OFF|GENERATE|USE)$")
+    message(FATAL_ERROR "DP_PGO must be OFF, GENERATE or USE (got \"${DP_PGO}\").")
+endif()
+
+if (NOT CMAKE_CXX_COMPILER_ID STREQUAL "GNU" AND (DP_LTO OR NOT DP_PGO STREQUAL "OFF"))
+    message(FATAL_ERROR "DP_LTO and DP_PGO are only supported with GCC.")
+endif()
+
+# Optimization applied, reported in the machine metadata of the benchmark results.
+set(_dp_optimization "")
+
+# ----------------------------------------------------------------------------------------------------------------------
+# LINK-TIME OPTIMIZATION
+
+if (DP_LTO AND NOT CMAKE_BUILD_TYPE STREQUAL "Debug")
+
+    # The GCC LTO objects are read through the linker plugin, which lld does not load. Use the GNU linker instead.
+    foreach (_dp_flags CMAKE_EXE_LINKER_FLAGS CMAKE_SHARED_LINKER_FLAGS)
+        if (${_dp_flags} MATCHES "-fuse-ld=lld")
+            string(REPLACE "-fuse-ld=lld" "-fuse-ld=bfd" ${_dp_flags} "${${_dp_flags}}")
+            message(STATUS "DP_LTO: -fuse-ld=lld replaced by -fuse-ld=bfd in ${_dp_flags} (GCC LTO plugin).")
+        endif()
+    endforeach()
+
+    include(CheckIPOSupported)
+    check_ipo_supported(RESULT _dp_ipo_supported OUTPUT _dp_ipo_output LANGUAGES CXX)
+    if (NOT _dp_ipo_supported)
+        message(FATAL_ERROR "DP_LTO: link-time optimization not supported: ${_dp_ipo_output}")
+    endif()
+
+    # Initializes INTERPROCEDURAL_OPTIMIZATION of every target created from now on (-flto=auto).
+    set(CMAKE_INTERPROCEDURAL_OPTIMIZATION ON)
+    list(APPEND _dp_optimization "LTO")
+
+endif()
+
+# ----------------------------------------------------------------------------------------------------------------------
+# PROFILE-GUIDED OPTIMIZATION
+
+if (DP_PGO STREQUAL "GENERATE")
+
+    # Atomic counters: the benchmarks and the examples are multithreaded.
+    add_compile_options(-fprofile-generate=${DP_PGO_PROFILE_DIR} -fprofile-update=atomic)
+    add_link_options(-fprofile-generate=${DP_PGO_PROFILE_DIR})
+    list(APPEND _dp_optimization "PGO instrumented")
+
+elseif (DP_PGO STREQUAL "USE")
+
+    if (NOT EXISTS ${DP_PGO_PROFILE_DIR})
+        message(WARNING "DP_PGO: no profiles in ${DP_PGO_PROFILE_DIR}, run the training (DP_PGO=GENERATE) first.")
+    endif()
+
+    # Functions never run by the training keep the regular optimization instead of being optimized for size.
+    add_compile_options(-fprofile-use=${DP_PGO_PROFILE_DIR} -fprofile-partial-training -Wno-missing-profile)
+    add_link_options(-fprofile-use=${DP_PGO_PROFILE_DIR})
+    list(APPEND _dp_optimization "PGO")
+
+endif()
+
+if (_dp_optimization)
+    list(JOIN _dp_optimization " + " _dp_optimization)
+    add_compile_definitions("DP_BUILD_OPTIMIZATION=\"${_dp_optimization}\"")
+endif()
+
+# ==================================================================================================
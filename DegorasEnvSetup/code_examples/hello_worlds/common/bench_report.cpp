@@ -0,0 +1,257 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <thread>
+
+#ifndef _WIN32
+#include <sys/utsname.h>
+#include <unistd.h>
+#endif
+
+// PROJECT INCLUDES
+#include "bench_report.h"
+
+namespace
+{
+
+/**
+ * @brief JSON string literal of a text (quotes included).
+ */
+std::string jsonString(const std::string& text)
+{
+    std::ostringstream out;
+    out << '"';
+    for (const char c : text)
+    {
+        switch (c)
+        {
+        case '"':  out << "\\\""; break;
+        case '\\': out << "\\\\"; break;
+        case '\n': out << "\\n"; break;
+        case '\r': out << "\\r"; break;
+        case '\t': out << "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+                out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+            else
+                out << c;
+        }
+    }
+    out << '"';
+    return out.str();
+}
+
+const char* betterName(BenchBetter better)
+{
+    switch (better)
+    {
+    case BenchBetter::Lower:  return "lower";
+    case BenchBetter::Higher: return "higher";
+    case BenchBetter::None:   return "none";
+    }
+    return "none";
+}
+
+#ifdef _WIN32
+std::string environment(const char* name)
+{
+    const char* value = std::getenv(name);
+    return value ? value : "";
+}
+#endif
+
+std::string cpuModel()
+{
+#ifdef _WIN32
+    return environment("PROCESSOR_IDENTIFIER");
+#else
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line))
+    {
+        if (line.rfind("model name", 0) == 0)
+        {
+            const std::size_t colon = line.find(':');
+            return colon == std::string::npos ? std::string() : line.substr(line.find_first_not_of(' ', colon + 1));
+        }
+    }
+    return "";
+#endif
+}
+
+std::string utcTimestamp()
+{
+    const std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::tm utc{};
+#ifdef _WIN32
+    gmtime_s(&utc, &now);
+#else
+    gmtime_r(&now, &utc);
+#endif
+    char text[32];
+    std::strftime(text, sizeof(text), "%Y-%m-%dT%H:%M:%SZ", &utc);
+    return text;
+}
+
+} // namespace
+
+// =====================================================================================================================
+
+BenchReport& BenchReport::instance()
+{
+    static BenchReport report;
+    return report;
+}
+
+void BenchReport::setSuite(const std::string& suite)
+{
+    this->suite_ = suite;
+}
+
+void BenchReport::beginSection(const std::string& section)
+{
+    this->section_ = section;
+}
+
+void BenchReport::add(const std::string& name, double value, const std::string& unit)
+{
+    this->add(name, value, unit, BenchReport::betterFromUnit(unit));
+}
+
+void BenchReport::add(const std::string& name, double value, const std::string& unit, BenchBetter better)
+{
+    // Keep the keys of a section unique (a result printed twice gets a suffix).
+    std::string key = name;
+    for (int n = 2; std::any_of(this->results_.begin(), this->results_.end(), [&](const BenchResult& result)
+                    {
+                        return result.section == this->section_ && result.name == key;
+                    }); ++n)
+    {
+        key = name + " (" + std::to_string(n) + ")";
+    }
+    this->results_.push_back({this->section_, key, value, unit, better});
+}
+
+const std::vector<BenchResult>& BenchReport::results() const noexcept
+{
+    return this->results_;
+}
+
+BenchBetter BenchReport::betterFromUnit(const std::string& unit)
+{
+    if (unit == "x" || (unit.size() > 2 && unit.compare(unit.size() - 2, 2, "/s") == 0))
+        return BenchBetter::Higher;
+
+    const std::string base = unit.substr(0, unit.find('/'));
+    if (base == "ns" || base == "us" || base == "ms" || base == "s" || unit == "%")
+        return BenchBetter::Lower;
+
+    return BenchBetter::None;
+}
+
+std::vector<std::pair<std::string, std::string>> BenchReport::machineInfo()
+{
+    std::vector<std::pair<std::string, std::string>> info;
+
+#ifdef _WIN32
+    info.emplace_back("host", environment("COMPUTERNAME"));
+    info.emplace_back("os", "Windows");
+#else
+    char host[256] = {};
+    gethostname(host, sizeof(host) - 1);
+    info.emplace_back("host", host);
+    utsname system{};
+    if (uname(&system) == 0)
+        info.emplace_back("os", std::string(system.sysname) + " " + system.release + " " + system.machine);
+#endif
+
+    info.emplace_back("cpu", cpuModel());
+    info.emplace_back("logical_cores", std::to_string(std::thread::hardware_concurrency()));
+
+#if defined(__clang__)
+    info.emplace_back("compiler", std::string("Clang ") + __clang_version__);
+#elif defined(__GNUC__)
+    info.emplace_back("compiler", std::string("GCC ") + __VERSION__);
+#elif defined(_MSC_VER)
+    info.emplace_back("compiler", "MSVC " + std::to_string(_MSC_VER));
+#endif
+
+#ifdef NDEBUG
+    info.emplace_back("build_type", "Release");
+#else
+    info.emplace_back("build_type", "Debug");
+#endif
+
+    // LTO / PGO of the build (common/DegorasOptimization.cmake), "none" for the plain -O3 builds.
+#ifdef DP_BUILD_OPTIMIZATION
+    info.emplace_back("optimization", DP_BUILD_OPTIMIZATION);
+#else
+    info.emplace_back("optimization", "none");
+#endif
+
+    return info;
+}
+
+bool BenchReport::writeJson(const std::string& path) const
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file)
+    {
+        std::cerr << "[BenchReport] Cannot write " << path << std::endl;
+        return false;
+    }
+
+    file << std::setprecision(std::numeric_limits<double>::max_digits10);
+    file << "{\n";
+    file << "  \"format\": 1,\n";
+    file << "  \"suite\": " << jsonString(this->suite_) << ",\n";
+    file << "  \"timestamp\": " << jsonString(utcTimestamp()) << ",\n";
+    file << "  \"machine\": {";
+    const auto machine = BenchReport::machineInfo();
+    for (std::size_t i = 0; i < machine.size(); ++i)
+        file << (i ? ",\n" : "\n") << "    " << jsonString(machine[i].first) << ": " << jsonString(machine[i].second);
+    file << "\n  },\n";
+    file << "  \"results\": [";
+    for (std::size_t i = 0; i < this->results_.size(); ++i)
+    {
+        const BenchResult& result = this->results_[i];
+        // JSON has no NaN or infinity.
+        const bool finite = std::isfinite(result.value);
+        file << (i ? ",\n" : "\n") << "    { \"section\": " << jsonString(result.section)
+             << ", \"name\": " << jsonString(result.name) << ", \"value\": ";
+        if (finite)
+            file << result.value;
+        else
+            file << "null";
+        file << ", \"unit\": " << jsonString(result.unit) << ", \"better\": \"" << betterName(result.better) << "\" }";
+    }
+    file << "\n  ]\n}\n";
+
+    file.flush();
+    if (!file)
+    {
+        std::cerr << "[BenchReport] Error writing " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// =====================================================================================================================
@@ -0,0 +1,107 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorlds Common – Benchmark results collector with JSON output (machine readable runs)
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Direction in which a benchmark value improves (used when comparing two runs).
+ */
+enum class BenchBetter
+{
+    Lower,     ///< Times, per-item costs, overheads.
+    Higher,    ///< Rates and speedups.
+    None       ///< Counters and other informative values, never a regression.
+};
+
+/**
+ * @brief One benchmark value.
+ */
+struct BenchResult
+{
+    std::string section;   ///< Group of results (the "[...]" header of the console output).
+    std::string name;      ///< Result name, unique within its section.
+    double value;          ///< Measured value.
+    std::string unit;      ///< Unit as printed.
+    BenchBetter better;    ///< Improvement direction.
+};
+
+/**
+ * @brief Process-wide collector of the results of a Bench_* executable.
+ *
+ * The benchmarks keep printing their tables and also add each value here. writeJson() stores the results with the
+ * machine metadata (host, OS, CPU, compiler, build type, LTO / PGO) in the format read by bench_compare:
+ *
+ *     { "format": 1, "suite": "...", "timestamp": "...", "machine": { ... }, "results": [ { "section": "...",
+ *       "name": "...", "value": 1.0, "unit": "ms", "better": "lower" }, ... ] }
+ */
+class BenchReport
+{
+public:
+
+    /**
+     * @brief The collector of this process.
+     */
+    static BenchReport& instance();
+
+    /**
+     * @brief Name of the suite (usually the example name, e.g. "HelloWorldQwt").
+     */
+    void setSuite(const std::string& suite);
+
+    /**
+     * @brief Section of the results added from now on.
+     */
+    void beginSection(const std::string& section);
+
+    /**
+     * @brief Add a value whose direction is deduced from the unit (see betterFromUnit()).
+     */
+    void add(const std::string& name, double value, const std::string& unit);
+
+    void add(const std::string& name, double value, const std::string& unit, BenchBetter better);
+
+    const std::vector<BenchResult>& results() const noexcept;
+
+    /**
+     * @brief Lower for times (ns, us, ms, s, per-item variants) and percentages, Higher for rates (".../s") and
+     *        factors ("x"), None for the rest.
+     */
+    static BenchBetter betterFromUnit(const std::string& unit);
+
+    /**
+     * @brief Host, OS, CPU, logical cores, compiler, build type and LTO / PGO of this run.
+     */
+    static std::vector<std::pair<std::string, std::string>> machineInfo();
+
+    /**
+     * @brief Write the suite, metadata and results as JSON.
+     * @return False (and an error in std::cerr) if the file cannot be written.
+     */
+    bool writeJson(const std::string& path) const;
+
+private:
+
+    BenchReport() = default;
+
+    std::string suite_;
+    std::string section_;
+    std::vector<BenchResult> results_;
+};
+
+// =====================================================================================================================
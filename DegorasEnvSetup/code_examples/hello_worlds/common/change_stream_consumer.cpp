@@ -0,0 +1,378 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <algorithm>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+
+// BSONCXX INCLUDES
+#include <bsoncxx/json.hpp>
+#include <bsoncxx/types.hpp>
+
+// MONGOCXX INCLUDES
+#include <mongocxx/change_stream.hpp>
+#include <mongocxx/client.hpp>
+#include <mongocxx/options/change_stream.hpp>
+#include <mongocxx/pipeline.hpp>
+#include <mongocxx/uri.hpp>
+
+// PROJECT INCLUDES
+#include "change_stream_consumer.h"
+
+// =====================================================================================================================
+
+ChangeStreamConsumer::ChangeStreamConsumer(const ChangeStreamConfig& config) :
+    config_(config),
+    queued_events_(0),
+    token_dirty_(false),
+    stop_req_(false),
+    watching_(false),
+    running_(false),
+    received_(0),
+    delivered_(0),
+    batches_(0),
+    backpressure_waits_(0),
+    backpressure_ns_(0),
+    restarts_(0)
+{
+    this->config_.batch_size = std::max<std::size_t>(this->config_.batch_size, 1);
+    this->config_.max_queued_events = std::max(this->config_.max_queued_events, this->config_.batch_size);
+}
+
+ChangeStreamConsumer::~ChangeStreamConsumer()
+{
+    this->stop();
+}
+
+void ChangeStreamConsumer::setNotifier(std::function<void()> notifier)
+{
+    this->notifier_ = std::move(notifier);
+}
+
+void ChangeStreamConsumer::start()
+{
+    if (this->worker_.joinable())
+        return;
+
+    // Resume after the last batch drained by a previous run.
+    if (!this->config_.resume_token_path.empty() && std::filesystem::exists(this->config_.resume_token_path))
+    {
+        std::ifstream file(this->config_.resume_token_path);
+        std::stringstream json;
+        json << file.rdbuf();
+        try
+        {
+            this->read_token_.emplace(bsoncxx::from_json(json.str()));
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "[ChangeStreamConsumer] Ignoring the resume token in " << this->config_.resume_token_path
+                      << ": " << e.what() << std::endl;
+        }
+    }
+
+    this->stop_req_.store(false);
+    this->running_.store(true);
+    this->worker_ = std::thread(&ChangeStreamConsumer::run, this);
+}
+
+void ChangeStreamConsumer::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->stop_req_.store(true);
+    }
+    this->space_cv_.notify_all();
+    if (this->worker_.joinable())
+        this->worker_.join();
+
+    std::lock_guard<std::mutex> lock(this->token_mutex_);
+    this->saveToken(true);
+}
+
+std::size_t ChangeStreamConsumer::drain(std::vector<ChangeEvent>& events, std::size_t max_events)
+{
+    std::optional<bsoncxx::document::value> token;
+    std::size_t moved = 0;
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        while (!this->queue_.empty() && (moved == 0 || moved + this->queue_.front().events.size() <= max_events))
+        {
+            Batch& batch = this->queue_.front();
+            moved += batch.events.size();
+            std::move(batch.events.begin(), batch.events.end(), std::back_inserter(events));
+            if (batch.resume_token)
+                token = std::move(batch.resume_token);
+            this->queue_.pop_front();
+        }
+        this->queued_events_ -= moved;
+    }
+
+    if (moved == 0)
+        return 0;
+
+    this->space_cv_.notify_one();
+    this->delivered_.fetch_add(moved, std::memory_order_relaxed);
+    if (token)
+    {
+        std::lock_guard<std::mutex> lock(this->token_mutex_);
+        this->commitToken(std::move(*token));
+    }
+    return moved;
+}
+
+bool ChangeStreamConsumer::isWatching() const noexcept
+{
+    return this->watching_.load();
+}
+
+bool ChangeStreamConsumer::isRunning() const noexcept
+{
+    return this->running_.load();
+}
+
+std::string ChangeStreamConsumer::lastError() const
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    return this->last_error_;
+}
+
+std::uint64_t ChangeStreamConsumer::received() const noexcept
+{
+    return this->received_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t ChangeStreamConsumer::delivered() const noexcept
+{
+    return this->delivered_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t ChangeStreamConsumer::batches() const noexcept
+{
+    return this->batches_.load(std::memory_order_relaxed);
+}
+
+std::size_t ChangeStreamConsumer::queued() const noexcept
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    return this->queued_events_;
+}
+
+std::uint64_t ChangeStreamConsumer::backpressureWaits() const noexcept
+{
+    return this->backpressure_waits_.load(std::memory_order_relaxed);
+}
+
+std::int64_t ChangeStreamConsumer::backpressureNs() const noexcept
+{
+    return this->backpressure_ns_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t ChangeStreamConsumer::restarts() const noexcept
+{
+    return this->restarts_.load(std::memory_order_relaxed);
+}
+
+std::int64_t ChangeStreamConsumer::nowNs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void ChangeStreamConsumer::run()
+{
+    // The pipeline is parsed once, a bad one is not retried.
+    mongocxx::pipeline pipeline;
+    try
+    {
+        const bsoncxx::document::value stages = bsoncxx::from_json("{\"stages\": " + this->config_.pipeline + "}");
+        pipeline.append_stages(stages.view()["stages"].get_array().value);
+    }
+    catch (const std::exception& e)
+    {
+        this->fail(std::string("Invalid pipeline: ") + e.what());
+        this->running_.store(false);
+        return;
+    }
+
+    // The partial batch survives a reopen (its events are before the resume token).
+    Batch batch;
+    batch.events.reserve(this->config_.batch_size);
+    std::int64_t batch_start_ns = 0;
+    int failures = 0;
+    while (!this->stop_req_.load())
+    {
+        try
+        {
+            mongocxx::client client{mongocxx::uri{this->config_.uri}};
+            mongocxx::collection collection = client[this->config_.database][this->config_.collection];
+
+            mongocxx::options::change_stream options;
+            options.batch_size(static_cast<std::int32_t>(this->config_.batch_size));
+            options.max_await_time(this->config_.max_await_time);
+            if (this->config_.update_lookup)
+                options.full_document("updateLookup");
+            if (this->read_token_)
+                options.resume_after(this->read_token_->view());
+
+            mongocxx::change_stream stream = collection.watch(pipeline, options);
+            this->watching_.store(true);
+            failures = 0;
+
+            while (!this->stop_req_.load())
+            {
+                // The loop ends when no event arrives within max_await_time.
+                for (const bsoncxx::document::view& event : stream)
+                {
+                    const std::int64_t now_ns = ChangeStreamConsumer::nowNs();
+                    if (batch.events.empty())
+                        batch_start_ns = now_ns;
+
+                    ChangeEvent change;
+                    const auto operation = event["operationType"].get_string().value;
+                    change.operation.assign(operation.data(), operation.size());
+                    const bsoncxx::document::element document = event["fullDocument"];
+                    if (document && document.type() == bsoncxx::type::k_document)
+                        change.document.emplace(document.get_document().value);
+                    change.received_ns = now_ns;
+                    batch.events.push_back(std::move(change));
+                    this->read_token_.emplace(event["_id"].get_document().value);
+                    this->received_.fetch_add(1, std::memory_order_relaxed);
+
+                    const bool full = batch.events.size() >= this->config_.batch_size;
+                    const bool late = now_ns - batch_start_ns >= std::chrono::nanoseconds(
+                                                                     this->config_.max_batch_delay).count();
+                    if (full || late)
+                        this->push(batch);
+                    if (this->stop_req_.load())
+                        break;
+                }
+
+                // Idle: the post-batch token also moves past the events filtered out by the pipeline.
+                if (const auto token = stream.get_resume_token())
+                    this->read_token_.emplace(*token);
+                if (!batch.events.empty())
+                    this->push(batch);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            this->watching_.store(false);
+            this->fail(e.what());
+            if (++failures >= kMaxConsecutiveFailures)
+            {
+                std::cerr << "[ChangeStreamConsumer] Giving up after " << failures << " consecutive errors."
+                          << std::endl;
+                break;
+            }
+
+            // Back off before reopening after the last event read.
+            std::unique_lock<std::mutex> lock(this->mutex_);
+            this->space_cv_.wait_for(lock, std::chrono::milliseconds(100) * failures,
+                                     [this]() { return this->stop_req_.load(); });
+            this->restarts_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    this->watching_.store(false);
+    this->running_.store(false);
+}
+
+bool ChangeStreamConsumer::push(Batch& batch)
+{
+    if (this->read_token_)
+        batch.resume_token.emplace(this->read_token_->view());
+
+    const std::size_t count = batch.events.size();
+    bool notify = false;
+    {
+        std::unique_lock<std::mutex> lock(this->mutex_);
+
+        // Backpressure: wait for the consumer (an oversized batch is accepted into an empty queue).
+        auto has_space = [this, count]()
+        {
+            return this->stop_req_.load() || this->queued_events_ == 0
+                   || this->queued_events_ + count <= this->config_.max_queued_events;
+        };
+        if (!has_space())
+        {
+            this->backpressure_waits_.fetch_add(1, std::memory_order_relaxed);
+            const std::int64_t start_ns = ChangeStreamConsumer::nowNs();
+            this->space_cv_.wait(lock, has_space);
+            this->backpressure_ns_.fetch_add(ChangeStreamConsumer::nowNs() - start_ns, std::memory_order_relaxed);
+        }
+        if (this->stop_req_.load())
+            return false;
+
+        notify = this->queue_.empty();
+        this->queued_events_ += count;
+        this->queue_.push_back(std::move(batch));
+    }
+    this->batches_.fetch_add(1, std::memory_order_relaxed);
+
+    batch = Batch();
+    batch.events.reserve(this->config_.batch_size);
+    if (notify && this->notifier_)
+        this->notifier_();
+    return true;
+}
+
+void ChangeStreamConsumer::commitToken(bsoncxx::document::value token)
+{
+    this->committed_token_.emplace(std::move(token));
+    this->token_dirty_ = true;
+    this->saveToken(false);
+}
+
+void ChangeStreamConsumer::saveToken(bool force)
+{
+    if (this->config_.resume_token_path.empty() || !this->committed_token_ || !this->token_dirty_)
+        return;
+
+    const auto now = std::chrono::steady_clock::now();
+    if (!force && now - this->token_saved_ < kTokenSavePeriod)
+        return;
+
+    // Written aside and renamed, a crash never leaves a truncated token.
+    const std::string tmp_path = this->config_.resume_token_path + ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::trunc);
+        file << bsoncxx::to_json(this->committed_token_->view());
+        if (!file)
+        {
+            std::cerr << "[ChangeStreamConsumer] Cannot write " << tmp_path << std::endl;
+            return;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(tmp_path, this->config_.resume_token_path, error);
+    if (error)
+    {
+        std::cerr << "[ChangeStreamConsumer] Cannot save the resume token: " << error.message() << std::endl;
+        return;
+    }
+    this->token_saved_ = now;
+    this->token_dirty_ = false;
+}
+
+void ChangeStreamConsumer::fail(const std::string& error)
+{
+    std::cerr << "[ChangeStreamConsumer] " << this->config_.database << "." << this->config_.collection << ": "
+              << error << std::endl;
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    this->last_error_ = error;
+}
+
+// =====================================================================================================================
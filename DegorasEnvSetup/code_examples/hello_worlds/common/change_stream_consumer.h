@@ -0,0 +1,211 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorlds Common – MongoDB change stream reader thread with bounded batch queue and resume tokens
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+// BSONCXX INCLUDES
+#include <bsoncxx/document/value.hpp>
+
+/**
+ * @brief Configuration of a ChangeStreamConsumer.
+ *
+ * Change streams need a replica set (a single node one is enough: mongod --replSet rs0, then rs.initiate()).
+ */
+struct ChangeStreamConfig
+{
+    std::string uri = "mongodb://localhost:27017/?directConnection=true";   ///< Server URI.
+    std::string database;                                                  ///< Database name.
+    std::string collection;                                                ///< Collection name.
+    std::string pipeline = "[]";                     ///< Stages in JSON, e.g. [{"$match": {"operationType": "insert"}}].
+    bool update_lookup = false;                      ///< Also get the full document of the updates.
+    std::size_t batch_size = 512;                    ///< Events per queued batch (and per server reply).
+    std::size_t max_queued_events = 65536;           ///< The reader waits while this many events are queued.
+    std::chrono::milliseconds max_batch_delay{10};   ///< A partial batch is queued after this time.
+    std::chrono::milliseconds max_await_time{20};    ///< Server wait for new events (also the stop latency).
+    std::string resume_token_path;                   ///< Token of the last drained batch, empty to start from now.
+};
+
+/**
+ * @brief One change event.
+ */
+struct ChangeEvent
+{
+    std::string operation;                              ///< operationType: "insert", "update", "delete", ...
+    std::optional<bsoncxx::document::value> document;   ///< fullDocument, if the event has it.
+    std::int64_t received_ns;                           ///< Time it was read from the stream (nowNs() clock).
+};
+
+/**
+ * @brief Reads a change stream of a collection in its own thread and queues the events in batches.
+ *
+ * The events are grouped in batches of `batch_size` (or less after `max_batch_delay` or when the stream is idle).
+ * The queue holds at most `max_queued_events`: when the consumer falls behind, the reader stops reading and the
+ * events wait in the server (backpressure), nothing is dropped.
+ *
+ * Resume tokens: after a network or server error the stream is reopened after the last event read, so the
+ * queued events are neither lost nor repeated. With `resume_token_path`, the token of the last drained batch is saved
+ * (at most once per second and on stop) and the next start resumes from it: the events read but not drained are
+ * delivered again (at least once).
+ *
+ * A mongocxx::instance must be alive while it runs. drain() is meant for a single consumer thread.
+ */
+class ChangeStreamConsumer
+{
+public:
+
+    explicit ChangeStreamConsumer(const ChangeStreamConfig& config);
+
+    ChangeStreamConsumer(const ChangeStreamConsumer&) = delete;
+    ChangeStreamConsumer& operator=(const ChangeStreamConsumer&) = delete;
+
+    /**
+     * @brief Stop the reader (see stop()).
+     */
+    ~ChangeStreamConsumer();
+
+    /**
+     * @brief Function called from the reader thread when a batch is queued and the queue was empty.
+     *
+     * Meant to wake up the consumer (e.g. a queued invokeMethod). Set it before start().
+     */
+    void setNotifier(std::function<void()> notifier);
+
+    /**
+     * @brief Start the reader thread. The stream is opened asynchronously (see isWatching()).
+     */
+    void start();
+
+    /**
+     * @brief Stop the reader (within max_await_time) and save the resume token of the last drained batch.
+     */
+    void stop();
+
+    /**
+     * @brief Move queued events into `events`, whole batches until `max_events` would be exceeded (at least one).
+     * @return Number of events moved.
+     */
+    std::size_t drain(std::vector<ChangeEvent>& events,
+                      std::size_t max_events = std::numeric_limits<std::size_t>::max());
+
+    /**
+     * @brief True while the stream is open (the events inserted from now on will be received).
+     */
+    bool isWatching() const noexcept;
+
+    /**
+     * @brief True until the reader gives up (stop() or repeated errors).
+     */
+    bool isRunning() const noexcept;
+
+    std::string lastError() const;
+
+    std::uint64_t received() const noexcept;
+
+    std::uint64_t delivered() const noexcept;
+
+    std::uint64_t batches() const noexcept;
+
+    std::size_t queued() const noexcept;
+
+    /**
+     * @brief Times the reader waited for the consumer, and total wait time.
+     */
+    std::uint64_t backpressureWaits() const noexcept;
+
+    std::int64_t backpressureNs() const noexcept;
+
+    /**
+     * @brief Times the stream was reopened after an error.
+     */
+    std::uint64_t restarts() const noexcept;
+
+    /**
+     * @brief Monotonic time in nanoseconds (steady clock, comparable between processes of the same host).
+     */
+    static std::int64_t nowNs() noexcept;
+
+private:
+
+    struct Batch
+    {
+        std::vector<ChangeEvent> events;
+        std::optional<bsoncxx::document::value> resume_token;   // Position after the last event of the batch.
+    };
+
+    void run();
+
+    /**
+     * @brief Queue a batch (waits while the queue is full) and leave `batch` empty. False if stopped.
+     */
+    bool push(Batch& batch);
+
+    void commitToken(bsoncxx::document::value token);
+
+    /**
+     * @brief Write the committed token if it changed, at most once per kTokenSavePeriod unless forced.
+     */
+    void saveToken(bool force);
+
+    void fail(const std::string& error);
+
+    // Constant expresions.
+    static constexpr int kMaxConsecutiveFailures = 10;
+    static constexpr std::chrono::milliseconds kTokenSavePeriod{1000};
+
+    ChangeStreamConfig config_;
+    std::function<void()> notifier_;
+
+    // Queue (reader -> consumer).
+    mutable std::mutex mutex_;
+    std::condition_variable space_cv_;
+    std::deque<Batch> queue_;
+    std::size_t queued_events_;
+
+    // Reader thread state.
+    std::optional<bsoncxx::document::value> read_token_;
+
+    // Consumer side token.
+    std::mutex token_mutex_;
+    std::optional<bsoncxx::document::value> committed_token_;
+    std::chrono::steady_clock::time_point token_saved_;
+    bool token_dirty_;
+
+    std::string last_error_;
+    std::atomic_bool stop_req_;
+    std::atomic_bool watching_;
+    std::atomic_bool running_;
+    std::atomic<std::uint64_t> received_;
+    std::atomic<std::uint64_t> delivered_;
+    std::atomic<std::uint64_t> batches_;
+    std::atomic<std::uint64_t> backpressure_waits_;
+    std::atomic<std::int64_t> backpressure_ns_;
+    std::atomic<std::uint64_t> restarts_;
+    std::thread worker_;
+};
+
+// =====================================================================================================================
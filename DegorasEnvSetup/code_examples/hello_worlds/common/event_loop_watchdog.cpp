@@ -0,0 +1,309 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+// QT INCLUDES
+#include <QCoreApplication>
+#include <QMetaEnum>
+
+// PROJECT INCLUDES
+#include "event_loop_watchdog.h"
+
+namespace
+{
+
+/**
+ * @brief Heartbeat posted by the monitor thread.
+ */
+class HeartbeatEvent : public QEvent
+{
+public:
+
+    static QEvent::Type eventType()
+    {
+        static const QEvent::Type type = static_cast<QEvent::Type>(QEvent::registerEventType());
+        return type;
+    }
+
+    HeartbeatEvent(std::uint64_t seq, std::int64_t sent_ns) :
+        QEvent(eventType()),
+        seq(seq),
+        sent_ns(sent_ns)
+    {}
+
+    const std::uint64_t seq;
+    const std::int64_t sent_ns;
+};
+
+/**
+ * @brief Nanoseconds to milliseconds.
+ */
+inline double toMs(double ns)
+{
+    return ns / 1e6;
+}
+
+/**
+ * @brief Raise an atomic maximum.
+ */
+inline void storeMax(std::atomic<std::int64_t>& target, std::int64_t value)
+{
+    std::int64_t current = target.load(std::memory_order_relaxed);
+    while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {}
+}
+
+} // namespace
+
+// =====================================================================================================================
+// SignalProbe
+// =====================================================================================================================
+
+EventLoopWatchdog::SignalProbe::SignalProbe(std::string name) :
+    name_(std::move(name))
+{}
+
+void EventLoopWatchdog::SignalProbe::emitted()
+{
+    const std::int64_t now = EventLoopWatchdog::nowNs();
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    this->emitted_ns_.push_back(now);
+}
+
+void EventLoopWatchdog::SignalProbe::delivered()
+{
+    const std::int64_t now = EventLoopWatchdog::nowNs();
+    std::int64_t emitted_ns = now;
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        if (this->emitted_ns_.empty())
+            return;
+        emitted_ns = this->emitted_ns_.front();
+        this->emitted_ns_.pop_front();
+    }
+    this->latency_.record(now - emitted_ns);
+}
+
+const std::string& EventLoopWatchdog::SignalProbe::name() const noexcept
+{
+    return this->name_;
+}
+
+const LatencyHistogram& EventLoopWatchdog::SignalProbe::latency() const noexcept
+{
+    return this->latency_;
+}
+
+// =====================================================================================================================
+// EventLoopWatchdog
+// =====================================================================================================================
+
+EventLoopWatchdog::EventLoopWatchdog(const WatchdogConfig& config, QObject* parent) :
+    QObject(parent),
+    config_(config),
+    delivered_seq_(0),
+    reported_seq_(0),
+    stalls_(0),
+    longest_stall_ns_(0),
+    dispatch_type_(QEvent::None),
+    dispatch_receiver_(nullptr),
+    stop_req_(false)
+{
+    this->config_.heartbeat_interval = std::max(this->config_.heartbeat_interval, std::chrono::milliseconds(1));
+}
+
+EventLoopWatchdog::~EventLoopWatchdog()
+{
+    this->stop();
+}
+
+void EventLoopWatchdog::start()
+{
+    if (this->monitor_.joinable())
+        return;
+
+    if (this->config_.track_dispatch && QCoreApplication::instance())
+        QCoreApplication::instance()->installEventFilter(this);
+
+    this->stop_req_ = false;
+    this->monitor_ = std::thread(&EventLoopWatchdog::run, this);
+}
+
+void EventLoopWatchdog::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->stop_req_ = true;
+    }
+    this->cv_.notify_all();
+    if (this->monitor_.joinable())
+        this->monitor_.join();
+
+    if (QCoreApplication::instance())
+        QCoreApplication::instance()->removeEventFilter(this);
+}
+
+void EventLoopWatchdog::setStallHandler(StallHandler handler)
+{
+    this->stall_handler_ = std::move(handler);
+}
+
+const LatencyHistogram& EventLoopWatchdog::heartbeatLatency() const noexcept
+{
+    return this->heartbeat_latency_;
+}
+
+const LatencyHistogram* EventLoopWatchdog::signalLatency(const std::string& name) const
+{
+    for (const auto& probe : this->probes_)
+    {
+        if (probe->name() == name)
+            return &probe->latency();
+    }
+    return nullptr;
+}
+
+std::uint64_t EventLoopWatchdog::stalls() const noexcept
+{
+    return this->stalls_.load(std::memory_order_relaxed);
+}
+
+std::int64_t EventLoopWatchdog::longestStallNs() const noexcept
+{
+    return this->longest_stall_ns_.load(std::memory_order_relaxed);
+}
+
+std::string EventLoopWatchdog::summary() const
+{
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3);
+    out << "heartbeats " << this->heartbeat_latency_.count()
+        << ", latency mean " << toMs(this->heartbeat_latency_.meanNs())
+        << " p99 " << toMs(static_cast<double>(this->heartbeat_latency_.percentileNs(0.99)))
+        << " max " << toMs(static_cast<double>(this->heartbeat_latency_.maxNs())) << " ms"
+        << ", stalls " << this->stalls() << " (longest " << toMs(static_cast<double>(this->longestStallNs()))
+        << " ms)\n";
+
+    for (const auto& probe : this->probes_)
+    {
+        const LatencyHistogram& latency = probe->latency();
+        out << "  signal " << std::left << std::setw(20) << probe->name() << std::right
+            << " count " << latency.count()
+            << " mean " << toMs(latency.meanNs())
+            << " p99 " << toMs(static_cast<double>(latency.percentileNs(0.99)))
+            << " max " << toMs(static_cast<double>(latency.maxNs())) << " ms\n";
+    }
+    return out.str();
+}
+
+bool EventLoopWatchdog::event(QEvent* event)
+{
+    if (event->type() != HeartbeatEvent::eventType())
+        return QObject::event(event);
+
+    const auto* heartbeat = static_cast<const HeartbeatEvent*>(event);
+    const std::int64_t latency_ns = nowNs() - heartbeat->sent_ns;
+    this->heartbeat_latency_.record(latency_ns);
+    storeMax(this->longest_stall_ns_, latency_ns);
+
+    if (this->reported_seq_.load(std::memory_order_acquire) == heartbeat->seq)
+    {
+        std::cerr << "[EventLoopWatchdog] Event loop recovered after " << std::fixed << std::setprecision(3)
+                  << toMs(static_cast<double>(latency_ns)) << " ms." << std::endl;
+    }
+
+    // Lets the monitor post the next heartbeat.
+    this->delivered_seq_.store(heartbeat->seq, std::memory_order_release);
+    return true;
+}
+
+bool EventLoopWatchdog::eventFilter(QObject* watched, QEvent* event)
+{
+    // Runs for every event of the thread: two relaxed stores, the class name is static metadata.
+    this->dispatch_type_.store(static_cast<int>(event->type()), std::memory_order_relaxed);
+    this->dispatch_receiver_.store(watched->metaObject()->className(), std::memory_order_relaxed);
+    return false;
+}
+
+EventLoopWatchdog::SignalProbe* EventLoopWatchdog::addProbe(const std::string& name)
+{
+    this->probes_.push_back(std::make_unique<SignalProbe>(name));
+    return this->probes_.back().get();
+}
+
+void EventLoopWatchdog::run()
+{
+    std::uint64_t posted_seq = 0;
+    std::int64_t sent_ns = 0;
+
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    while (!this->cv_.wait_for(lock, this->config_.heartbeat_interval, [this] { return this->stop_req_; }))
+    {
+        const std::int64_t now = nowNs();
+
+        // Previous heartbeat handled: post the next one.
+        if (this->delivered_seq_.load(std::memory_order_acquire) == posted_seq)
+        {
+            sent_ns = now;
+            QCoreApplication::postEvent(this, new HeartbeatEvent(++posted_seq, sent_ns));
+            continue;
+        }
+
+        // Still waiting: report the stall once per heartbeat.
+        const std::int64_t blocked_ns = now - sent_ns;
+        storeMax(this->longest_stall_ns_, blocked_ns);
+        const auto threshold_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(this->config_.stall_threshold);
+        if (blocked_ns > threshold_ns.count() && this->reported_seq_.load(std::memory_order_relaxed) != posted_seq)
+        {
+            this->reported_seq_.store(posted_seq, std::memory_order_release);
+            this->stalls_.fetch_add(1, std::memory_order_relaxed);
+            lock.unlock();
+            this->reportStall(posted_seq, blocked_ns);
+            lock.lock();
+        }
+    }
+}
+
+void EventLoopWatchdog::reportStall(std::uint64_t heartbeat, std::int64_t blocked_ns)
+{
+    StallReport report{heartbeat, blocked_ns, std::string(), std::string()};
+    if (this->config_.track_dispatch)
+    {
+        const int type = this->dispatch_type_.load(std::memory_order_relaxed);
+        const char* key = QMetaEnum::fromType<QEvent::Type>().valueToKey(type);
+        const char* receiver = this->dispatch_receiver_.load(std::memory_order_relaxed);
+        report.event_type = key ? key : std::to_string(type);
+        report.receiver = receiver ? receiver : "";
+    }
+
+    std::cerr << "[EventLoopWatchdog] Event loop stalled: heartbeat " << heartbeat << " waiting for "
+              << std::fixed << std::setprecision(3) << toMs(static_cast<double>(blocked_ns)) << " ms (threshold "
+              << this->config_.stall_threshold.count() << " ms)";
+    if (!report.event_type.empty())
+        std::cerr << ", dispatching " << report.event_type << " to " << report.receiver;
+    std::cerr << std::endl;
+
+    if (this->stall_handler_)
+        this->stall_handler_(report);
+}
+
+std::int64_t EventLoopWatchdog::nowNs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// =====================================================================================================================
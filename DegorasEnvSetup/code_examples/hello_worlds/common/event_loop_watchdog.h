@@ -0,0 +1,189 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorlds Common – GUI thread event loop watchdog (dispatch latency, stalls, queued signal delivery)
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// QT INCLUDES
+#include <QEvent>
+#include <QObject>
+
+// PROJECT INCLUDES
+#include "latency_histogram.h"
+
+/**
+ * @brief Configuration of the EventLoopWatchdog.
+ */
+struct WatchdogConfig
+{
+    std::chrono::milliseconds heartbeat_interval{50};   ///< Time between two heartbeats (when the last one arrived).
+    std::chrono::milliseconds stall_threshold{200};     ///< Heartbeat latency reported as a stall.
+    bool track_dispatch = true;                         ///< Record the event being dispatched, for stall reports.
+};
+
+/**
+ * @brief Stall of the watched event loop, as seen from the monitor thread.
+ */
+struct StallReport
+{
+    std::uint64_t heartbeat;     ///< Sequence number of the delayed heartbeat.
+    std::int64_t blocked_ns;     ///< Time the heartbeat has been waiting when the stall was detected.
+    std::string event_type;      ///< Event being dispatched in the loop (empty if dispatch tracking is off).
+    std::string receiver;        ///< Class of the receiver of that event.
+};
+
+/**
+ * @brief Watchdog of the event loop of the thread it lives in (normally the GUI thread).
+ *
+ * A monitor thread posts a heartbeat event to the loop every heartbeat interval and the loop records its dispatch
+ * latency when it handles it. If a heartbeat waits longer than the stall threshold, the monitor logs a stall report
+ * once (and calls the stall handler) with the event the loop was dispatching; a second line is logged when the loop
+ * recovers. Only one heartbeat is in flight at a time, so a blocked loop does not pile up events.
+ *
+ * trackQueuedSignal() measures the time between the emission of a signal in another thread and the delivery of a
+ * queued slot call in this loop, which is what a queued Model -> View connection waits.
+ */
+class EventLoopWatchdog : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    using StallHandler = std::function<void(const StallReport&)>;
+
+    /**
+     * @param config Heartbeat interval, stall threshold and dispatch tracking.
+     * @param parent Parent object, its thread is the watched thread.
+     */
+    explicit EventLoopWatchdog(const WatchdogConfig& config = WatchdogConfig(), QObject* parent = nullptr);
+
+    EventLoopWatchdog(const EventLoopWatchdog&) = delete;
+    EventLoopWatchdog& operator=(const EventLoopWatchdog&) = delete;
+
+    ~EventLoopWatchdog() override;
+
+    void start();
+
+    void stop();
+
+    /**
+     * @brief Called from the monitor thread for each stall, after the log line. Set it before start().
+     */
+    void setStallHandler(StallHandler handler);
+
+    /**
+     * @brief Measure the queued delivery of `signal` of `sender` to this thread under `name`. Call it from this thread.
+     */
+    template <typename Sender, typename Signal>
+    void trackQueuedSignal(const Sender* sender, Signal signal, const std::string& name)
+    {
+        SignalProbe* probe = this->addProbe(name);
+
+        // Connected first, so it runs in the emitting thread before the queued call is posted.
+        QObject::connect(sender, signal, this, [probe]() { probe->emitted(); }, Qt::DirectConnection);
+        QObject::connect(sender, signal, this, [probe]() { probe->delivered(); }, Qt::QueuedConnection);
+    }
+
+    /**
+     * @brief Heartbeat dispatch latency (post in the monitor thread -> handled in the loop).
+     */
+    const LatencyHistogram& heartbeatLatency() const noexcept;
+
+    /**
+     * @brief Delivery latency of a tracked signal, nullptr if not tracked.
+     */
+    const LatencyHistogram* signalLatency(const std::string& name) const;
+
+    std::uint64_t stalls() const noexcept;
+
+    /**
+     * @brief Longest heartbeat latency seen, including a stall still in progress.
+     */
+    std::int64_t longestStallNs() const noexcept;
+
+    /**
+     * @brief Human readable summary (heartbeats, stalls and one line per tracked signal).
+     */
+    std::string summary() const;
+
+protected:
+
+    bool event(QEvent* event) override;
+
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private:
+
+    /**
+     * @brief Emission timestamps of a tracked signal, delivered in order (queued calls keep the emission order).
+     */
+    class SignalProbe
+    {
+    public:
+
+        explicit SignalProbe(std::string name);
+
+        void emitted();
+
+        void delivered();
+
+        const std::string& name() const noexcept;
+
+        const LatencyHistogram& latency() const noexcept;
+
+    private:
+
+        std::string name_;
+        std::mutex mutex_;
+        std::deque<std::int64_t> emitted_ns_;
+        LatencyHistogram latency_;
+    };
+
+    SignalProbe* addProbe(const std::string& name);
+
+    void run();
+
+    void reportStall(std::uint64_t heartbeat, std::int64_t blocked_ns);
+
+    static std::int64_t nowNs() noexcept;
+
+    WatchdogConfig config_;
+    StallHandler stall_handler_;
+    std::vector<std::unique_ptr<SignalProbe>> probes_;
+    LatencyHistogram heartbeat_latency_;
+    std::atomic<std::uint64_t> delivered_seq_;
+    std::atomic<std::uint64_t> reported_seq_;
+    std::atomic<std::uint64_t> stalls_;
+    std::atomic<std::int64_t> longest_stall_ns_;
+    std::atomic<int> dispatch_type_;
+    std::atomic<const char*> dispatch_receiver_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stop_req_;
+    std::thread monitor_;
+};
+
+// =====================================================================================================================
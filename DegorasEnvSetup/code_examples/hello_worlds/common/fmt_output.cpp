@@ -0,0 +1,90 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <iostream>
+
+// PROJECT INCLUDES
+#include "fmt_output.h"
+
+// =====================================================================================================================
+
+FmtOutput::FmtOutput(std::FILE* file, std::size_t threshold) :
+    file_(file),
+    owned_(false),
+    threshold_(threshold)
+{}
+
+FmtOutput::FmtOutput(const std::string& path, std::size_t threshold) :
+    file_(std::fopen(path.c_str(), "w")),
+    owned_(true),
+    threshold_(threshold)
+{
+    if (!this->file_)
+        std::cerr << "[FmtOutput] Cannot open " << path << std::endl;
+}
+
+FmtOutput::~FmtOutput()
+{
+    if (!this->file_)
+        return;
+
+    this->write();
+    if (this->owned_)
+        std::fclose(this->file_);
+    else
+        std::fflush(this->file_);
+}
+
+bool FmtOutput::isOpen() const noexcept
+{
+    return this->file_ != nullptr;
+}
+
+void FmtOutput::append(std::string_view text)
+{
+    this->buffer_.append(text.data(), text.data() + text.size());
+    if (this->buffer_.size() >= this->threshold_)
+        this->write();
+}
+
+void FmtOutput::flush()
+{
+    this->write();
+    if (this->file_)
+        std::fflush(this->file_);
+}
+
+std::size_t FmtOutput::buffered() const noexcept
+{
+    return this->buffer_.size();
+}
+
+void FmtOutput::write()
+{
+    // Without a file the text is dropped, so the buffer does not grow forever.
+    if (this->file_ && this->buffer_.size() > 0)
+        std::fwrite(this->buffer_.data(), 1, this->buffer_.size(), this->file_);
+    this->buffer_.clear();
+}
+
+FmtOutput& stdoutBuffer()
+{
+    thread_local FmtOutput output(stdout);
+    return output;
+}
+
+fmt::memory_buffer& scratchBuffer()
+{
+    thread_local fmt::memory_buffer buffer;
+    return buffer;
+}
+
+// =====================================================================================================================
@@ -0,0 +1,128 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorlds Common – Buffered fmt output without per-line flushes or temporary strings
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <cstddef>
+#include <cstdio>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// FMT INCLUDES
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+/**
+ * @brief Text output formatted by fmt into a reused buffer and written in large blocks.
+ *
+ * print() formats straight into the buffer (no temporary std::string, no allocation once the buffer has grown) and
+ * the buffer is written with a single fwrite() when it reaches the threshold, on flush() and on destruction. Nothing
+ * is flushed per line: call flush() where the output must be visible (end of a section, before waiting, progress).
+ * Hot loops should use FMT_COMPILE format strings, parsed and checked at compile time.
+ *
+ * Not thread safe, use one per thread (stdoutBuffer() gives the one of the calling thread). When std::cout is also
+ * used on the same stream, flush() before writing to it to keep the order.
+ */
+class FmtOutput
+{
+public:
+
+    // Constant expresions.
+    static constexpr std::size_t kDefaultThreshold = 64 * 1024;
+
+    /**
+     * @param file Stream written (not closed).
+     * @param threshold Buffered bytes that trigger a write.
+     */
+    explicit FmtOutput(std::FILE* file = stdout, std::size_t threshold = kDefaultThreshold);
+
+    /**
+     * @brief Create (truncate) and own a file. See isOpen().
+     */
+    explicit FmtOutput(const std::string& path, std::size_t threshold = kDefaultThreshold);
+
+    FmtOutput(const FmtOutput&) = delete;
+    FmtOutput& operator=(const FmtOutput&) = delete;
+
+    /**
+     * @brief Flush the buffered text and close the owned file.
+     */
+    ~FmtOutput();
+
+    bool isOpen() const noexcept;
+
+    /**
+     * @brief Append formatted text, e.g. print(FMT_COMPILE("[OK] Inserted document {}\n"), i).
+     */
+    template <typename S, typename... Args>
+    void print(const S& format, Args&&... args)
+    {
+        fmt::format_to(std::back_inserter(this->buffer_), format, std::forward<Args>(args)...);
+        if (this->buffer_.size() >= this->threshold_)
+            this->write();
+    }
+
+    /**
+     * @brief Append text already formatted.
+     */
+    void append(std::string_view text);
+
+    /**
+     * @brief Write the buffered text and flush the stream.
+     */
+    void flush();
+
+    std::size_t buffered() const noexcept;
+
+private:
+
+    /**
+     * @brief Write the buffered text (no stream flush).
+     */
+    void write();
+
+    fmt::memory_buffer buffer_;
+    std::FILE* file_;
+    bool owned_;
+    std::size_t threshold_;
+};
+
+/**
+ * @brief Buffered stdout of the calling thread, flushed by flush() and when the thread ends.
+ */
+FmtOutput& stdoutBuffer();
+
+/**
+ * @brief Scratch buffer of the calling thread (see formatScratch()).
+ */
+fmt::memory_buffer& scratchBuffer();
+
+/**
+ * @brief Format into the scratch buffer of the calling thread, for APIs that take a string view.
+ *
+ * The view is valid until the next call in the same thread. No allocation once the buffer has grown.
+ */
+template <typename S, typename... Args>
+std::string_view formatScratch(const S& format, Args&&... args)
+{
+    fmt::memory_buffer& buffer = scratchBuffer();
+    buffer.clear();
+    fmt::format_to(std::back_inserter(buffer), format, std::forward<Args>(args)...);
+    return std::string_view(buffer.data(), buffer.size());
+}
+
+// =====================================================================================================================
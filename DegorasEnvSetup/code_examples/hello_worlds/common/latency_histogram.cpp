@@ -0,0 +1,116 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <algorithm>
+#include <cmath>
+
+// PROJECT INCLUDES
+#include "latency_histogram.h"
+
+// =====================================================================================================================
+
+LatencyHistogram::LatencyHistogram() noexcept :
+    count_(0),
+    sum_ns_(0),
+    max_ns_(0)
+{
+    for (auto& bucket : this->buckets_)
+        bucket.store(0, std::memory_order_relaxed);
+}
+
+std::size_t LatencyHistogram::bucketIndex(std::int64_t ns) noexcept
+{
+    if (ns < static_cast<std::int64_t>(kSubBuckets))
+        return ns < 0 ? 0 : static_cast<std::size_t>(ns);
+
+    // Octave from the highest bit, position inside the octave from the next kSubBucketBits bits.
+    const auto value = static_cast<std::uint64_t>(ns);
+    const unsigned exponent = 63u - static_cast<unsigned>(__builtin_clzll(value));
+    const std::size_t sub = (value >> (exponent - kSubBucketBits)) & (kSubBuckets - 1);
+    const std::size_t index = (exponent - kSubBucketBits + 1) * kSubBuckets + sub;
+    return std::min(index, kBucketCount - 1);
+}
+
+std::int64_t LatencyHistogram::bucketUpperNs(std::size_t index) noexcept
+{
+    if (index < kSubBuckets)
+        return static_cast<std::int64_t>(index);
+
+    const unsigned shift = static_cast<unsigned>(index / kSubBuckets) - 1;
+    const std::uint64_t lower = (kSubBuckets + index % kSubBuckets) << shift;
+    return static_cast<std::int64_t>(lower + (std::uint64_t{1} << shift) - 1);
+}
+
+void LatencyHistogram::record(std::int64_t ns) noexcept
+{
+    if (ns < 0)
+        ns = 0;
+
+    this->buckets_[bucketIndex(ns)].fetch_add(1, std::memory_order_relaxed);
+    this->count_.fetch_add(1, std::memory_order_relaxed);
+    this->sum_ns_.fetch_add(static_cast<std::uint64_t>(ns), std::memory_order_relaxed);
+
+    std::int64_t current = this->max_ns_.load(std::memory_order_relaxed);
+    while (ns > current && !this->max_ns_.compare_exchange_weak(current, ns, std::memory_order_relaxed))
+    {}
+}
+
+void LatencyHistogram::reset() noexcept
+{
+    for (auto& bucket : this->buckets_)
+        bucket.store(0, std::memory_order_relaxed);
+    this->count_.store(0, std::memory_order_relaxed);
+    this->sum_ns_.store(0, std::memory_order_relaxed);
+    this->max_ns_.store(0, std::memory_order_relaxed);
+}
+
+std::uint64_t LatencyHistogram::count() const noexcept
+{
+    return this->count_.load(std::memory_order_relaxed);
+}
+
+double LatencyHistogram::meanNs() const noexcept
+{
+    const std::uint64_t count = this->count();
+    return count ? static_cast<double>(this->sum_ns_.load(std::memory_order_relaxed)) / count : 0.0;
+}
+
+std::int64_t LatencyHistogram::maxNs() const noexcept
+{
+    return this->max_ns_.load(std::memory_order_relaxed);
+}
+
+std::int64_t LatencyHistogram::percentileNs(double q) const noexcept
+{
+    // Sum the buckets instead of using count_, both can differ while a writer is running.
+    std::uint64_t total = 0;
+    for (const auto& bucket : this->buckets_)
+        total += bucket.load(std::memory_order_relaxed);
+    if (total == 0)
+        return 0;
+
+    const auto rank = static_cast<std::uint64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * total));
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < kBucketCount; ++i)
+    {
+        seen += this->buckets_[i].load(std::memory_order_relaxed);
+        if (seen >= std::max<std::uint64_t>(rank, 1))
+            return std::min(bucketUpperNs(i), this->maxNs());
+    }
+    return this->maxNs();
+}
+
+std::uint64_t LatencyHistogram::bucketCount(std::size_t index) const noexcept
+{
+    return index < kBucketCount ? this->buckets_[index].load(std::memory_order_relaxed) : 0;
+}
+
+// =====================================================================================================================
@@ -0,0 +1,79 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorlds Common – Lock-free latency histogram shared by the Qt examples
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Lock-free log-linear histogram of durations in nanoseconds.
+ *
+ * 16 buckets per power of two (relative error below 6.25 %) from 1 ns to about 36 minutes. Recording is a few
+ * relaxed atomic operations and never allocates, so it can be called from any thread while another one reads.
+ * Readers see a consistent enough view for statistics, not an atomic snapshot.
+ */
+class LatencyHistogram
+{
+public:
+
+    // Constant expresions.
+    static constexpr unsigned kSubBucketBits = 4;
+    static constexpr std::size_t kSubBuckets = std::size_t{1} << kSubBucketBits;
+    static constexpr std::size_t kBucketCount = 38 * kSubBuckets;
+
+    LatencyHistogram() noexcept;
+
+    /**
+     * @brief Add one value. Negative values count as 0, values beyond the range go to the last bucket.
+     */
+    void record(std::int64_t ns) noexcept;
+
+    /**
+     * @brief Clear all the values. Not atomic with concurrent record() calls.
+     */
+    void reset() noexcept;
+
+    std::uint64_t count() const noexcept;
+
+    double meanNs() const noexcept;
+
+    std::int64_t maxNs() const noexcept;
+
+    /**
+     * @brief Upper bound of the bucket holding the q-quantile (0 < q <= 1), capped to the maximum. 0 if empty.
+     */
+    std::int64_t percentileNs(double q) const noexcept;
+
+    std::uint64_t bucketCount(std::size_t index) const noexcept;
+
+    /**
+     * @brief Largest value stored in the bucket `index`.
+     */
+    static std::int64_t bucketUpperNs(std::size_t index) noexcept;
+
+    static std::size_t bucketIndex(std::int64_t ns) noexcept;
+
+private:
+
+    std::array<std::atomic<std::uint64_t>, kBucketCount> buckets_;
+    std::atomic<std::uint64_t> count_;
+    std::atomic<std::uint64_t> sum_ns_;
+    std::atomic<std::int64_t> max_ns_;
+};
+
+// =====================================================================================================================
@@ -0,0 +1,309 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+// PLATFORM-SPECIFIC
+#if defined(_WIN32)
+    #include <windows.h>
+#elif defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+    #include <sys/resource.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+// PROJECT INCLUDES
+#include "thread_placement.h"
+
+namespace
+{
+
+/**
+ * @brief Report a part of a placement that could not be applied.
+ */
+void warnPlacement(const ThreadPlacement& placement, const std::string& what, const std::string& error)
+{
+    std::cerr << "[ThreadPlacement] " << (placement.name.empty() ? std::string("thread") : placement.name)
+              << ": cannot set " << what << ": " << error << std::endl;
+}
+
+/**
+ * @brief All the logical cores (0 to hardware_concurrency - 1).
+ */
+std::vector<int> allCores()
+{
+    std::vector<int> cores(std::max(1u, std::thread::hardware_concurrency()));
+    for (std::size_t i = 0; i < cores.size(); ++i)
+        cores[i] = static_cast<int>(i);
+    return cores;
+}
+
+#if defined(_WIN32)
+
+/**
+ * @brief Closest Windows thread priority of a policy and priority.
+ */
+int windowsPriority(ThreadPolicy policy, int priority)
+{
+    switch (policy)
+    {
+    case ThreadPolicy::Fifo:
+    case ThreadPolicy::RoundRobin:
+        return priority >= 50 ? THREAD_PRIORITY_TIME_CRITICAL : THREAD_PRIORITY_HIGHEST;
+    case ThreadPolicy::Batch:
+        return THREAD_PRIORITY_BELOW_NORMAL;
+    case ThreadPolicy::Idle:
+        return THREAD_PRIORITY_IDLE;
+    default:
+        // Nice value: negative is more important.
+        if (priority <= -10)
+            return THREAD_PRIORITY_HIGHEST;
+        if (priority < 0)
+            return THREAD_PRIORITY_ABOVE_NORMAL;
+        if (priority >= 10)
+            return THREAD_PRIORITY_LOWEST;
+        return priority > 0 ? THREAD_PRIORITY_BELOW_NORMAL : THREAD_PRIORITY_NORMAL;
+    }
+}
+
+/**
+ * @brief SetThreadDescription() is looked up at run time (Windows 10 1607 and later).
+ */
+bool setWindowsThreadName(const std::string& name)
+{
+    using SetDescription = HRESULT(WINAPI*)(HANDLE, PCWSTR);
+    const HMODULE kernel = GetModuleHandleW(L"kernel32.dll");
+    const auto set_description = kernel ? reinterpret_cast<SetDescription>(
+                                              reinterpret_cast<void*>(GetProcAddress(kernel, "SetThreadDescription")))
+                                        : nullptr;
+    if (!set_description)
+        return false;
+
+    std::wstring wide(static_cast<std::size_t>(MultiByteToWideChar(CP_UTF8, 0, name.c_str(), -1, nullptr, 0)), L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, name.c_str(), -1, wide.data(), static_cast<int>(wide.size()));
+    return SUCCEEDED(set_description(GetCurrentThread(), wide.c_str()));
+}
+
+#endif
+
+} // namespace
+
+// =====================================================================================================================
+
+bool ThreadPlacement::isEmpty() const noexcept
+{
+    return this->name.empty() && this->cores.empty() && this->policy == ThreadPolicy::Inherit;
+}
+
+bool applyThreadPlacement(const ThreadPlacement& placement)
+{
+    bool ok = true;
+
+#if defined(_WIN32)
+
+    if (!placement.name.empty() && !setWindowsThreadName(placement.name))
+    {
+        warnPlacement(placement, "the name", "SetThreadDescription not available");
+        ok = false;
+    }
+
+    if (!placement.cores.empty())
+    {
+        DWORD_PTR mask = 0;
+        for (const int core : placement.cores)
+            if (core >= 0 && core < static_cast<int>(sizeof(DWORD_PTR) * 8))
+                mask |= DWORD_PTR{1} << core;
+        if (mask == 0 || SetThreadAffinityMask(GetCurrentThread(), mask) == 0)
+        {
+            warnPlacement(placement, "the cores", "error " + std::to_string(GetLastError()));
+            ok = false;
+        }
+    }
+
+    if (placement.policy != ThreadPolicy::Inherit
+        && !SetThreadPriority(GetCurrentThread(), windowsPriority(placement.policy, placement.priority)))
+    {
+        warnPlacement(placement, "the priority", "error " + std::to_string(GetLastError()));
+        ok = false;
+    }
+
+#elif defined(__linux__)
+
+    if (!placement.name.empty())
+    {
+        const int error = pthread_setname_np(pthread_self(), placement.name.substr(0, 15).c_str());
+        if (error != 0)
+        {
+            warnPlacement(placement, "the name", std::strerror(error));
+            ok = false;
+        }
+    }
+
+    if (!placement.cores.empty())
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (const int core : placement.cores)
+            if (core >= 0 && core < CPU_SETSIZE)
+                CPU_SET(core, &set);
+        const int error = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+        if (error != 0)
+        {
+            warnPlacement(placement, "the cores", std::strerror(error));
+            ok = false;
+        }
+    }
+
+    if (placement.policy != ThreadPolicy::Inherit)
+    {
+        int policy = SCHED_OTHER;
+        switch (placement.policy)
+        {
+        case ThreadPolicy::Batch:      policy = SCHED_BATCH; break;
+        case ThreadPolicy::Idle:       policy = SCHED_IDLE; break;
+        case ThreadPolicy::Fifo:       policy = SCHED_FIFO; break;
+        case ThreadPolicy::RoundRobin: policy = SCHED_RR; break;
+        default:                       break;
+        }
+
+        const bool real_time = policy == SCHED_FIFO || policy == SCHED_RR;
+        sched_param param{};
+        param.sched_priority = real_time ? std::clamp(placement.priority, sched_get_priority_min(policy),
+                                                      sched_get_priority_max(policy))
+                                         : 0;
+        const int error = pthread_setschedparam(pthread_self(), policy, &param);
+        if (error != 0)
+        {
+            warnPlacement(placement, "the policy", std::strerror(error));
+            ok = false;
+        }
+
+        // The nice value is per thread on Linux (the thread id, not the process id).
+        if (error == 0 && !real_time && policy != SCHED_IDLE
+            && setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), placement.priority) != 0)
+        {
+            warnPlacement(placement, "the nice value", std::strerror(errno));
+            ok = false;
+        }
+    }
+
+#else
+
+    if (!placement.isEmpty())
+    {
+        warnPlacement(placement, "the placement", "not supported on this platform");
+        ok = false;
+    }
+
+#endif
+
+    return ok;
+}
+
+std::vector<int> currentThreadCores()
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+        return allCores();
+
+    std::vector<int> cores;
+    for (int core = 0; core < CPU_SETSIZE; ++core)
+        if (CPU_ISSET(core, &set))
+            cores.push_back(core);
+    return cores;
+#else
+    return allCores();
+#endif
+}
+
+std::vector<int> parseCoreList(const std::string& text)
+{
+    std::vector<int> cores;
+    std::size_t start = 0;
+    while (start <= text.size())
+    {
+        const std::size_t end = std::min(text.find(',', start), text.size());
+        const std::string item = text.substr(start, end - start);
+        const std::size_t dash = item.find('-');
+        try
+        {
+            std::size_t used = 0;
+            const int first = std::stoi(item.substr(0, dash), &used);
+            if (used != (dash == std::string::npos ? item.size() : dash))
+                throw std::invalid_argument(item);
+            int last = first;
+            if (dash != std::string::npos)
+            {
+                last = std::stoi(item.substr(dash + 1), &used);
+                if (used != item.size() - dash - 1)
+                    throw std::invalid_argument(item);
+            }
+            if (first < 0 || last < first)
+                throw std::invalid_argument(item);
+            for (int core = first; core <= last; ++core)
+                cores.push_back(core);
+        }
+        catch (const std::exception&)
+        {
+            throw std::invalid_argument("Invalid core list: " + text);
+        }
+        start = end + 1;
+    }
+
+    std::sort(cores.begin(), cores.end());
+    cores.erase(std::unique(cores.begin(), cores.end()), cores.end());
+    return cores;
+}
+
+ThreadPolicy parseThreadPolicy(const std::string& text)
+{
+    if (text == "inherit")
+        return ThreadPolicy::Inherit;
+    if (text == "normal")
+        return ThreadPolicy::Normal;
+    if (text == "batch")
+        return ThreadPolicy::Batch;
+    if (text == "idle")
+        return ThreadPolicy::Idle;
+    if (text == "fifo")
+        return ThreadPolicy::Fifo;
+    if (text == "rr")
+        return ThreadPolicy::RoundRobin;
+    throw std::invalid_argument("Invalid thread policy: " + text);
+}
+
+std::string describeThreadPlacement(const ThreadPlacement& placement)
+{
+    static const char* const kPolicyNames[] = {"inherit", "normal", "batch", "idle", "fifo", "rr"};
+
+    std::string text = placement.name.empty() ? std::string("thread") : placement.name;
+    if (!placement.cores.empty())
+    {
+        text += " cores ";
+        for (std::size_t i = 0; i < placement.cores.size(); ++i)
+            text += (i == 0 ? "" : ",") + std::to_string(placement.cores[i]);
+    }
+    if (placement.policy != ThreadPolicy::Inherit)
+        text += std::string(" ") + kPolicyNames[static_cast<int>(placement.policy)] + " "
+                + std::to_string(placement.priority);
+    return text;
+}
+
+// =====================================================================================================================
@@ -0,0 +1,83 @@
+/***********************************************************************************************************************
+ *  Copyright (C) 2025 Degoras Project Team
+ *
+ *  Authors:
+ *      Ángel Vera Herrera       <avera@roa.es>   |  <angelvh.engr@gmail.com>
+ *      Jesús Relinque Madroñal
+ *
+ *  Licensed under the MIT License.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *   HelloWorlds Common – Thread placement: name, allowed cores, scheduling policy and priority
+ **********************************************************************************************************************/
+
+#pragma once
+
+// C++ INCLUDES
+#include <string>
+#include <vector>
+
+/**
+ * @brief Scheduling policy of a placed thread.
+ */
+enum class ThreadPolicy
+{
+    Inherit,     ///< Keep the policy and priority of the creating thread.
+    Normal,      ///< Time sharing (SCHED_OTHER), priority is the nice value.
+    Batch,       ///< Time sharing for throughput work, longer slices (SCHED_BATCH).
+    Idle,        ///< Runs only when nothing else wants the core (SCHED_IDLE).
+    Fifo,        ///< Real time, runs until it blocks (SCHED_FIFO). Needs CAP_SYS_NICE or an rtprio limit.
+    RoundRobin   ///< Real time with time slices between equal priorities (SCHED_RR).
+};
+
+/**
+ * @brief Where and how a thread runs.
+ *
+ * Windows has no policies: Fifo and RoundRobin map to the highest thread priorities, Batch and Idle to the lowest
+ * ones, and the nice value of Normal to the closest thread priority.
+ */
+struct ThreadPlacement
+{
+    std::string name;                            ///< Thread name, empty to keep it (Linux keeps 15 characters).
+    std::vector<int> cores;                      ///< Allowed logical cores, empty for any.
+    ThreadPolicy policy = ThreadPolicy::Inherit;
+    int priority = 0;                            ///< Fifo and RoundRobin: 1 to 99. Normal and Batch: nice, -20 to 19.
+
+    /**
+     * @brief True if nothing would be changed.
+     */
+    bool isEmpty() const noexcept;
+};
+
+/**
+ * @brief Apply a placement to the calling thread.
+ *
+ * Every part is tried. The ones refused by the system (e.g. a real time policy without privileges) are reported on
+ * std::cerr and the thread keeps running as before for them.
+ *
+ * @return True if every part was applied.
+ */
+bool applyThreadPlacement(const ThreadPlacement& placement);
+
+/**
+ * @brief Cores the calling thread may run on (all the cores if unknown).
+ */
+std::vector<int> currentThreadCores();
+
+/**
+ * @brief Parse a core list like "2", "0,2,4" or "0-3,6". Throws std::invalid_argument on a malformed list.
+ */
+std::vector<int> parseCoreList(const std::string& text);
+
+/**
+ * @brief Parse a policy name: inherit, normal, batch, idle, fifo or rr. Throws std::invalid_argument if unknown.
+ */
+ThreadPolicy parseThreadPolicy(const std::string& text);
+
+/**
+ * @brief Short text of a placement, e.g. "spdlog-pool cores 2,3 fifo 10".
+ */
+std::string describeThreadPlacement(const ThreadPlacement& placement);
+
+// =====================================================================================================================